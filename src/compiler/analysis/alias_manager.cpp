@@ -2476,7 +2476,7 @@ void AliasManager::gatherInfo(AnalysisResultConstPtr ar, MethodStatementPtr m) {
   }
 
   if (m_inlineAsExpr) {
-    if (cost > Option::AutoInline ||
+    if (cost > Option::InlineLimit(Option::AutoInline, func->getFullName()) ||
         func->isVariableArgument() ||
         m_variables->getAttribute(VariableTable::ContainsDynamicVariable) ||
         m_variables->getAttribute(VariableTable::ContainsExtract) ||
@@ -17,9 +17,14 @@
 #include <util/logger.h>
 #include <util/util.h>
 #include <util/job_queue.h>
+#include <util/atomic.h>
+#include <util/async_func.h>
+#include <util/synchronizable.h>
+#include <util/timer.h>
 #include <util/parser/hphp.tab.hpp>
 #include <runtime/vm/bytecode.h>
 #include <runtime/vm/repo.h>
+#include <runtime/vm/flat_repo.h>
 #include <runtime/vm/as.h>
 #include <runtime/vm/stats.h>
 #include <runtime/base/runtime_option.h>
@@ -30,10 +35,12 @@
 
 #include <compiler/builtin_symbols.h>
 #include <compiler/analysis/class_scope.h>
+#include <compiler/analysis/constant_table.h>
 #include <compiler/analysis/emitter.h>
 #include <compiler/analysis/file_scope.h>
 #include <compiler/analysis/function_scope.h>
 #include <compiler/analysis/peephole.h>
+#include <compiler/analysis/variable_table.h>
 
 #include <compiler/expression/array_element_expression.h>
 #include <compiler/expression/array_pair_expression.h>
@@ -93,6 +100,8 @@
 
 #include <iostream>
 #include <iomanip>
+#include <fstream>
+#include <sstream>
 #include <vector>
 #include <algorithm>
 
@@ -1084,6 +1093,19 @@ void MetaInfoBuilder::deleteInfo(Offset bcOffset) {
   m_metaMap.erase(bcOffset);
 }
 
+DataType MetaInfoBuilder::inferredDataType(Offset pos, int arg) const {
+  Map::const_iterator it = m_metaMap.find(pos);
+  if (it == m_metaMap.end()) return KindOfUnknown;
+  const Vec& info = it->second;
+  for (unsigned i = 0; i < info.size(); i++) {
+    if (info[i].m_kind == Unit::MetaInfo::DataTypeInferred &&
+        info[i].m_arg == arg) {
+      return (DataType)info[i].m_data;
+    }
+  }
+  return KindOfUnknown;
+}
+
 void MetaInfoBuilder::setForUnit(UnitEmitter& target) const {
   int entries = m_metaMap.size();
   if (!entries) return;
@@ -2186,6 +2208,8 @@ bool EmitterVisitor::visitImpl(ConstructPtr node) {
         } else {
           emitFreePendingIters(e);
           e.Null();
+          m_evalStack.setKnownType(KindOfNull);
+          m_evalStack.setNotRef();
         }
         if (r->isGuarded()) {
           m_metaInfo.add(m_ue.bcPos(), Unit::MetaInfo::GuardedThis,
@@ -5331,6 +5355,8 @@ void EmitterVisitor::emitPostponedMeths() {
         e.ContExit();
       } else {
         e.Null();
+        m_evalStack.setKnownType(KindOfNull);
+        m_evalStack.setNotRef();
         if ((p.m_meth->getStmts() && p.m_meth->getStmts()->isGuarded()) ||
             (fe->isClosureBody() && p.m_closureUseVars->size())) {
           m_metaInfo.add(m_ue.bcPos(), Unit::MetaInfo::GuardedThis,
@@ -6561,9 +6587,36 @@ void EmitterVisitor::finishFunc(Emitter& e, FuncEmitter* fe) {
   m_gotoLabels.clear();
   Offset past = e.getUnitEmitter().bcPos();
   fe->finish(past, false);
+  if (Option::WholeProgram && !fe->isPseudoMain()) {
+    fe->setReturnType(inferReturnType(fe->base(), past));
+  }
   e.getUnitEmitter().recordFunction(fe);
 }
 
+/*
+ * The type every RetC in [base, past) was inferred to return, or
+ * KindOfInvalid if the function can return by reference or any of its
+ * returns is of an unknown or different type.  It is stored in the repo
+ * as the Func's returnType(), where the JIT uses it to type the result of
+ * a bound call without a guard.
+ */
+DataType EmitterVisitor::inferReturnType(Offset base, Offset past) const {
+  DataType ret = KindOfInvalid;
+  const Opcode* bc = m_ue.bc();
+  for (Offset off = base; off < past; off += instrLen(bc + off)) {
+    if (bc[off] == OpRetV) return KindOfInvalid;
+    if (bc[off] != OpRetC) continue;
+    DataType dt = m_metaInfo.inferredDataType(off, 0);
+    if (dt == KindOfStaticString) dt = KindOfString;
+    if (dt == KindOfUnknown || dt == KindOfUninit ||
+        (ret != KindOfInvalid && dt != ret)) {
+      return KindOfInvalid;
+    }
+    ret = dt;
+  }
+  return ret;
+}
+
 StringData* EmitterVisitor::newClosureName() {
   std::ostringstream str;
   str << "closure$";
@@ -6692,8 +6745,131 @@ static ConstructPtr doOptimize(ConstructPtr c, AnalysisResultConstPtr ar) {
   return ConstructPtr();
 }
 
-static Unit* emitHHBCUnit(AnalysisResultPtr ar, FileScopePtr fsp,
-                          const MD5& md5, UnitOrigin unitOrigin, bool commit) {
+bool commitUnitBatch(const std::vector<UnitEmitter*>& batch,
+                     std::set<MD5>& committed) {
+  HPHP::VM::Repo& repo = HPHP::VM::Repo::get();
+  try {
+    // each unit's own transaction nests inside this one and swallows its
+    // errors, so check after every unit whether the batch is doomed
+    HPHP::VM::RepoTxn txn(repo);
+    for (unsigned int i = 0; i < batch.size(); i++) {
+      UnitEmitter* ue = batch[i];
+      if (!committed.insert(ue->md5()).second) {
+        // files with identical contents share one unit, whose md5 is
+        // unique in the repo; only the path needs recording
+        repo.commitMd5(UnitOriginFile, ue);
+      } else {
+        repo.commitUnit(ue, UnitOriginFile);
+      }
+      if (repo.rollbackPending()) {
+        Logger::Error("repo commit: unable to commit %s; rolling back its "
+                      "batch of %d units", ue->getFilepath()->data(),
+                      (int)batch.size());
+        return false;
+      }
+    }
+    txn.commit();
+  } catch (HPHP::VM::RepoExc& re) {
+    Logger::Error("repo commit: unable to commit %d units: %s",
+                  (int)batch.size(), re.msg().c_str());
+    return false;
+  }
+  return true;
+}
+
+/*
+ * Commits the units of an offline build on a single thread.  Each
+ * EmitterWorker would otherwise commit through its own SQLite connection,
+ * one transaction per unit, and the workers would spend the end of the
+ * build waiting on each other's database locks.  Instead the workers queue
+ * their UnitEmitters here and go on emitting; the commit thread writes
+ * them Option::HHBCCommitBatchSize at a time, each batch in one
+ * transaction.  enqueue() blocks while two batches are waiting, so
+ * memory stays bounded when the repo is the bottleneck.  Once a batch
+ * fails the rest are only thrown away, and finish() fails the build.
+ */
+class UnitCommitter : public Synchronizable {
+public:
+  explicit UnitCommitter(size_t batchSize)
+    : m_batchSize(batchSize), m_done(false), m_failed(false), m_units(0),
+      m_batches(0), m_commitUs(0), m_blockedUs(0),
+      m_thread(this, &UnitCommitter::run) {
+    m_thread.start();
+  }
+
+  // takes ownership of ue
+  void enqueue(UnitEmitter* ue) {
+    Lock lock(getMutex());
+    if (m_queue.size() >= 2 * m_batchSize) {
+      int64 start = Timer::GetCurrentTimeMicros();
+      do {
+        wait();
+      } while (m_queue.size() >= 2 * m_batchSize);
+      m_blockedUs += Timer::GetCurrentTimeMicros() - start;
+    }
+    m_queue.push_back(ue);
+    if (m_queue.size() >= m_batchSize) notifyAll();
+  }
+
+  // commits whatever is still queued and stops the commit thread; false
+  // if any unit could not be committed
+  bool finish() {
+    {
+      Lock lock(getMutex());
+      m_done = true;
+      notifyAll();
+    }
+    m_thread.waitForEnd();
+    Logger::Info("repo commit: %d units in %d transactions, %.2fs committing, "
+                 "emitters blocked %.2fs on a full queue",
+                 m_units, m_batches, m_commitUs / 1000000.0,
+                 m_blockedUs / 1000000.0);
+    return !m_failed;
+  }
+
+  void run() {
+    std::vector<UnitEmitter*> batch;
+    while (true) {
+      {
+        Lock lock(getMutex());
+        while (!m_done && m_queue.size() < m_batchSize) {
+          wait();
+        }
+        if (m_queue.empty()) break;
+        batch.swap(m_queue);
+        notifyAll();
+      }
+      if (!m_failed) {
+        int64 start = Timer::GetCurrentTimeMicros();
+        m_failed = !commitUnitBatch(batch, m_md5s);
+        m_commitUs += Timer::GetCurrentTimeMicros() - start;
+        m_units += batch.size();
+        m_batches++;
+      }
+      for (unsigned int i = 0; i < batch.size(); i++) {
+        delete batch[i];
+      }
+      batch.clear();
+    }
+  }
+
+private:
+  size_t m_batchSize;
+  bool m_done;
+  bool m_failed; // only touched by the commit thread
+  std::vector<UnitEmitter*> m_queue;
+  std::set<MD5> m_md5s;
+  int m_units;
+  int m_batches;
+  int64 m_commitUs;
+  int64 m_blockedUs;
+  AsyncFunc<UnitCommitter> m_thread;
+};
+
+static UnitCommitter* s_committer = NULL;
+
+static UnitEmitter* emitHHBCUnitEmitter(AnalysisResultPtr ar,
+                                        FileScopePtr fsp, const MD5& md5) {
   if (fsp->getPseudoMain() && !Option::WholeProgram) {
     ar->setPhase(AnalysisResult::FirstPreOptimize);
     doOptimize(fsp->getPseudoMain()->getStmt(), ar);
@@ -6726,7 +6902,18 @@ static Unit* emitHHBCUnit(AnalysisResultPtr ar, FileScopePtr fsp,
     FuncFinisher ff(&fev, emitter, ue->getMain());
     fev.emitMakeUnitFatal(emitter, ex.getMessage());
   }
+  return ue;
+}
 
+static Unit* emitHHBCUnit(AnalysisResultPtr ar, FileScopePtr fsp,
+                          const MD5& md5, UnitOrigin unitOrigin, bool commit) {
+  UnitEmitter* ue = emitHHBCUnitEmitter(ar, fsp, md5);
+  if (commit && s_committer) {
+    // the unit is only printed or thrown away, so it needs no repo id
+    Unit* unit = ue->create();
+    s_committer->enqueue(ue);
+    return unit;
+  }
   if (commit) {
     HPHP::VM::Repo::get().commitUnit(ue, unitOrigin);
   }
@@ -7014,11 +7201,223 @@ static Unit* emitHHBCNativeClassUnit(const HhbcExtClassInfo* builtinClasses,
   return unit;
 }
 
+/*
+ * Incremental builds.
+ *
+ * With Repo.BuildCache set, the repo from the previous build is attached as
+ * the central repo, and a file whose path and unit md5 (its content plus the
+ * options that affect emission) match what that build committed gets its
+ * UnitEmitter copied over instead of being emitted again.
+ *
+ * What whole-program analysis lets one unit know about another is limited
+ * to declarations: class shapes, function and method signatures with their
+ * inferred types, and constant values.  All of those are hashed into a
+ * program summary that is stored next to the cache; when it differs from
+ * the previous build's, nothing is reused.
+ */
+static bool s_useBuildCache = false;
+static int s_reusedUnits = 0;
+
+static void summarizeType(std::ostream& out, TypePtr type) {
+  if (type) out << ':' << type->toString();
+}
+
+static void summarizeFunction(std::ostream& out, FunctionScopePtr f) {
+  out << f->getOriginalName() << '(' << f->getMinParamCount();
+  for (int i = 0; i < f->getMaxParamCount(); i++) {
+    out << ' ' << (f->isRefParam(i) ? "&" : "") << f->getParamName(i);
+    summarizeType(out, f->getParamType(i));
+  }
+  out << ')' << (f->isRefReturn() ? "&" : "");
+  summarizeType(out, f->getReturnType());
+  out << '\n';
+}
+
+static void summarizeSymbols(std::ostream& out, SymbolTablePtr table) {
+  if (!table) return;
+  std::vector<Symbol*> syms;
+  table->getSymbols(syms);
+  std::vector<std::string> lines;
+  for (unsigned int i = 0; i < syms.size(); i++) {
+    Symbol* sym = syms[i];
+    std::ostringstream line;
+    line << (sym->isStatic() ? "static " : "")
+         << (sym->isPrivate() ? "private " :
+             sym->isProtected() ? "protected " : "")
+         << sym->getName();
+    summarizeType(line, sym->getFinalType());
+    if (sym->isConstant()) {
+      // constant values are folded into the units that use them
+      if (ConstructPtr value = sym->getValue()) {
+        line << '=' << value->getText();
+      }
+    }
+    lines.push_back(line.str());
+  }
+  std::sort(lines.begin(), lines.end());
+  for (unsigned int i = 0; i < lines.size(); i++) {
+    out << lines[i] << '\n';
+  }
+}
+
+static void summarizeClass(std::ostream& out, ClassScopePtr cls) {
+  out << "class " << cls->getOriginalName() << ' '
+      << (cls->isInterface() ? 'i' : cls->isAbstract() ? 'a' :
+          cls->isFinal() ? 'f' : 'c')
+      << " extends " << cls->getOriginalParent();
+  const std::vector<std::string>& bases = cls->getBases();
+  for (unsigned int i = 0; i < bases.size(); i++) {
+    out << ' ' << bases[i];
+  }
+  out << '\n';
+  const FunctionScopePtrVec& methods = cls->getFunctionsVec();
+  for (unsigned int i = 0; i < methods.size(); i++) {
+    FunctionScopePtr m = methods[i];
+    out << (m->isStatic() ? "static " : "")
+        << (m->isPrivate() ? "private " : m->isProtected() ? "protected " : "")
+        << (m->isAbstract() ? "abstract " : "")
+        << (m->isFinal() ? "final " : "");
+    summarizeFunction(out, m);
+  }
+  summarizeSymbols(out, cls->getConstants());
+  summarizeSymbols(out, cls->getVariables());
+}
+
+/*
+ * Hash of everything that can flow from one file into another file's
+ * bytecode, plus the compiler and the options that affect all units.
+ */
+static std::string programSummary(AnalysisResultPtr ar) {
+  std::ostringstream out;
+  out << HPHP::VM::Repo::kSchemaId << ' '
+      << Option::WholeProgram << Option::ParseTimeOpts
+      << Option::EnableHipHopSyntax << Option::JitEnableRenameFunction
+      << RuntimeOption::EnableEmitSwitch << '\n';
+
+  std::vector<FileScopePtr> files = ar->getAllFilesVector();
+  std::sort(files.begin(), files.end(), [](FileScopePtr a, FileScopePtr b) {
+    return a->getName() < b->getName();
+  });
+  for (unsigned int i = 0; i < files.size(); i++) {
+    FileScopePtr fs = files[i];
+    out << "file " << fs->getName() << '\n';
+
+    std::map<std::string, FunctionScopePtr> funcs(fs->getFunctions().begin(),
+                                                  fs->getFunctions().end());
+    for (std::map<std::string, FunctionScopePtr>::const_iterator it =
+           funcs.begin(); it != funcs.end(); ++it) {
+      if (!it->second->inPseudoMain()) {
+        summarizeFunction(out, it->second);
+      }
+    }
+    if (const StringToFunctionScopePtrVecMap* redec =
+        fs->getRedecFunctions()) {
+      std::map<std::string, FunctionScopePtrVec> sorted(redec->begin(),
+                                                        redec->end());
+      for (std::map<std::string, FunctionScopePtrVec>::const_iterator it =
+             sorted.begin(); it != sorted.end(); ++it) {
+        for (unsigned int j = 0; j < it->second.size(); j++) {
+          summarizeFunction(out, it->second[j]);
+        }
+      }
+    }
+
+    std::map<std::string, ClassScopePtrVec> classes(fs->getClasses().begin(),
+                                                    fs->getClasses().end());
+    for (std::map<std::string, ClassScopePtrVec>::const_iterator it =
+           classes.begin(); it != classes.end(); ++it) {
+      for (unsigned int j = 0; j < it->second.size(); j++) {
+        summarizeClass(out, it->second[j]);
+      }
+    }
+  }
+  out << "constants\n";
+  summarizeSymbols(out, ar->getConstants());
+
+  std::string text = out.str();
+  int len;
+  char* md5 = string_md5(text.c_str(), text.size(), false, len);
+  std::string ret(md5, len);
+  free(md5);
+  return ret;
+}
+
+static std::string buildCacheSummaryPath() {
+  return Option::HHBCBuildCache + ".summary";
+}
+
+static Unit* loadCachedUnit(FileScopeRawPtr fsp, const MD5& md5) {
+  HPHP::VM::Repo& repo = HPHP::VM::Repo::get();
+  MD5 cachedMd5;
+  if (!repo.getFileHash(RepoIdCentral).get(fsp->getName().c_str(),
+                                           cachedMd5) ||
+      cachedMd5 != md5) {
+    return NULL;
+  }
+  UnitEmitter* ue = new UnitEmitter(md5);
+  ue->setFilepath(StringData::GetStaticString(fsp->getName()));
+  if (!repo.urp().loadEmitter(*ue, RepoIdCentral)) {
+    delete ue;
+    return NULL;
+  }
+  atomic_inc(s_reusedUnits);
+  Unit* unit = ue->create();
+  if (Option::GenerateBinaryHHBC && s_committer) {
+    s_committer->enqueue(ue);
+    return unit;
+  }
+  if (Option::GenerateBinaryHHBC) {
+    repo.commitUnit(ue, UnitOriginFile);
+  }
+  delete ue;
+  return unit;
+}
+
+/*
+ * Makes this build's repo the cache for the next one.  The summary is
+ * removed first and written last, so a cache never pairs one build's units
+ * with another build's summary.
+ */
+static void saveBuildCache(const std::string& summary) {
+  if (!Option::GenerateBinaryHHBC) return;
+  std::string path = Option::HHBCBuildCache;
+  std::string tmp = path + ".tmp";
+  unlink(buildCacheSummaryPath().c_str());
+  {
+    std::ifstream in(RuntimeOption::RepoLocalPath.c_str(), std::ios::binary);
+    std::ofstream out(tmp.c_str(), std::ios::binary | std::ios::trunc);
+    out << in.rdbuf();
+    out.close();
+    if (!in || !out) {
+      Logger::Error("build cache: unable to copy %s to %s",
+                    RuntimeOption::RepoLocalPath.c_str(), tmp.c_str());
+      unlink(tmp.c_str());
+      return;
+    }
+  }
+  // replaces the attached central repo's file; the open handle keeps the
+  // old one until exit
+  if (rename(tmp.c_str(), path.c_str())) {
+    Logger::Error("build cache: unable to rename %s to %s",
+                  tmp.c_str(), path.c_str());
+    unlink(tmp.c_str());
+    return;
+  }
+  std::ofstream out(buildCacheSummaryPath().c_str());
+  out << summary << '\n';
+}
+
 static void emitHHBCVisitor(AnalysisResultPtr ar, FileScopeRawPtr fsp) {
   MD5 md5 = fsp->getMd5();
 
-  HPHP::VM::Unit* unit = emitHHBCUnit(ar, fsp, md5, UnitOriginFile,
-                                      Option::GenerateBinaryHHBC);
+  HPHP::VM::Unit* unit = NULL;
+  if (s_useBuildCache) {
+    unit = loadCachedUnit(fsp, md5);
+  }
+  if (!unit) {
+    unit = emitHHBCUnit(ar, fsp, md5, UnitOriginFile,
+                        Option::GenerateBinaryHHBC);
+  }
   if (unit == NULL) {
     return;
   }
@@ -7069,10 +7468,47 @@ static void addEmitterWorker(AnalysisResultPtr ar, StatementPtr sp,
     EmitterWorker>*)data)->enqueue(sp->getFileScope());
 }
 
+int filesByHotness(AnalysisResultPtr ar, std::vector<FileScopePtr>& files) {
+  std::set<FileScopePtr> seen;
+  for (unsigned int i = 0; i < Option::HotFiles.size(); i++) {
+    const std::string& name = Option::HotFiles[i];
+    FileScopePtr fs = ar->findFileScope(name);
+    for (size_t slash = name.find('/');
+         !fs && slash != std::string::npos;
+         slash = name.find('/', slash + 1)) {
+      fs = ar->findFileScope(name.substr(slash + 1));
+    }
+    if (fs && seen.insert(fs).second) files.push_back(fs);
+  }
+  int hot = files.size();
+  const std::vector<FileScopePtr>& all = ar->getAllFilesVector();
+  for (unsigned int i = 0; i < all.size(); i++) {
+    if (!seen.count(all[i])) files.push_back(all[i]);
+  }
+  return hot;
+}
+
+/*
+ * Hot files from the function profile as a Repo.Preload.FileList, so
+ * servers running the new repo load them before taking traffic.
+ */
+static void savePreloadList(const std::vector<FileScopePtr>& files, int hot) {
+  std::string path = RuntimeOption::RepoLocalPath + ".preload";
+  std::ofstream out(path.c_str(), std::ios::trunc);
+  for (int i = 0; i < hot; i++) {
+    out << files[i]->getName() << '\n';
+  }
+  out.close();
+  if (!out) {
+    Logger::Error("Unable to write the preload list %s", path.c_str());
+    unlink(path.c_str());
+  }
+}
+
 /**
  * This is the entry point for offline bytecode generation.
  */
-void emitAllHHBC(AnalysisResultPtr ar) {
+bool emitAllHHBC(AnalysisResultPtr ar) {
   unsigned int threadCount = Option::ParserThreadCount;
   unsigned int nFiles = ar->getAllFilesVector().size();
   if (threadCount > nFiles) {
@@ -7086,14 +7522,102 @@ void emitAllHHBC(AnalysisResultPtr ar) {
   /* same for TypeConstraint */
   TypeConstraint tc;
 
-  JobQueueDispatcher<EmitterWorker::JobType, EmitterWorker>
-    dispatcher(threadCount, true, 0, false, ar.get());
+  std::string summary;
+  if (!Option::HHBCBuildCache.empty()) {
+    summary = programSummary(ar);
+    std::string cached;
+    std::ifstream in(buildCacheSummaryPath().c_str());
+    in >> cached;
+    // line-only source locations come back from the repo, so reusing units
+    // would drop the column information RepoDebugInfo asks for
+    s_useBuildCache = !cached.empty() && cached == summary &&
+      !Option::RepoDebugInfo &&
+      HPHP::VM::Repo::get().repoName(RepoIdCentral) == Option::HHBCBuildCache;
+    if (!s_useBuildCache) {
+      Logger::Info("build cache: program summary changed, emitting all units");
+    }
+  }
+
+  if (Option::GenerateBinaryHHBC && Option::HHBCCommitBatchSize > 0) {
+    s_committer = new UnitCommitter(Option::HHBCCommitBatchSize);
+  }
+
+  {
+    JobQueueDispatcher<EmitterWorker::JobType, EmitterWorker>
+      dispatcher(threadCount, true, 0, false, ar.get());
+
+    Timer timer(Timer::WallTime, "emitting units");
+    dispatcher.start();
+    ar->visitFiles(addEmitterWorker, &dispatcher);
+    dispatcher.waitEmpty();
+  }
+
+  bool ret = true;
+  if (s_committer) {
+    Timer timer(Timer::WallTime, "draining the repo commit queue");
+    ret = s_committer->finish();
+    delete s_committer;
+    s_committer = NULL;
+  }
+
+  if (!Option::HHBCBuildCache.empty()) {
+    if (s_useBuildCache) {
+      Logger::Info("build cache: reused %d of %u units", s_reusedUnits, nFiles);
+    }
+    if (ret) {
+      // a later build must not reuse units this one failed to commit
+      Timer timer(Timer::WallTime, "saving the build cache");
+      saveBuildCache(summary);
+    }
+  }
+
+  if (!Option::GenerateBinaryHHBC || !ret) return ret;
 
-  dispatcher.start();
-  ar->visitFiles(addEmitterWorker, &dispatcher);
-  dispatcher.waitEmpty();
+  std::vector<FileScopePtr> all;
+  int hot = filesByHotness(ar, all);
+  if (!Option::HotFiles.empty()) {
+    Logger::Info("function profile: %d of %u files hot", hot, nFiles);
+    savePreloadList(all, hot);
+  }
+
+  if (Option::HHBCGenerateFlatRepo) {
+    Timer timer(Timer::WallTime, "writing the flat repo");
+    std::vector<std::pair<std::string, MD5> > files;
+    for (unsigned int i = 0; i < all.size(); i++) {
+      files.push_back(std::make_pair(all[i]->getName(), all[i]->getMd5()));
+    }
+    ret = HPHP::VM::FlatRepo::Write(RuntimeOption::RepoLocalPath + ".flat",
+                                    files);
+  }
+  return ret;
+}
+
+
+static FileScopePtr parseAndAnalyze(AnalysisResultPtr ar, const char* code,
+                                    int codeLen, const char* filename) {
+  Scanner scanner(code, codeLen, RuntimeOption::ScannerType, filename);
+  Parser parser(scanner, filename, ar, codeLen);
+  parser.parse();
+  FileScopePtr fsp = parser.getFileScope();
+  fsp->setOuterScope(ar);
+
+  ar->loadBuiltins();
+  ar->setPhase(AnalysisResult::AnalyzeAll);
+  fsp->analyzeProgram(ar);
+  return fsp;
 }
 
+UnitEmitter* hphp_compiler_emit(const char* code, int codeLen, const MD5& md5,
+                                const char* filename) {
+  try {
+    ScopeGuard sg(SymbolTable::Purge);
+    AnalysisResultPtr ar(new AnalysisResult());
+    FileScopePtr fsp = parseAndAnalyze(ar, code, codeLen, filename);
+    return emitHHBCUnitEmitter(ar, fsp, md5);
+  } catch (const std::exception&) {
+    return NULL;
+  }
+}
 
 /**
  * This is the entry point from the runtime; i.e. online bytecode generation.
@@ -7149,16 +7673,7 @@ Unit* hphp_compiler_parse(const char* code, int codeLen, const MD5& md5,
     }
 
     AnalysisResultPtr ar(new AnalysisResult());
-    Scanner scanner(code, codeLen, RuntimeOption::ScannerType, filename);
-    Parser parser(scanner, filename, ar, codeLen);
-    parser.parse();
-    FileScopePtr fsp = parser.getFileScope();
-    fsp->setOuterScope(ar);
-
-    ar->loadBuiltins();
-    ar->setPhase(AnalysisResult::AnalyzeAll);
-    fsp->analyzeProgram(ar);
-
+    FileScopePtr fsp = parseAndAnalyze(ar, code, codeLen, filename);
     return emitHHBCUnit(ar, fsp, md5, unitOrigin, RuntimeOption::RepoCommit);
   } catch (const std::exception&) {
     // extern "C" function should not be throwing exceptions...
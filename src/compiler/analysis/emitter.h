@@ -68,6 +68,7 @@ struct MetaInfoBuilder {
                         bool     mVector,
                         int      arg);
   void deleteInfo(Offset bcOffset);
+  DataType inferredDataType(Offset pos, int arg) const;
   void setForUnit(UnitEmitter&) const;
 
 private:
@@ -635,6 +636,7 @@ public:
   void copyOverFPIRegions(FuncEmitter* fe);
   void saveMaxStackCells(FuncEmitter* fe);
   void finishFunc(Emitter& e, FuncEmitter* fe);
+  DataType inferReturnType(Offset base, Offset past) const;
   StringData* newClosureName();
 
   void initScalar(TypedValue& tvVal, ExpressionPtr val);
@@ -645,7 +647,37 @@ public:
   void emitClassUseTrait(PreClassEmitter* pce, UseTraitStatementPtr useStmt);
 };
 
-void emitAllHHBC(AnalysisResultPtr ar);
+/**
+ * Returns false, having logged why, if the units could not all be
+ * committed to the repo.
+ */
+bool emitAllHHBC(AnalysisResultPtr ar);
+
+/**
+ * Commits batch to the repo in one transaction, the way the offline build
+ * does; units whose md5 is already in `committed' only get their path
+ * recorded.  Returns false, having logged the unit that failed, if any of
+ * it could not be committed, in which case none of it is.
+ */
+bool commitUnitBatch(const std::vector<UnitEmitter*>& batch,
+                     std::set<MD5>& committed);
+
+/**
+ * Appends the files in the function profile (Option::HotFiles), hottest
+ * first, then the rest in analysis order, and returns how many were in the
+ * profile.  Servers may report paths under a source root, so a profiled
+ * path that isn't a file here is retried with its leading directories
+ * stripped.
+ */
+int filesByHotness(AnalysisResultPtr ar, std::vector<FileScopePtr>& files);
+
+/**
+ * Compiles code to an emitter without creating or committing a unit, for
+ * tests of what gets serialized. hphp_compiler_parse(NULL, ...) must have
+ * run first. Returns NULL if the code can't be parsed.
+ */
+UnitEmitter* hphp_compiler_emit(const char* code, int codeLen, const MD5& md5,
+                                const char* filename);
 
 extern "C" {
   Unit* hphp_compiler_parse(const char* code, int codeLen, const MD5& md5,
@@ -26,6 +26,8 @@
 #include <util/process.h>
 #include <boost/algorithm/string/trim.hpp>
 #include <runtime/base/preg.h>
+#include <fstream>
+#include <algorithm>
 
 using namespace HPHP;
 
@@ -80,10 +82,20 @@ string Option::AutoloadRoot;
 
 map<string, string> Option::FunctionSections;
 
+std::string Option::FuncProfile;
+int Option::FuncProfileHotPercent = 90;
+int Option::FuncProfileInlineFactor = 4;
+set<string, stdltistr> Option::HotFunctions;
+vector<string> Option::HotFiles;
+
 bool Option::GenerateTextHHBC = false;
 bool Option::GenerateBinaryHHBC = false;
 string Option::RepoCentralPath;
 bool Option::RepoDebugInfo = false;
+string Option::HHBCBuildCache;
+bool Option::HHBCGenerateFlatRepo = false;
+int Option::HHBCCommitBatchSize = 256;
+string Option::HHBCRepoStagingDir;
 
 string Option::IdPrefix = "$$";
 string Option::LabelEscape = "$";
@@ -393,6 +405,11 @@ void Option::Load(Hdf &config) {
     }
   }
 
+  FuncProfile = config["FuncProfile"].getString();
+  FuncProfileHotPercent = config["FuncProfileHotPercent"].getInt32(90);
+  FuncProfileInlineFactor = config["FuncProfileInlineFactor"].getInt32(4);
+  if (!FuncProfile.empty()) LoadFuncProfile();
+
   {
     Hdf repo = config["Repo"];
     {
@@ -400,6 +417,10 @@ void Option::Load(Hdf &config) {
       RepoCentralPath = repoCentral["Path"].getString();
     }
     RepoDebugInfo = repo["DebugInfo"].getBool(false);
+    HHBCBuildCache = repo["BuildCache"].getString();
+    HHBCGenerateFlatRepo = repo["GenerateFlat"].getBool(false);
+    HHBCCommitBatchSize = repo["CommitBatchSize"].getInt32(256);
+    HHBCRepoStagingDir = repo["StagingDir"].getString();
   }
 
   {
@@ -494,6 +515,57 @@ void Option::Load() {
   OnLoad();
 }
 
+void Option::LoadFuncProfile() {
+  HotFunctions.clear();
+  HotFiles.clear();
+  std::ifstream in(FuncProfile.c_str());
+  if (!in) {
+    Logger::Error("Unable to read the function profile %s",
+                  FuncProfile.c_str());
+    return;
+  }
+
+  // calls <TAB> work <TAB> function <TAB> file, as written by the JIT
+  vector<std::pair<int64, string> > calls;
+  map<string, int64> fileWork;
+  int64 totalCalls = 0;
+  string line;
+  while (std::getline(in, line)) {
+    if (line.empty() || line[0] == '#') continue;
+    vector<string> fields;
+    Util::split('\t', line.c_str(), fields);
+    if (fields.size() != 4) continue;
+    int64 n = strtoll(fields[0].c_str(), NULL, 10);
+    if (n > 0 && !fields[2].empty()) {
+      calls.push_back(std::make_pair(n, fields[2]));
+      totalCalls += n;
+    }
+    fileWork[fields[3]] += strtoll(fields[1].c_str(), NULL, 10);
+  }
+
+  std::sort(calls.rbegin(), calls.rend());
+  int64 covered = 0;
+  for (unsigned int i = 0; i < calls.size() &&
+         covered * 100 < totalCalls * FuncProfileHotPercent; i++) {
+    HotFunctions.insert(calls[i].second);
+    covered += calls[i].first;
+  }
+
+  vector<std::pair<int64, string> > files;
+  for (map<string, int64>::const_iterator it = fileWork.begin();
+       it != fileWork.end(); ++it) {
+    files.push_back(std::make_pair(it->second, it->first));
+  }
+  std::sort(files.rbegin(), files.rend());
+  for (unsigned int i = 0; i < files.size(); i++) {
+    HotFiles.push_back(files[i].second);
+  }
+
+  Logger::Info("function profile: %d of %d functions hot, %d files",
+               (int)HotFunctions.size(), (int)calls.size(),
+               (int)HotFiles.size());
+}
+
 void Option::OnLoad() {
   // all lambda functions are dynamic automatically
   DynamicFunctionPrefixes.push_back(LambdaPrefix);
@@ -508,6 +580,13 @@ bool Option::IsDynamicFunction(bool method, const std::string &name) {
   return IsDynamic(name, DynamicFunctionPrefixes, DynamicFunctionPostfixes);
 }
 
+int Option::InlineLimit(int limit, const std::string &name) {
+  if (limit > 0 && HotFunctions.find(name) != HotFunctions.end()) {
+    return limit * FuncProfileInlineFactor;
+  }
+  return limit;
+}
+
 bool Option::IsDynamicClass(const std::string &name) {
   return IsDynamic(name, DynamicClassPrefixes, DynamicClassPostfixes);
 }
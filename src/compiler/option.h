@@ -190,12 +190,37 @@ public:
   static bool GenerateBinaryHHBC;
   static std::string RepoCentralPath;
   static bool RepoDebugInfo;
+  // previous build's repo; units of unchanged files are copied from it
+  static std::string HHBCBuildCache;
+  // also write the repo as <repo>.flat for VM::FlatRepo
+  static bool HHBCGenerateFlatRepo;
+  // units per repo transaction; 0 commits each unit on its emitter thread
+  static int HHBCCommitBatchSize;
+  // build the repo here (e.g. on tmpfs) and copy it to the output at the end
+  static std::string HHBCRepoStagingDir;
 
   /**
    * Names of hot and cold functions to be marked in sources.
    */
   static std::map<std::string, std::string> FunctionSections;
 
+  /**
+   * Production profile written by servers with Eval.JitFuncProfile.  The
+   * most called functions that together take FuncProfileHotPercent of all
+   * calls are hot; HotFiles lists the profiled files, hottest first.
+   */
+  static std::string FuncProfile;
+  static int FuncProfileHotPercent;
+  static int FuncProfileInlineFactor;
+  static std::set<std::string, stdltistr> HotFunctions;
+  static std::vector<std::string> HotFiles;
+
+  /**
+   * Reads FuncProfile into HotFunctions and HotFiles.  Malformed lines and
+   * comments are skipped.
+   */
+  static void LoadFuncProfile();
+
   /**
    * A somewhat unique prefix for system identifiers.
    */
@@ -306,6 +331,12 @@ public:
   static bool IsDynamicFunction(bool method, const std::string &name);
   static bool IsDynamicClass(const std::string &name);
 
+  /**
+   * Inlining size limit for a function: limit itself, or limit times
+   * FuncProfileInlineFactor when the function profile marks name hot.
+   */
+  static int InlineLimit(int limit, const std::string &name);
+
   /**
    * Whether or not name matches AUTOLOAD files. If not, returns empty. If
    * yes, returns root directory for the file.
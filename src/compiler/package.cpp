@@ -197,12 +197,15 @@ class ParserWorker :
     public JobQueueWorker<std::pair<const char *,bool>, true, true> {
 public:
   bool m_ret;
+  std::vector<Package::ParsedFile> m_parsed;
   ParserWorker() : m_ret(true) {}
   virtual void doJob(JobType job) {
     bool ret;
     try {
       Package *package = (Package*)m_opaque;
-      ret = package->parseImpl(job.first);
+      Package::ParsedFile parsed;
+      ret = package->parseImpl(job.first, parsed);
+      if (ret) m_parsed.push_back(parsed);
     } catch (Exception &e) {
       Logger::Error("%s", e.getMessage().c_str());
       ret = false;
@@ -260,12 +263,16 @@ bool Package::parse(bool check) {
 
   std::vector<ParserWorker*> workers;
   dispatcher.getWorkers(workers);
+  bool ret = true;
   for (unsigned int i = 0; i < workers.size(); i++) {
     ParserWorker *worker = workers[i];
-    if (!worker->m_ret) return false;
+    for (unsigned int j = 0; j < worker->m_parsed.size(); j++) {
+      addParsedFile(worker->m_parsed[j]);
+    }
+    if (!worker->m_ret) ret = false;
   }
 
-  return true;
+  return ret;
 }
 
 bool Package::parse(const char *fileName) {
@@ -273,6 +280,28 @@ bool Package::parse(const char *fileName) {
 }
 
 bool Package::parseImpl(const char *fileName) {
+  ParsedFile parsed;
+  if (!parseImpl(fileName, parsed)) return false;
+  addParsedFile(parsed);
+  return true;
+}
+
+void Package::addParsedFile(const ParsedFile &parsed) {
+  Lock lock(m_mutex);
+  m_lineCount += parsed.lines;
+  m_charCount += parsed.chars;
+  const char *fileName = parsed.fileName;
+  if (m_extraStaticFiles.find(fileName) == m_extraStaticFiles.end() &&
+      m_discoveredStaticFiles.find(fileName) == m_discoveredStaticFiles.end()) {
+    if (Option::CachePHPFile) {
+      m_discoveredStaticFiles[fileName] = parsed.fullPath;
+    } else {
+      m_discoveredStaticFiles[fileName] = "";
+    }
+  }
+}
+
+bool Package::parseImpl(const char *fileName, ParsedFile &parsed) {
   ASSERT(fileName);
   if (fileName[0] == 0) return false;
 
@@ -307,20 +336,10 @@ bool Package::parseImpl(const char *fileName) {
     return false;
   }
 
-  m_lineCount += lines;
-  struct stat fst;
-  stat(fullPath.c_str(), &fst);
-  m_charCount += fst.st_size;
-
-  Lock lock(m_mutex);
-  if (m_extraStaticFiles.find(fileName) == m_extraStaticFiles.end() &&
-      m_discoveredStaticFiles.find(fileName) == m_discoveredStaticFiles.end()) {
-    if (Option::CachePHPFile) {
-      m_discoveredStaticFiles[fileName] = fullPath;
-    } else {
-      m_discoveredStaticFiles[fileName] = "";
-    }
-  }
+  parsed.fileName = fileName;
+  parsed.fullPath = fullPath;
+  parsed.lines = lines;
+  parsed.chars = sb.st_size;
   return true;
 }
 
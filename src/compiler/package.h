@@ -49,9 +49,22 @@ public:
   void addStaticDirectory(const std::string path);
   void addPHPDirectory(const char *path, bool force);
 
+  /**
+   * What parsing one file adds to the package besides its FileScope.
+   * Parser threads keep these to themselves and Package::parse() merges
+   * them once all files are parsed.
+   */
+  struct ParsedFile {
+    const char *fileName;
+    std::string fullPath;
+    int lines;
+    int chars;
+  };
+
   bool parse(bool check);
   bool parse(const char *fileName);
   bool parseImpl(const char *fileName);
+  bool parseImpl(const char *fileName, ParsedFile &parsed);
 
   AnalysisResultPtr getAnalysisResult() { return m_ar;}
   int getFileCount() const { return m_files.size();}
@@ -68,6 +81,8 @@ public:
   FileCachePtr getFileCache();
 
 private:
+  void addParsedFile(const ParsedFile &parsed);
+
   std::string m_root;
   bool m_bShortTags;
   bool m_bAspTags;
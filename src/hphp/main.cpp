@@ -45,6 +45,7 @@
 #include <runtime/vm/repo.h>
 #include <sys/types.h>
 #include <sys/wait.h>
+#include <fcntl.h>
 #include <dlfcn.h>
 #include <system/lib/systemlib.h>
 
@@ -861,6 +862,40 @@ int phpTarget(const ProgramOptions &po, AnalysisResultPtr ar) {
 
 ///////////////////////////////////////////////////////////////////////////////
 
+/*
+ * Copies a file written under Repo.StagingDir to its place in the output
+ * directory and syncs it; in that mode this is the only fsync the repo gets.
+ * The copy goes to a temporary file that is renamed over the destination,
+ * so a failed copy leaves the previous file in place.
+ */
+static bool installStagedFile(const string &from, const string &to) {
+  int in = open(from.c_str(), O_RDONLY);
+  if (in < 0) return false;
+  string tmp = to + ".tmp";
+  int out = open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  bool ok = out >= 0;
+  char buf[1 << 16];
+  while (ok) {
+    ssize_t n = read(in, buf, sizeof(buf));
+    if (n <= 0) {
+      ok = n == 0;
+      break;
+    }
+    for (ssize_t done = 0; ok && done < n; ) {
+      ssize_t w = write(out, buf + done, n - done);
+      ok = w > 0;
+      done += w;
+    }
+  }
+  ok = ok && fsync(out) == 0;
+  if (out >= 0 && close(out)) ok = false;
+  close(in);
+  ok = ok && rename(tmp.c_str(), to.c_str()) == 0;
+  if (!ok) unlink(tmp.c_str());
+  unlink(from.c_str());
+  return ok;
+}
+
 int hhbcTarget(const ProgramOptions &po, AnalysisResultPtr ar,
                AsyncFileCacheSaver &fcThread) {
   int ret = 0;
@@ -875,6 +910,10 @@ int hhbcTarget(const ProgramOptions &po, AnalysisResultPtr ar,
   RuntimeOption::RepoLocalMode = "rw";
   RuntimeOption::RepoDebugInfo = Option::RepoDebugInfo;
   RuntimeOption::RepoJournal = "memory";
+  if (!Option::HHBCBuildCache.empty()) {
+    // the previous build's units are looked up in the central repo
+    RuntimeOption::RepoCentralPath = Option::HHBCBuildCache;
+  }
 
   int formatCount = 0;
   const char *type = 0;
@@ -894,6 +933,15 @@ int hhbcTarget(const ProgramOptions &po, AnalysisResultPtr ar,
     return 1;
   }
 
+  string repoPath = RuntimeOption::RepoLocalPath;
+  bool staged = Option::GenerateBinaryHHBC &&
+    !Option::HHBCRepoStagingDir.empty();
+  if (staged) {
+    RuntimeOption::RepoLocalPath =
+      Option::HHBCRepoStagingDir + '/' + po.program;
+    unlink(RuntimeOption::RepoLocalPath.c_str());
+  }
+
   /* without this, emitClass allows classes with interfaces to be
      hoistable */
   SystemLib::s_inited = true;
@@ -905,7 +953,30 @@ int hhbcTarget(const ProgramOptions &po, AnalysisResultPtr ar,
   }
 
   Timer timer(Timer::WallTime, type);
-  Compiler::emitAllHHBC(ar);
+  bool emitted = Compiler::emitAllHHBC(ar);
+  if (!emitted) {
+    Logger::Error("Unable to write the repo");
+    ret = 1;
+  }
+
+  if (staged && !emitted) {
+    unlink(RuntimeOption::RepoLocalPath.c_str());
+    RuntimeOption::RepoLocalPath = repoPath;
+  } else if (staged) {
+    Timer installTimer(Timer::WallTime, "installing the staged repo");
+    if (!installStagedFile(RuntimeOption::RepoLocalPath, repoPath) ||
+        (Option::HHBCGenerateFlatRepo &&
+         !installStagedFile(RuntimeOption::RepoLocalPath + ".flat",
+                            repoPath + ".flat")) ||
+        (!Option::HotFiles.empty() &&
+         !installStagedFile(RuntimeOption::RepoLocalPath + ".preload",
+                            repoPath + ".preload"))) {
+      Logger::Error("Unable to copy the repo from %s to %s",
+                    Option::HHBCRepoStagingDir.c_str(), repoPath.c_str());
+      ret = 1;
+    }
+    RuntimeOption::RepoLocalPath = repoPath;
+  }
 
   if (!po.syncDir.empty()) {
     if (!po.filecache.empty()) {
@@ -404,6 +404,30 @@ DefineFunction(
     'taint_observer' => false,
   ));
 
+DefineFunction(
+  array(
+    'name'   => "curl_multi_await",
+    'desc'   => "Runs the transfers of a cURL multi handle until at least one of them finishes, sleeping on the connections' sockets in between instead of polling. Unlike curl_multi_select(), there is no limit on how many connections it can wait on. Read the finished transfers with curl_multi_info_read().",
+    'flags'  =>  HasDocComment | HipHopSpecific,
+    'return' => array(
+      'type'   => Int64,
+      'desc'   => "The number of finished transfers curl_multi_info_read() will return, 0 when the timeout passed or nothing is running, or -1 on failure.",
+    ),
+    'args'   => array(
+      array(
+        'name'   => "mh",
+        'type'   => Resource,
+        'desc'   => "A cURL multi handle returned by curl_multi_init().",
+      ),
+      array(
+        'name'   => "timeout",
+        'type'   => Double,
+        'value'  => "1.0",
+        'desc'   => "Time, in seconds, to wait for a transfer to finish.",
+      ),
+    ),
+  ));
+
 DefineFunction(
   array(
     'name'   => "fb_curl_multi_fdset",
@@ -142,6 +142,30 @@ DefineFunction(
     ),
   ));
 
+DefineFunction(
+  array(
+    'name'   => "json_encode_to_output",
+    'desc'   => "Writes the JSON representation of value to the output, like echo json_encode(value) but without building the whole document in memory first: it is written out in chunks as it is encoded. There is no size limit, as if JSON_FB_UNLIMITED were given.",
+    'flags'  =>  HasDocComment | HipHopSpecific,
+    'return' => array(
+      'type'   => null,
+      'desc'   => "",
+    ),
+    'args'   => array(
+      array(
+        'name'   => "value",
+        'type'   => Variant,
+        'desc'   => "The value being encoded. Can be any type except a resource.",
+      ),
+      array(
+        'name'   => "options",
+        'type'   => Variant,
+        'value'  => "0",
+        'desc'   => "Same options as json_encode().",
+      ),
+    ),
+  ));
+
 DefineFunction(
   array(
     'name'   => "json_decode",
@@ -273,6 +273,29 @@ DefineFunction(
     ),
   ));
 
+DefineFunction(
+  array(
+    'name'   => "memcache_defer_get",
+    'desc'   => "Queues a key, or an array of keys, to be fetched later. Nothing is sent until the next Memcache::get() on the same connection, which fetches its own keys together with everything queued in one multiget, so a page can declare the keys it needs as it goes and pay for one round trip. Values fetched this way are kept for the rest of the request, or until a write through the same connection touches them.",
+    'flags'  =>  HasDocComment | HipHopSpecific,
+    'return' => array(
+      'type'   => Boolean,
+      'desc'   => "TRUE if at least one key was queued, FALSE if all keys were empty.",
+    ),
+    'args'   => array(
+      array(
+        'name'   => "memcache",
+        'type'   => Object,
+        'desc'   => "The Memcache connection.",
+      ),
+      array(
+        'name'   => "key",
+        'type'   => Variant,
+        'desc'   => "The key or array of keys to queue.",
+      ),
+    ),
+  ));
+
 DefineFunction(
   array(
     'name'   => "memcache_delete",
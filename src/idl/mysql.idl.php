@@ -862,6 +862,79 @@ DefineFunction(
     'taint_observer' => false,
   ));
 
+DefineFunction(
+  array(
+    'name'   => "mysql_async_query",
+    'desc'   => "Sends a query without waiting for its result, so that queries on several connections can run at the same time. Only one query can be outstanding per connection. Collect the result with mysql_async_result(), after mysql_async_wait() reports the connection ready.",
+    'flags'  =>  HasDocComment | HipHopSpecific,
+    'return' => array(
+      'type'   => Boolean,
+      'desc'   => "TRUE if the query was sent, FALSE otherwise.",
+    ),
+    'args'   => array(
+      array(
+        'name'   => "query",
+        'type'   => String,
+        'desc'   => "The SQL query to send.",
+      ),
+      array(
+        'name'   => "link_identifier",
+        'type'   => Variant,
+        'value'  => "null",
+        'desc'   => "The MySQL connection. If the link identifier is not specified, the last link opened by mysql_connect() is assumed.",
+      ),
+    ),
+  ));
+
+DefineFunction(
+  array(
+    'name'   => "mysql_async_wait",
+    'desc'   => "Waits until at least one of the given connections has the result of its mysql_async_query() ready to read.",
+    'flags'  =>  HasDocComment | HipHopSpecific,
+    'return' => array(
+      'type'   => Variant,
+      'desc'   => "Keys of the connections in links that are ready, which is empty when the timeout expired, or FALSE on error.",
+    ),
+    'args'   => array(
+      array(
+        'name'   => "links",
+        'type'   => VariantMap,
+        'desc'   => "MySQL connections with a query outstanding. Connections without one are ignored.",
+      ),
+      array(
+        'name'   => "timeout_ms",
+        'type'   => Int32,
+        'value'  => "-1",
+        'desc'   => "How long to wait, in milliseconds. A negative value waits for as long as the read timeout of mysql_set_timeout().",
+      ),
+    ),
+  ));
+
+DefineFunction(
+  array(
+    'name'   => "mysql_async_result",
+    'desc'   => "Reads the result of the query sent by mysql_async_query() on a connection. This blocks until the query completes, unless mysql_async_wait() has reported the connection ready.",
+    'flags'  =>  HasDocComment | HipHopSpecific,
+    'return' => array(
+      'type'   => Variant,
+      'desc'   => "The same as mysql_query() or mysql_unbuffered_query() would have returned for the query.",
+    ),
+    'args'   => array(
+      array(
+        'name'   => "link_identifier",
+        'type'   => Variant,
+        'value'  => "null",
+        'desc'   => "The MySQL connection. If the link identifier is not specified, the last link opened by mysql_connect() is assumed.",
+      ),
+      array(
+        'name'   => "buffered",
+        'type'   => Boolean,
+        'value'  => "true",
+        'desc'   => "Whether to read all rows now like mysql_query(). When FALSE, rows are read from the connection as they are fetched, like mysql_unbuffered_query().",
+      ),
+    ),
+  ));
+
 DefineFunction(
   array(
     'name'   => "mysql_db_query",
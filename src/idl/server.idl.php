@@ -195,6 +195,48 @@ DefineFunction(
     ),
   ));
 
+DefineFunction(
+  array(
+    'name'   => "pagelet_server_task_start_batch",
+    'desc'   => "Processes a batch of pagelet server requests. Requests are grouped into worker jobs of up to PageletServer.BatchSize requests each, so a page that fans out into many small pagelets doesn't pay for a separate job per pagelet.",
+    'flags'  =>  HasDocComment | HipHopSpecific,
+    'return' => array(
+      'type'   => VariantMap,
+      'desc'   => "Task handles keyed the same way as requests, each of which can be used with pagelet_server_task_status(), pagelet_server_task_result() or pagelet_server_task_select(). An empty array is returned if pagelet server is not enabled or its queue is full.",
+    ),
+    'args'   => array(
+      array(
+        'name'   => "requests",
+        'type'   => VariantMap,
+        'desc'   => "Each element is an array with \"url\", \"headers\", \"post_data\" and \"files\" entries, with the same meaning as the parameters of pagelet_server_task_start().",
+      ),
+    ),
+  ));
+
+DefineFunction(
+  array(
+    'name'   => "pagelet_server_task_select",
+    'desc'   => "Block and wait until at least one of the pagelet tasks has (partial) data available or is done, or until timeout.",
+    'flags'  =>  HasDocComment | HipHopSpecific,
+    'return' => array(
+      'type'   => VariantVec,
+      'desc'   => "Keys of the tasks that are ready to be read with pagelet_server_task_result(). An empty array is returned on timeout.",
+    ),
+    'args'   => array(
+      array(
+        'name'   => "tasks",
+        'type'   => VariantMap,
+        'desc'   => "Pagelet task handles returned from pagelet_server_task_start() or pagelet_server_task_start_batch().",
+      ),
+      array(
+        'name'   => "timeout_ms",
+        'type'   => Int64,
+        'value'  => "0",
+        'desc'   => "How many milliseconds to wait. A timeout of zero is interpreted as an infinite timeout.",
+      ),
+    ),
+  ));
+
 DefineFunction(
   array(
     'name'   => "pagelet_server_flush",
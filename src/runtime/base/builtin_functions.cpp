@@ -36,6 +36,7 @@
 #include <util/util.h>
 #include <util/process.h>
 #include <runtime/vm/repo.h>
+#include <runtime/vm/autoload_index.h>
 #include <runtime/vm/translator/translator.h>
 #include <runtime/vm/translator/translator-inline.h>
 #include <runtime/vm/unit.h>
@@ -1868,6 +1869,42 @@ class ConstantExistsChecker {
   }
 };
 
+static bool autoload_include(CStrRef fName) {
+  try {
+    if (hhvm) {
+      VM::Transl::VMRegAnchor _;
+      bool initial;
+      VMExecutionContext* ec = g_vmContext;
+      VM::Unit* u = ec->evalInclude(fName.get(), NULL, &initial);
+      if (u) {
+        if (initial) {
+          TypedValue retval;
+          ec->invokeFunc(&retval, u->getMain(), Array(),
+                         NULL, NULL, NULL, NULL, u);
+          tvRefcountedDecRef(&retval);
+        }
+        return true;
+      }
+      return false;
+    }
+    return include(fName, true, lvar_ptr(LVariableTable()), NULL, false);
+  } catch (...) {}
+  return false;
+}
+
+/*
+ * Includes the file the native autoload index has for `name', if any.
+ * A stale or ambiguous entry falls through to the map and the handlers.
+ */
+template <class T>
+static bool load_from_index(CStrRef name, VM::Repo::AutoloadKind kind,
+                            const T &checkExists) {
+  if (!hhvm || !VM::AutoloadIndex::Enabled()) return false;
+  const StringData* path = VM::AutoloadIndex::Lookup(kind, name.get());
+  return path && autoload_include(StrNR(const_cast<StringData*>(path))) &&
+    checkExists(name);
+}
+
 template <class T>
 AutoloadHandler::Result AutoloadHandler::loadFromMap(CStrRef name,
                                                      CStrRef kind,
@@ -1888,26 +1925,7 @@ AutoloadHandler::Result AutoloadHandler::loadFromMap(CStrRef name,
           fName = m_map_root + fName;
         }
       }
-      try {
-        if (hhvm) {
-          VM::Transl::VMRegAnchor _;
-          bool initial;
-          VMExecutionContext* ec = g_vmContext;
-          VM::Unit* u = ec->evalInclude(fName.get(), NULL, &initial);
-          if (u) {
-            if (initial) {
-              TypedValue retval;
-              ec->invokeFunc(&retval, u->getMain(), Array(),
-                             NULL, NULL, NULL, NULL, u);
-              tvRefcountedDecRef(&retval);
-            }
-            ok = true;
-          }
-        } else {
-          ok = include(fName, true,
-                       lvar_ptr(LVariableTable()), NULL, false);
-        }
-      } catch (...) {}
+      ok = autoload_include(fName);
     }
     if (ok && checkExists(name)) {
       return Success;
@@ -1929,11 +1947,18 @@ AutoloadHandler::Result AutoloadHandler::loadFromMap(CStrRef name,
 }
 
 bool AutoloadHandler::autoloadFunc(CStrRef name) {
+  if (load_from_index(name, VM::Repo::AutoloadFunction, function_exists)) {
+    return true;
+  }
   return !m_map.isNull() &&
     loadFromMap(name, s_function, true, function_exists) != Failure;
 }
 
 bool AutoloadHandler::autoloadConstant(CStrRef name) {
+  if (load_from_index(name, VM::Repo::AutoloadConstant,
+                      ConstantExistsChecker())) {
+    return true;
+  }
   return !m_map.isNull() &&
     loadFromMap(name, s_constant, false, ConstantExistsChecker()) != Failure;
 }
@@ -1946,6 +1971,10 @@ bool AutoloadHandler::autoloadConstant(CStrRef name) {
 bool AutoloadHandler::invokeHandler(CStrRef className,
                                     const bool *declared /* = NULL */,
                                     bool forceSplStack /* = false */) {
+  if (load_from_index(className, VM::Repo::AutoloadClass,
+                      ClassExistsChecker(declared))) {
+    return true;
+  }
   if (!m_map.isNull()) {
     ClassExistsChecker ce(declared);
     Result res = loadFromMap(className, s_class, true, ce);
@@ -73,9 +73,13 @@ BaseExecutionContext::BaseExecutionContext() :
 
   setRequestMemoryMaxBytes(RuntimeOption::RequestMemoryMaxBytes);
   m_include_paths = Array::Create();
+  StringBuffer sb;
   for (unsigned int i = 0; i < RuntimeOption::IncludeSearchPaths.size(); ++i) {
     m_include_paths.append(String(RuntimeOption::IncludeSearchPaths[i]));
+    if (i) sb.append(':');
+    sb.append(RuntimeOption::IncludeSearchPaths[i]);
   }
+  m_include_path = sb.detach();
 }
 
 VMExecutionContext::VMExecutionContext() :
@@ -831,20 +835,7 @@ String BaseExecutionContext::getenv(CStrRef name) const {
 
 void BaseExecutionContext::setIncludePath(CStrRef path) {
   m_include_paths = f_explode(":", path);
-}
-
-String BaseExecutionContext::getIncludePath() const {
-  StringBuffer sb;
-  bool first = true;
-  for (ArrayIter iter(m_include_paths); iter; ++iter) {
-    if (first) {
-      first = false;
-    } else {
-      sb.append(':');
-    }
-    sb.append(iter.second().toString());
-  }
-  return sb.detach();
+  m_include_path = path;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
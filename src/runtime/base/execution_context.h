@@ -341,7 +341,7 @@ public:
   Variant getExitCallback() { return m_exitCallback; }
 
   void setIncludePath(CStrRef path);
-  String getIncludePath() const;
+  String getIncludePath() const { return m_include_path; }
   Array getIncludePathArray() const { return m_include_paths; }
   const VirtualHost *getVirtualHost() const { return m_vhost; }
   void setVirtualHost(const VirtualHost *vhost) { m_vhost = vhost; }
@@ -404,8 +404,9 @@ private:
 
   Variant m_exitCallback;
 
-  // include_path configuration option
+  // include_path configuration option, split and as set
   Array m_include_paths;
+  String m_include_path;
 
   // cache the sandbox id for the request
   String m_sandboxId;
@@ -265,6 +265,10 @@ bool IniSetting::Get(CStrRef name, String &value) {
     value = String((int64)RuntimeOption::WarningFrequency);
     return true;
   }
+  if (name == "hphp.fb_compact_serialize_version") {
+    value = String((int64)RuntimeOption::FbCompactSerializeVersion);
+    return true;
+  }
   if (name == "include_path") {
     value = g_context->getIncludePath();
     return true;
@@ -321,6 +325,11 @@ bool IniSetting::Set(CStrRef name, CStrRef value) {
   } else if (name == "warning_frequency") {
     RuntimeOption::WarningFrequency = value.toInt64();
     return true;
+  } else if (name == "hphp.fb_compact_serialize_version") {
+    int version = value.toInt32();
+    if (version != 1 && version != 2) return false;
+    RuntimeOption::FbCompactSerializeVersion = version;
+    return true;
   } else if (name == "include_path") {
     g_context->setIncludePath(value);
     return true;
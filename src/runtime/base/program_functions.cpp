@@ -65,6 +65,8 @@
 
 #include <runtime/vm/runtime.h>
 #include <runtime/vm/repo.h>
+#include <runtime/vm/flat_repo.h>
+#include <runtime/vm/autoload_index.h>
 #include <runtime/vm/translator/translator.h>
 #include <compiler/builtin_symbols.h>
 
@@ -629,6 +631,18 @@ static int start_server(const std::string &username) {
   // initialize the process
   HttpServer::Server = HttpServerPtr(new HttpServer(sslCTX));
 
+  // Pull runtime state from the server we are about to take over, so APC
+  // and loaded files are warm and its warmup requests get replayed too
+  if (!RuntimeOption::TakeoverFilename.empty() &&
+      RuntimeOption::TakeoverStateTimeout > 0) {
+    LibEventServerWithTakeover::RequestState(
+      RuntimeOption::TakeoverFilename, RuntimeOption::TakeoverStateTimeout);
+  }
+
+  if (hhvm) {
+    HPHP::Eval::FileRepository::preloadRepo();
+  }
+
   // If we have any warmup requests, replay them before listening for
   // real connections
   for (auto& file : RuntimeOption::ServerWarmupRequests) {
@@ -1185,7 +1199,9 @@ void hphp_process_init() {
   if (hhvm) {
     extern void sys_init_literal_varstrings();
     sys_init_literal_varstrings();
+    VM::FlatRepo::Init();
     g_vmProcessInit();
+    VM::AutoloadIndex::Init();
   } else {
     init_literal_varstrings();
   }
@@ -111,6 +111,7 @@ bool RuntimeOption::PageletServerThreadRoundRobin = false;
 int RuntimeOption::PageletServerThreadDropCacheTimeoutSeconds = 0;
 int RuntimeOption::PageletServerQueueLimit = 0;
 bool RuntimeOption::PageletServerThreadDropStack = false;
+int RuntimeOption::PageletServerBatchSize = 8;
 int RuntimeOption::FiberCount = 1;
 int RuntimeOption::RequestTimeoutSeconds = 0;
 size_t RuntimeOption::ServerMemoryHeadRoom = 0;
@@ -181,6 +182,8 @@ std::string RuntimeOption::XboxServerInfoReqInitDoc;
 bool RuntimeOption::XboxServerInfoAlwaysReset = false;
 bool RuntimeOption::XboxServerLogInfo = false;
 std::string RuntimeOption::XboxProcessMessageFunc = "xbox_process_message";
+int RuntimeOption::XboxConnectionPoolSize = 0;
+int RuntimeOption::XboxConnectionPoolMaxInFlight = 0;
 std::string RuntimeOption::XboxPassword;
 std::set<std::string> RuntimeOption::XboxPasswords;
 
@@ -197,6 +200,7 @@ bool RuntimeOption::EnableStaticContentCache = true;
 bool RuntimeOption::EnableStaticContentFromDisk = true;
 bool RuntimeOption::EnableOnDemandUncompress = true;
 bool RuntimeOption::EnableStaticContentMMap = true;
+int64 RuntimeOption::PageCacheMaxMemory = 64 * 1024 * 1024;
 
 std::string RuntimeOption::RTTIDirectory;
 bool RuntimeOption::EnableCliRTTI = false;
@@ -222,6 +226,7 @@ bool RuntimeOption::WhitelistExecWarningOnly = false;
 std::vector<std::string> RuntimeOption::AllowedExecCmds;
 
 std::string RuntimeOption::TakeoverFilename;
+int RuntimeOption::TakeoverStateTimeout = 0;
 int RuntimeOption::AdminServerPort;
 int RuntimeOption::AdminThreadCount = 1;
 std::string RuntimeOption::AdminPassword;
@@ -236,6 +241,8 @@ int RuntimeOption::ProxyPercentage = 0;
 std::set<std::string> RuntimeOption::ProxyURLs;
 std::vector<std::string> RuntimeOption::ProxyPatterns;
 bool RuntimeOption::AlwaysUseRelativePath = false;
+int RuntimeOption::IncludeResolveCacheSize = 0;
+bool RuntimeOption::AutoloadIndex = false;
 
 bool RuntimeOption::MySQLReadOnly = false;
 bool RuntimeOption::MySQLLocalize = false;
@@ -247,9 +254,13 @@ bool RuntimeOption::MySQLKillOnTimeout = false;
 int RuntimeOption::MySQLMaxRetryOpenOnFail = 1;
 int RuntimeOption::MySQLMaxRetryQueryOnFail = 1;
 std::string RuntimeOption::MySQLSocket = "";
+int RuntimeOption::MySQLStatementCacheSize = 32;
 
 int RuntimeOption::HttpDefaultTimeout = 30;
 int RuntimeOption::HttpSlowQueryThreshold = 5000; // ms
+int RuntimeOption::HttpConnectionPoolMaxPerHost = 8;
+int RuntimeOption::HttpConnectionPoolIdleTimeout = 30; // seconds
+std::set<std::string> RuntimeOption::HttpConnectionPoolHosts;
 
 bool RuntimeOption::TranslateLeakStackTrace = false;
 bool RuntimeOption::NativeStackTrace = false;
@@ -286,6 +297,10 @@ std::string RuntimeOption::StatsXSL;
 std::string RuntimeOption::StatsXSLProxy;
 int RuntimeOption::StatsSlotDuration = 10 * 60; // 10 minutes
 int RuntimeOption::StatsMaxSlot = 12 * 6; // 12 hours
+int RuntimeOption::TraceSampleRate = 0;
+std::string RuntimeOption::TraceFile;
+int RuntimeOption::TraceKeepRecent = 100;
+std::set<std::string> RuntimeOption::TraceTrustedHosts;
 
 bool RuntimeOption::EnableAPCSizeStats = false;
 bool RuntimeOption::EnableAPCSizeGroup = false;
@@ -411,6 +426,7 @@ bool RuntimeOption::EvalJitEnableRenameFunction = false;
 std::set<string, stdltistr> RuntimeOption::DynamicInvokeFunctions;
 bool RuntimeOption::EvalJitCmovVarDeref = true;
 bool RuntimeOption::EvalJitTransCounters = false;
+std::string RuntimeOption::EvalJitFuncProfile;
 bool RuntimeOption::EvalJitUseIR = false;
 bool RuntimeOption::EvalIRPuntDontInterp = false;
 bool RuntimeOption::EvalHHIRGenericDtorHelper = true;
@@ -444,6 +460,10 @@ size_t RuntimeOption::VMTranslGDataSize = RuntimeOption::VMTranslASize >> 2;
 std::string RuntimeOption::RepoLocalMode;
 std::string RuntimeOption::RepoLocalPath;
 std::string RuntimeOption::RepoCentralPath;
+std::string RuntimeOption::RepoFlatPath;
+int RuntimeOption::RepoPreloadThreads = 0;
+std::string RuntimeOption::RepoPreloadFileList;
+bool RuntimeOption::RepoPreloadRecord = false;
 std::string RuntimeOption::RepoEvalMode;
 std::string RuntimeOption::RepoJournal;
 bool RuntimeOption::RepoCommit = true;
@@ -479,6 +499,8 @@ int RuntimeOption::PregBacktraceLimit = 100000;
 int RuntimeOption::PregRecursionLimit = 100000;
 bool RuntimeOption::EnablePregErrorLog = true;
 
+int RuntimeOption::FbCompactSerializeVersion = 1;
+
 bool RuntimeOption::EnableHotProfiler = true;
 int RuntimeOption::ProfilerTraceBuffer = 2000000;
 double RuntimeOption::ProfilerTraceExpansion = 1.2;
@@ -755,6 +777,7 @@ void RuntimeOption::Load(Hdf &config, StringVec *overwrites /* = NULL */,
       server["AlwaysPopulateRawPostData"].getBool(true);
     LibEventSyncSend = server["LibEventSyncSend"].getBool(true);
     TakeoverFilename = server["TakeoverFilename"].getString();
+    TakeoverStateTimeout = server["TakeoverStateTimeout"].getInt32(0);
     ExpiresActive = server["ExpiresActive"].getBool(true);
     ExpiresDefault = server["ExpiresDefault"].getInt32(2592000);
     if (ExpiresDefault < 0) ExpiresDefault = 2592000;
@@ -798,6 +821,8 @@ void RuntimeOption::Load(Hdf &config, StringVec *overwrites /* = NULL */,
     if (EnableStaticContentMMap) {
       EnableOnDemandUncompress = true;
     }
+    PageCacheMaxMemory =
+      server["PageCache.MaxMemory"].getInt64(64) * 1024 * 1024;
     RTTIDirectory =
       Util::normalizeDir(server["RTTIDirectory"].getString("/tmp/"));
     EnableCliRTTI = server["EnableCliRTTI"].getBool();
@@ -853,6 +878,8 @@ void RuntimeOption::Load(Hdf &config, StringVec *overwrites /* = NULL */,
     WarnOnCollectionToArray = server["WarnOnCollectionToArray"].getBool(false);
     UseDirectCopy = server["UseDirectCopy"].getBool(false);
     AlwaysUseRelativePath = server["AlwaysUseRelativePath"].getBool(false);
+    IncludeResolveCacheSize = server["IncludeResolveCacheSize"].getInt32(0);
+    AutoloadIndex = server["AutoloadIndex"].getBool(false);
 
     Hdf apc = server["APC"];
     EnableApc = apc["EnableApc"].getBool(true);
@@ -989,6 +1016,9 @@ void RuntimeOption::Load(Hdf &config, StringVec *overwrites /* = NULL */,
     XboxServerLogInfo = xbox["ServerInfo.LogInfo"].getBool(false);
     XboxProcessMessageFunc =
       xbox["ProcessMessageFunc"].get("xbox_process_message");
+    XboxConnectionPoolSize = xbox["ConnectionPool.MaxConnections"].getInt32(0);
+    XboxConnectionPoolMaxInFlight =
+      xbox["ConnectionPool.MaxInFlight"].getInt32(0);
   }
   {
     Hdf pagelet = config["PageletServer"];
@@ -998,6 +1028,7 @@ void RuntimeOption::Load(Hdf &config, StringVec *overwrites /* = NULL */,
     PageletServerThreadDropCacheTimeoutSeconds =
       pagelet["ThreadDropCacheTimeoutSeconds"].getInt32(0);
     PageletServerQueueLimit = pagelet["QueueLimit"].getInt32(0);
+    PageletServerBatchSize = pagelet["BatchSize"].getInt32(8);
   }
   {
     FiberCount = config["Fiber.ThreadCount"].getInt32(Process::GetCPUCount());
@@ -1044,11 +1075,24 @@ void RuntimeOption::Load(Hdf &config, StringVec *overwrites /* = NULL */,
     MySQLMaxRetryOpenOnFail = mysql["MaxRetryOpenOnFail"].getInt32(1);
     MySQLMaxRetryQueryOnFail = mysql["MaxRetryQueryOnFail"].getInt32(1);
     MySQLSocket = mysql["Socket"].getString();
+    MySQLStatementCacheSize = mysql["StatementCacheSize"].getInt32(32);
   }
   {
     Hdf http = config["Http"];
     HttpDefaultTimeout = http["DefaultTimeout"].getInt32(30);
     HttpSlowQueryThreshold = http["SlowQueryThreshold"].getInt32(5000);
+    HttpConnectionPoolMaxPerHost =
+      http["ConnectionPool"]["MaxPerHost"].getInt32(8);
+    HttpConnectionPoolIdleTimeout =
+      http["ConnectionPool"]["IdleTimeout"].getInt32(30);
+    {
+      std::set<std::string> hosts;
+      http["ConnectionPool"]["Hosts"].get(hosts);
+      for (std::set<std::string>::const_iterator iter = hosts.begin();
+           iter != hosts.end(); ++iter) {
+        HttpConnectionPoolHosts.insert(Util::toLower(*iter));
+      }
+    }
   }
   {
     Hdf debug = config["Debug"];
@@ -1105,6 +1149,14 @@ void RuntimeOption::Load(Hdf &config, StringVec *overwrites /* = NULL */,
     StatsSlotDuration = stats["SlotDuration"].getInt32(10 * 60); // 10 minutes
     StatsMaxSlot = stats["MaxSlot"].getInt32(12 * 6); // 12 hours
 
+    {
+      Hdf trace = stats["Trace"];
+      TraceSampleRate = trace["SampleRate"].getInt32(0);
+      TraceFile = trace["File"].getString();
+      TraceKeepRecent = trace["KeepRecent"].getInt32(100);
+      trace["TrustedHosts"].get(TraceTrustedHosts);
+    }
+
     {
       Hdf apcSize = stats["APCSize"];
       EnableAPCSizeStats = apcSize["Enable"].getBool();
@@ -1195,6 +1247,8 @@ void RuntimeOption::Load(Hdf &config, StringVec *overwrites /* = NULL */,
     EvalJitDisabledByHphpd = eval["EvalJitDisabledByHphpd"].getBool(false);
     EvalJitCmovVarDeref = eval["JitCmovVarDeref"].getBool(true);
     EvalJitTransCounters = eval["JitTransCounters"].getBool(false);
+    EvalJitFuncProfile = eval["JitFuncProfile"].getString();
+    if (!EvalJitFuncProfile.empty()) EvalJitTransCounters = true;
     EvalJitProfilePath = eval["JitProfilePath"].getString();
     EvalJitStressTypePredPercent = eval["JitStressTypePredPercent"].getInt32(0);
     EvalJitProfileRecord = eval["JitProfileRecord"].getBool(false);
@@ -1284,6 +1338,17 @@ void RuntimeOption::Load(Hdf &config, StringVec *overwrites /* = NULL */,
       // Repo.Central.Path.
       RepoCentralPath = repoCentral["Path"].getString();
     }
+    {
+      Hdf repoFlat = repo["Flat"];
+      // Repo.Flat.Path.
+      RepoFlatPath = repoFlat["Path"].getString();
+    }
+    {
+      Hdf repoPreload = repo["Preload"];
+      RepoPreloadThreads = repoPreload["Threads"].getInt32(0);
+      RepoPreloadFileList = repoPreload["FileList"].getString();
+      RepoPreloadRecord = repoPreload["Record"].getBool(false);
+    }
     {
       Hdf repoEval = repo["Eval"];
       // Repo.Eval.Mode.
@@ -1329,6 +1394,10 @@ void RuntimeOption::Load(Hdf &config, StringVec *overwrites /* = NULL */,
     PregRecursionLimit = preg["RecursionLimit"].getInt32(100000);
     EnablePregErrorLog = preg["ErrorLog"].getBool(true);
   }
+  {
+    Hdf fb = config["FbCompactSerialize"];
+    FbCompactSerializeVersion = fb["Version"].getInt32(1);
+  }
 
   Extension::LoadModules(config);
   if (overwrites) Loaded = true;
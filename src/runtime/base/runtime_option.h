@@ -108,6 +108,7 @@ public:
   static int PageletServerThreadDropCacheTimeoutSeconds;
   static int PageletServerQueueLimit;
   static bool PageletServerThreadDropStack;
+  static int PageletServerBatchSize;
 
   static int FiberCount;
   static int RequestTimeoutSeconds;
@@ -180,6 +181,8 @@ public:
   static bool XboxServerInfoAlwaysReset;
   static bool XboxServerLogInfo;
   static std::string XboxProcessMessageFunc;
+  static int XboxConnectionPoolSize;
+  static int XboxConnectionPoolMaxInFlight;
   static std::string XboxPassword;
   static std::set<std::string> XboxPasswords;
 
@@ -196,6 +199,7 @@ public:
   static bool EnableStaticContentFromDisk;
   static bool EnableOnDemandUncompress;
   static bool EnableStaticContentMMap;
+  static int64 PageCacheMaxMemory;
 
   static std::string RTTIDirectory;
   static bool EnableCliRTTI;
@@ -221,6 +225,7 @@ public:
   static std::vector<std::string> AllowedExecCmds;
 
   static std::string TakeoverFilename;
+  static int TakeoverStateTimeout;
   static int AdminServerPort;
   static int AdminThreadCount;
   static std::string AdminPassword;
@@ -235,6 +240,8 @@ public:
   static std::set<std::string> ProxyURLs;
   static std::vector<std::string> ProxyPatterns;
   static bool AlwaysUseRelativePath;
+  static int IncludeResolveCacheSize;
+  static bool AutoloadIndex;
 
   static bool MySQLReadOnly;
   static bool MySQLLocalize;  // whether to localize MySQL query results
@@ -246,9 +253,13 @@ public:
   static int  MySQLMaxRetryOpenOnFail;
   static int  MySQLMaxRetryQueryOnFail;
   static std::string MySQLSocket;
+  static int  MySQLStatementCacheSize;
 
   static int  HttpDefaultTimeout;
   static int  HttpSlowQueryThreshold;
+  static int  HttpConnectionPoolMaxPerHost;
+  static int  HttpConnectionPoolIdleTimeout;
+  static std::set<std::string> HttpConnectionPoolHosts;
 
   static bool TranslateLeakStackTrace;
   static bool NativeStackTrace;
@@ -280,6 +291,10 @@ public:
   static std::string StatsXSLProxy;
   static int StatsSlotDuration;
   static int StatsMaxSlot;
+  static int TraceSampleRate;
+  static std::string TraceFile;
+  static int TraceKeepRecent;
+  static std::set<std::string> TraceTrustedHosts;
 
   static bool EnableAPCSizeStats;
   static bool EnableAPCSizeGroup;
@@ -415,6 +430,7 @@ public:
   static bool EvalJitCmovVarDeref;
   static bool EvalThreadingJit;
   static bool EvalJitTransCounters;
+  static std::string EvalJitFuncProfile;
   static bool EvalJitMGeneric;
   static bool EvalJitUseIR;
   static bool EvalIRPuntDontInterp;
@@ -449,6 +465,10 @@ public:
   static std::string RepoLocalMode;
   static std::string RepoLocalPath;
   static std::string RepoCentralPath;
+  static std::string RepoFlatPath;
+  static int RepoPreloadThreads;
+  static std::string RepoPreloadFileList;
+  static bool RepoPreloadRecord;
   static std::string RepoEvalMode;
   static std::string RepoJournal;
   static bool RepoCommit;
@@ -488,6 +508,9 @@ public:
   static int PregRecursionLimit;
   static bool EnablePregErrorLog;
 
+  // fb_compact_serialize() format; 2 adds RECORDS, which older readers reject
+  static int FbCompactSerializeVersion;
+
   // Convenience switch to turn on/off code alternatives via command-line
   // Do not commit code guarded by this flag, for evaluation only.
   static int EnableAlternative;
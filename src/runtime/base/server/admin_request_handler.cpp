@@ -21,6 +21,8 @@
 #include <runtime/base/server/admin_request_handler.h>
 #include <runtime/base/server/http_server.h>
 #include <runtime/base/server/pagelet_server.h>
+#include <runtime/base/server/takeover_state.h>
+#include <runtime/base/server/request_trace.h>
 #include <runtime/base/util/http_client.h>
 #include <runtime/base/server/server_stats.h>
 #include <runtime/base/runtime_option.h>
@@ -136,6 +138,8 @@ void AdminRequestHandler::handleRequest(Transport *transport) {
         "/check-queued:    how many http requests are queued waiting to be\n"
         "                  handled\n"
         "/check-health:    return json containing basic load/usage stats\n"
+        "/check-takeover:  progress of handing runtime state over to, or\n"
+        "                  taking it from, another server instance\n"
         "/check-ev:        how many http requests are active by libevent\n"
         "/check-pl-load:   how many pagelet threads are actively handling\n"
         "                  requests\n"
@@ -143,6 +147,8 @@ void AdminRequestHandler::handleRequest(Transport *transport) {
         "                  be handled\n"
         "/check-mem:       report memory quick statistics in log file\n"
         "/check-sql:       report SQL table statistics\n"
+        "/trace-recent:    JSON traces of recently sampled requests\n"
+        "    count         number of traces, default Stats.Trace.KeepRecent\n"
 
         "/status.xml:      show server status in XML\n"
         "/status.json:     show server status in JSON\n"
@@ -215,6 +221,8 @@ void AdminRequestHandler::handleRequest(Transport *transport) {
         "/vm-tcspace:      show space used by translator caches\n"
         "/vm-dump-tc:      dump translation cache to /tmp/tc_dump_a and\n"
         "                  /tmp/tc_dump_astub\n"
+        "/vm-func-profile: write translation counters per function to\n"
+        "                  Eval.JitFuncProfile\n"
         "/vm-preconsts:    show information about preconsts\n"
         "/vm-tcreset:      throw away translations and start over\n"
 #endif
@@ -599,6 +607,16 @@ bool AdminRequestHandler::handleCheckRequest(const std::string &cmd,
     transport->sendString(out.str());
     return true;
   }
+  if (cmd == "check-takeover") {
+    transport->sendString(TakeoverState::GetStatus());
+    return true;
+  }
+  if (cmd == "trace-recent") {
+    int count = transport->getIntParam("count");
+    if (count <= 0) count = RuntimeOption::TraceKeepRecent;
+    transport->sendString(RequestTrace::GetRecent(count));
+    return true;
+  }
   if (cmd == "check-pl-load") {
     int count = PageletServer::GetActiveWorker();
     transport->sendString(lexical_cast<string>(count));
@@ -1003,6 +1021,14 @@ bool AdminRequestHandler::handleVMRequest(const std::string &cmd,
     }
     return true;
   }
+  if (cmd == "vm-func-profile") {
+    if (HPHP::VM::Transl::tc_dump_func_profile()) {
+      transport->sendString("Done");
+    } else {
+      transport->sendString("Error writing the function profile");
+    }
+    return true;
+  }
   if (cmd == "vm-tcreset") {
     int64 start = Timer::GetCurrentTimeMicros();
     if (HPHP::VM::Transl::tx64->replace()) {
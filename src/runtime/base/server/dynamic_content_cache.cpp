@@ -15,8 +15,10 @@
 */
 
 #include <runtime/base/server/dynamic_content_cache.h>
+#include <runtime/base/runtime_option.h>
 #include <util/lock.h>
 #include <util/compression.h>
+#include <util/hash.h>
 
 namespace HPHP {
 ///////////////////////////////////////////////////////////////////////////////
@@ -72,6 +74,135 @@ void DynamicContentCache::store(const std::string &name, const char *data,
   }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// full-page cache
+
+int64 DynamicContentCache::Page::getMemorySize() const {
+  int64 size = sizeof(Page) + file->size();
+  if (compressed) size += compressed->size();
+  for (unsigned int i = 0; i < headers.size(); i++) {
+    size += headers[i].first.size() + headers[i].second.size();
+  }
+  return size;
+}
+
+void DynamicContentCache::PageShard::erase(StringToPagePtrMap::iterator iter) {
+  memory -= iter->second->getMemorySize();
+  lru.erase(iter->second->lru);
+  pages.erase(iter);
+}
+
+DynamicContentCache::PageShard &
+DynamicContentCache::getShard(const std::string &key) {
+  strhash_t h = hash_string(key.data(), key.size());
+  return m_shards[h & (PageShardCount - 1)];
+}
+
+DynamicContentCache::PageLookup
+DynamicContentCache::findPage(const std::string &key, PagePtr &page) {
+  ASSERT(!key.empty());
+
+  PageShard &shard = getShard(key);
+  Lock lock(shard.mutex);
+  StringToPagePtrMap::iterator iter = shard.pages.find(key);
+  if (iter == shard.pages.end()) {
+    return PageMiss;
+  }
+
+  Page &p = *iter->second;
+  time_t now = time(NULL);
+  if (now >= p.staleUntil) {
+    shard.erase(iter);
+    return PageMiss;
+  }
+
+  shard.lru.splice(shard.lru.begin(), shard.lru, p.lru);
+  if (now < p.expire) {
+    page = iter->second;
+    return PageHit;
+  }
+  if (!p.refreshing) {
+    p.refreshing = true;
+    return PageRefresh;
+  }
+  page = iter->second;
+  return PageStale;
+}
+
+void DynamicContentCache::storePage(const std::string &key,
+                                    const char *data, int size,
+                                    const HeaderList &headers,
+                                    int ttl, int stale) {
+  ASSERT(!key.empty());
+  ASSERT(size > 0);
+
+  PagePtr page(new Page());
+  page->file = CstrBufferPtr(new CstrBuffer(size));
+  page->file->append(data, size); // makes a copy
+  int len = size;
+  char *compressed = gzencode(data, len, 9, CODING_GZIP);
+  if (compressed) {
+    if (len < size) {
+      page->compressed = CstrBufferPtr(new CstrBuffer(compressed, len));
+    } else {
+      free(compressed);
+    }
+  }
+  page->headers = headers;
+  page->expire = time(NULL) + ttl;
+  page->staleUntil = page->expire + stale;
+
+  int64 limit = RuntimeOption::PageCacheMaxMemory / PageShardCount;
+  int64 memory = page->getMemorySize();
+  if (memory > limit) {
+    abandonPage(key);
+    return;
+  }
+
+  PageShard &shard = getShard(key);
+  Lock lock(shard.mutex);
+  StringToPagePtrMap::iterator iter = shard.pages.find(key);
+  if (iter != shard.pages.end()) {
+    shard.erase(iter);
+  }
+  while (shard.memory + memory > limit && !shard.lru.empty()) {
+    shard.erase(shard.pages.find(shard.lru.back()));
+  }
+  shard.lru.push_front(key);
+  page->lru = shard.lru.begin();
+  shard.pages[key] = page;
+  shard.memory += memory;
+}
+
+void DynamicContentCache::abandonPage(const std::string &key) {
+  PageShard &shard = getShard(key);
+  Lock lock(shard.mutex);
+  StringToPagePtrMap::iterator iter = shard.pages.find(key);
+  if (iter != shard.pages.end()) {
+    iter->second->refreshing = false;
+  }
+}
+
+void DynamicContentCache::clearPages() {
+  for (int i = 0; i < PageShardCount; i++) {
+    PageShard &shard = m_shards[i];
+    Lock lock(shard.mutex);
+    shard.pages.clear();
+    shard.lru.clear();
+    shard.memory = 0;
+  }
+}
+
+int64 DynamicContentCache::getPageMemorySize() {
+  int64 total = 0;
+  for (int i = 0; i < PageShardCount; i++) {
+    PageShard &shard = m_shards[i];
+    Lock lock(shard.mutex);
+    total += shard.memory;
+  }
+  return total;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 }
 
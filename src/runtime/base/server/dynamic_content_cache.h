@@ -19,6 +19,7 @@
 
 #include <runtime/base/util/string_buffer.h>
 #include <util/mutex.h>
+#include <list>
 
 namespace HPHP {
 ///////////////////////////////////////////////////////////////////////////////
@@ -41,6 +42,51 @@ public:
    */
   void store(const std::string &name, const char *data, int size);
 
+  /**
+   * Full-page cache for PHP responses matched by a VirtualHost PageCache
+   * rule. An entry is fresh for "ttl" seconds, then may be served stale for
+   * another "stale" seconds while exactly one request re-renders it.
+   */
+  enum PageLookup {
+    PageMiss,    // nothing usable: render the page, then call storePage()
+    PageHit,     // fresh entry returned
+    PageStale,   // stale entry returned, another request is refreshing it
+    PageRefresh, // stale entry, and this request was picked to refresh it
+  };
+
+  typedef std::vector<std::pair<std::string, std::string> > HeaderList;
+
+  DECLARE_BOOST_TYPES(Page);
+  class Page {
+  public:
+    Page() : expire(0), staleUntil(0), refreshing(false) {}
+
+    CstrBufferPtr file;
+    CstrBufferPtr compressed;
+    HeaderList headers;
+
+    // the following are guarded by the owning shard's mutex
+    time_t expire;
+    time_t staleUntil;
+    bool refreshing;
+    std::list<std::string>::iterator lru;
+
+    int64 getMemorySize() const;
+  };
+
+  PageLookup findPage(const std::string &key, PagePtr &page);
+  void storePage(const std::string &key, const char *data, int size,
+                 const HeaderList &headers, int ttl, int stale);
+
+  /**
+   * Called when a refreshing request didn't produce a cacheable page, so the
+   * next request on this key gets to try instead.
+   */
+  void abandonPage(const std::string &key);
+
+  void clearPages();
+  int64 getPageMemorySize();
+
 private:
   ReadWriteMutex m_mutex;
 
@@ -52,6 +98,23 @@ private:
   };
 
   StringToResourceFilePtrMap m_files;
+
+  class PageShard {
+  public:
+    PageShard() : memory(0) {}
+
+    Mutex mutex;
+    StringToPagePtrMap pages;
+    std::list<std::string> lru; // most recently used first
+    int64 memory;
+
+    void erase(StringToPagePtrMap::iterator iter);
+  };
+
+  static const int PageShardCount = 16;
+  PageShard m_shards[PageShardCount];
+
+  PageShard &getShard(const std::string &key);
 };
 
 ///////////////////////////////////////////////////////////////////////////////
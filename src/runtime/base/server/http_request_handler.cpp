@@ -114,6 +114,7 @@ void HttpRequestHandler::handleRequest(Transport *transport) {
   GetAccessLog().onNewRequest();
   transport->enableCompression();
 
+  RequestTraceScope trace(transport);
   ServerStatsHelper ssh("all", ServerStatsHelper::TRACK_MEMORY);
   Logger::Verbose("receiving %s", transport->getCommand().c_str());
 
@@ -243,6 +244,26 @@ void HttpRequestHandler::handleRequest(Transport *transport) {
     return;
   }
 
+  // check full-page cache for PHP pages matched by a PageCache rule
+  const VirtualHost::PageCacheRule *pageCacheRule = NULL;
+  string pageCacheKey;
+  bool pageRefreshing = false;
+  if (vhost->hasPageCacheRule() && !cachableDynamicContent &&
+      (!ext || strcasecmp(ext, "php") == 0)) {
+    pageCacheRule = vhost->getPageCacheRule(transport->getUrl());
+    if (pageCacheRule &&
+        getPageCacheKey(transport, vhost, *pageCacheRule, pageCacheKey)) {
+      if (sendCachedPage(transport, pageCacheKey, compressed,
+                         pageRefreshing)) {
+        ServerStats::LogPage(path, 200);
+        GetAccessLog().log(transport, vhost);
+        return;
+      }
+    } else {
+      pageCacheRule = NULL;
+    }
+  }
+
   // record request for debugging purpose
   std::string tmpfile = HttpProtocol::RecordRequest(transport);
 
@@ -253,7 +274,8 @@ void HttpRequestHandler::handleRequest(Transport *transport) {
   bool ret = false;
   try {
     ret = executePHPRequest(transport, reqURI, sourceRootInfo,
-                            cachableDynamicContent);
+                            cachableDynamicContent, pageCacheRule,
+                            pageCacheKey);
   } catch (const Eval::DebuggerException &e) {
     transport->sendString(e.what(), 200);
     transport->onSendEnd();
@@ -261,6 +283,11 @@ void HttpRequestHandler::handleRequest(Transport *transport) {
   } catch (...) {
     Logger::Error("Unhandled exception in HPHP server engine.");
   }
+  if (pageRefreshing) {
+    // however the request ended, let the next one refresh the stale page; a
+    // page this request stored is fresh and not refreshing anyway
+    DynamicContentCache::TheCache.abandonPage(pageCacheKey);
+  }
   GetAccessLog().log(transport, vhost);
   /*
    * HPHP logs may need to access data in ServerStats, so we have to
@@ -275,7 +302,10 @@ void HttpRequestHandler::handleRequest(Transport *transport) {
 bool HttpRequestHandler::executePHPRequest(Transport *transport,
                                            RequestURI &reqURI,
                                            SourceRootInfo &sourceRootInfo,
-                                           bool cachableDynamicContent) {
+                                           bool cachableDynamicContent,
+                                           const VirtualHost::PageCacheRule
+                                           *pageCacheRule,
+                                           const string &pageCacheKey) {
   ExecutionContext *context = hphp_context_init();
   if (RuntimeOption::ImplicitFlush) {
     context->obSetImplicitFlush(true);
@@ -318,6 +348,8 @@ bool HttpRequestHandler::executePHPRequest(Transport *transport,
                     error, errorMsg);
 
   if (ret) {
+    // anything flushed early never made it into content
+    bool partial = transport->headersSent();
     String content = context->obDetachContents();
     if (cachableDynamicContent && !content.empty()) {
       ASSERT(transport->getUrl());
@@ -327,6 +359,9 @@ bool HttpRequestHandler::executePHPRequest(Transport *transport,
     }
     transport->sendRaw((void*)content.data(), content.size());
     code = transport->getResponseCode();
+    if (pageCacheRule && !partial && code == 200 && !content.empty()) {
+      storeCachedPage(transport, pageCacheKey, *pageCacheRule, content);
+    }
   } else if (error) {
     code = 500;
 
@@ -375,6 +410,99 @@ bool HttpRequestHandler::executePHPRequest(Transport *transport,
   return ret;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// full-page cache
+
+bool HttpRequestHandler::getPageCacheKey(Transport *transport,
+                                         const VirtualHost *vhost,
+                                         const VirtualHost::PageCacheRule &rule,
+                                         string &key) {
+  if (transport->getMethod() != Transport::GET) {
+    return false;
+  }
+  for (unsigned int i = 0; i < rule.excludeCookies.size(); i++) {
+    if (!transport->getCookie(rule.excludeCookies[i]).empty()) {
+      return false;
+    }
+  }
+
+  ASSERT(transport->getUrl());
+  key = vhost->getName();
+  key += '\n';
+  key += transport->getHeader("Host");
+  key += '\n';
+  key += transport->getUrl();
+  for (unsigned int i = 0; i < rule.varyHeaders.size(); i++) {
+    key += '\n';
+    key += transport->getHeader(rule.varyHeaders[i].c_str());
+  }
+  return true;
+}
+
+bool HttpRequestHandler::sendCachedPage(Transport *transport,
+                                        const string &key, bool compressed,
+                                        bool &refreshing) {
+  DynamicContentCache::PagePtr page;
+  switch (DynamicContentCache::TheCache.findPage(key, page)) {
+  case DynamicContentCache::PageHit:
+    ServerStats::Log("page_cache.hit", 1);
+    break;
+  case DynamicContentCache::PageStale:
+    ServerStats::Log("page_cache.stale", 1);
+    break;
+  case DynamicContentCache::PageRefresh:
+    ServerStats::Log("page_cache.refresh", 1);
+    refreshing = true;
+    return false;
+  default:
+    ServerStats::Log("page_cache.miss", 1);
+    return false;
+  }
+
+  for (unsigned int i = 0; i < page->headers.size(); i++) {
+    transport->addHeader(page->headers[i].first.c_str(),
+                         page->headers[i].second.c_str());
+  }
+  const char *data; int len;
+  if (compressed && page->compressed) {
+    data = page->compressed->data();
+    len = page->compressed->size();
+  } else {
+    compressed = false;
+    data = page->file->data();
+    len = page->file->size();
+  }
+  transport->sendRaw((void*)data, len, 200, compressed);
+  // no request runs, so nobody else ends the response; pagelet callers
+  // wait on this
+  transport->onSendEnd();
+  return true;
+}
+
+bool HttpRequestHandler::storeCachedPage(Transport *transport,
+                                         const string &key,
+                                         const VirtualHost::PageCacheRule &rule,
+                                         CStrRef content) {
+  HeaderMap headers;
+  transport->getResponseHeaders(headers);
+
+  DynamicContentCache::HeaderList cached;
+  for (HeaderMap::const_iterator iter = headers.begin();
+       iter != headers.end(); ++iter) {
+    if (iter->second.empty()) continue;
+    if (strcasecmp(iter->first.c_str(), "Set-Cookie") == 0) {
+      return false; // per-user response
+    }
+    for (unsigned int i = 0; i < iter->second.size(); i++) {
+      cached.push_back(make_pair(iter->first, iter->second[i]));
+    }
+  }
+
+  DynamicContentCache::TheCache.storePage(key, content.data(), content.size(),
+                                          cached, rule.ttl, rule.stale);
+  return true;
+}
+
 bool HttpRequestHandler::handleProxyRequest(Transport *transport, bool force) {
   string url = RuntimeOption::ProxyOrigin + transport->getServerObject();
 
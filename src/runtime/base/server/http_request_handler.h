@@ -51,7 +51,17 @@ private:
                          const char *ext);
   bool executePHPRequest(Transport *transport, RequestURI &reqURI,
                          SourceRootInfo &sourceRootInfo,
-                         bool cachableDynamicContent);
+                         bool cachableDynamicContent,
+                         const VirtualHost::PageCacheRule *pageCacheRule,
+                         const std::string &pageCacheKey);
+  bool getPageCacheKey(Transport *transport, const VirtualHost *vhost,
+                       const VirtualHost::PageCacheRule &rule,
+                       std::string &key);
+  bool sendCachedPage(Transport *transport, const std::string &key,
+                      bool compressed, bool &refreshing);
+  bool storeCachedPage(Transport *transport, const std::string &key,
+                       const VirtualHost::PageCacheRule &rule,
+                       CStrRef content);
   bool MatchAnyPattern(const std::string &path,
                        const std::vector<std::string> &patterns);
 
@@ -34,6 +34,8 @@
 #include <runtime/base/server/replay_transport.h>
 #include <runtime/base/program_functions.h>
 #include <runtime/eval/debugger/debugger.h>
+#include <runtime/eval/runtime/file_repository.h>
+#include <runtime/vm/translator/translator.h>
 #include <util/db_conn.h>
 #include <runtime/ext/ext_apc.h>
 #include <sys/types.h>
@@ -274,6 +276,13 @@ void HttpServer::run() {
   if (RuntimeOption::ServerPort) {
     m_pageServer->stop();
   }
+  if (hhvm) {
+    Eval::FileRepository::recordPreloadList();
+    if (RuntimeOption::EvalJit &&
+        !RuntimeOption::EvalJitFuncProfile.empty()) {
+      VM::Transl::tc_dump_func_profile();
+    }
+  }
   time_t t1 = time(0);
   if (!m_danglings.empty() && RuntimeOption::ServerDanglingWait > 0) {
     int elapsed = t1 - t0;
@@ -15,6 +15,7 @@
 */
 
 #include <runtime/base/server/libevent_server_with_takeover.h>
+#include <runtime/base/server/takeover_state.h>
 #include <util/logger.h>
 #include <runtime/base/string_util.h>
 #include <afdt.h>
@@ -39,6 +40,13 @@ we can give the socket to the next instance that starts.
 It is a little bit of a hack to use libafdt to send the shutdown
 request, but we need to synchronously shut down the admin server,
 so we cannot use the admin server for it.
+
+Before any of that, a new server may also ask for the old server's
+runtime state (see TakeoverState). The old server writes it to a file
+next to the transfer socket on a separate thread, and answers "wait"
+until it is done, so the new server polls until it gets "done" and
+then loads the file. Old servers that don't know this request answer
+"unknown", and the new server simply starts cold.
 */
 
 // We use a very simple protocol for communicating over libafdt:
@@ -50,6 +58,10 @@ so we cannot use the admin server for it.
 #define C_TERM_OK  "\x05"
 #define C_TERM_BAD "\x06"
 #define C_UNKNOWN  "\x07"
+#define C_STATE_REQ  "\x08"
+#define C_STATE_WAIT "\x09"
+#define C_STATE_DONE "\x0a"
+#define C_STATE_BAD  "\x0b"
 
 namespace HPHP {
 
@@ -86,10 +98,19 @@ LibEventServerWithTakeover::LibEventServerWithTakeover
 (const std::string &address, int port, int thread, int timeoutSeconds)
   : LibEventServer(address, port, thread, timeoutSeconds),
     m_delete_handle(NULL),
-    m_took_over(false)
+    m_took_over(false),
+    m_state_saver(NULL)
 {
 }
 
+static std::string state_filename(const std::string &fname) {
+  return fname + ".state";
+}
+
+void LibEventServerWithTakeover::saveState() {
+  TakeoverState::Save(state_filename(m_transfer_fname));
+}
+
 int LibEventServerWithTakeover::afdtRequest(String request, String* response) {
   Logger::Info("takeover: received request");
   if (request == P_VERSION C_FD_REQ) {
@@ -153,6 +174,27 @@ int LibEventServerWithTakeover::afdtRequest(String request, String* response) {
     }
     Logger::Info("takeover: notification complete");
     return -1;
+  } else if (request == P_VERSION C_STATE_REQ) {
+    // This runs on the libevent thread, so the snapshot is taken on a
+    // separate one to keep serving while it is written.
+    switch (TakeoverState::GetPhase()) {
+    case TakeoverState::Saved:
+      *response = P_VERSION C_STATE_DONE;
+      break;
+    case TakeoverState::Failed:
+      *response = P_VERSION C_STATE_BAD;
+      break;
+    default:
+      if (!m_state_saver) {
+        Logger::Info("takeover: request is a state request");
+        m_state_saver = new AsyncFunc<LibEventServerWithTakeover>
+          (this, &LibEventServerWithTakeover::saveState);
+        m_state_saver->start();
+      }
+      *response = P_VERSION C_STATE_WAIT;
+      break;
+    }
+    return -1;
   } else {
     Logger::Info("takeover: request is unrecognize");
     *response = P_VERSION C_UNKNOWN;
@@ -321,10 +363,64 @@ void LibEventServerWithTakeover::stop() {
   if (m_delete_handle != NULL) {
     afdt_close_server(m_delete_handle);
   }
+  if (m_state_saver) {
+    m_state_saver->waitForEnd();
+    delete m_state_saver;
+    m_state_saver = NULL;
+    unlink(state_filename(m_transfer_fname).c_str());
+  }
   m_accept_sock = -1;
   LibEventServer::stop();
 }
 
+bool LibEventServerWithTakeover::RequestState(const std::string &fname,
+                                              int timeoutSeconds) {
+  time_t deadline = time(NULL) + timeoutSeconds;
+  while (true) {
+    uint8_t state_request[3] = P_VERSION C_STATE_REQ;
+    uint8_t state_response[3] = {0,0,0};
+    uint32_t response_len = sizeof(state_response);
+    int should_not_receive_fd;
+    afdt_error_t err = AFDT_ERROR_T_INIT;
+    struct timeval timeout = { 2 , 0 };
+    int ret = afdt_sync_client(
+        fname.c_str(),
+        state_request,
+        sizeof(state_request) - 1,
+        state_response,
+        &response_len,
+        &should_not_receive_fd,
+        &timeout,
+        &err);
+    if (ret < 0) {
+      // most likely there is no server to take over from
+      return false;
+    }
+    String resp((const char*)state_response, response_len, CopyString);
+    if (resp == P_VERSION C_STATE_DONE) {
+      break;
+    }
+    if (resp != P_VERSION C_STATE_WAIT) {
+      Logger::Warning(
+          "takeover: old server did not hand over its state: "
+          "response = '%s'",
+          StringUtil::CEncode(resp, null_string).data());
+      return false;
+    }
+    if (time(NULL) >= deadline) {
+      Logger::Warning("takeover: timed out waiting for old server's state");
+      return false;
+    }
+    usleep(100000);
+  }
+
+  Logger::Info("takeover: old server's state is ready");
+  std::string path = state_filename(fname);
+  bool ret = TakeoverState::Load(path, RuntimeOption::ServerWarmupRequests);
+  unlink(path.c_str());
+  return ret;
+}
+
 TakeoverListener::~TakeoverListener() {
 }
 
@@ -18,6 +18,7 @@
 #define __HTTP_SERVER_LIB_EVENT_SERVER_WITH_TAKEOVER_H__
 
 #include <runtime/base/server/libevent_server.h>
+#include <util/async_func.h>
 
 namespace HPHP {
 ///////////////////////////////////////////////////////////////////////////////
@@ -49,6 +50,11 @@ public:
     m_takeover_listeners.erase(lisener);
   }
 
+  // Called by a new server before it starts, to pull APC, loaded files and
+  // warmup requests from the server it is about to take over. Returns false
+  // if there is no such server or it couldn't hand its state over in time.
+  static bool RequestState(const std::string &fname, int timeoutSeconds);
+
   // These are public so they can be called from a C-style callback.
   // They are not a part of the public interface.
   void afdtResponse(String response, int fd);
@@ -60,11 +66,13 @@ protected:
 
   void setupFdServer();
   void notifyTakeoverComplete();
+  void saveState();
 
   void* m_delete_handle;
   std::string m_transfer_fname;
   std::set<TakeoverListener*> m_takeover_listeners;
   bool m_took_over;
+  AsyncFunc<LibEventServerWithTakeover> *m_state_saver;
 };
 
 class TakeoverListener {
@@ -18,6 +18,7 @@
 #include <runtime/base/server/transport.h>
 #include <runtime/base/server/http_request_handler.h>
 #include <runtime/base/server/upload.h>
+#include <runtime/base/server/request_trace.h>
 #include <runtime/base/server/job_queue_vm_stack.h>
 #include <runtime/base/util/string_buffer.h>
 #include <runtime/base/runtime_option.h>
@@ -26,6 +27,7 @@
 #include <util/job_queue.h>
 #include <util/lock.h>
 #include <util/logger.h>
+#include <util/thread_local.h>
 
 using std::set;
 using std::deque;
@@ -33,12 +35,39 @@ using std::deque;
 namespace HPHP {
 ///////////////////////////////////////////////////////////////////////////////
 
+/**
+ * Signaled whenever a pagelet started by the owning request thread produces
+ * output or finishes, so TaskSelect() can sleep until something is ready
+ * instead of polling every task.
+ */
+class PageletNotifier : public Synchronizable {
+public:
+  void signal() {
+    Lock lock(this);
+    notifyAll();
+  }
+};
+DECLARE_BOOST_TYPES(PageletNotifier);
+
+static IMPLEMENT_THREAD_LOCAL(PageletNotifierPtr, s_notifier);
+
+static PageletNotifierPtr get_notifier() {
+  PageletNotifierPtr &notifier = *s_notifier;
+  if (!notifier) {
+    notifier = PageletNotifierPtr(new PageletNotifier());
+  }
+  return notifier;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 class PageletTransport : public Transport, public Synchronizable {
 public:
   PageletTransport(CStrRef url, CArrRef headers, CStrRef postData,
                    CStrRef remoteHost, const set<string> &rfc1867UploadedFiles,
                    CArrRef files)
-    : m_refCount(0), m_done(false), m_code(0) {
+    : m_refCount(0), m_next(NULL), m_done(false), m_code(0),
+      m_notifier(get_notifier()) {
 
     gettime(CLOCK_MONOTONIC, &m_queueTime);
     m_threadType = PageletThread;
@@ -63,6 +92,16 @@ public:
       }
     }
 
+    // so this pagelet's trace can be joined up with its parent's; pagelet
+    // requests are trusted with their trace id, so the page doesn't get to
+    // pick one and the pagelet is only traced when its parent is (or when
+    // it is sampled on its own)
+    m_requestHeaders.erase(RequestTrace::HeaderName);
+    std::string traceId = RequestTrace::GetTraceId();
+    if (!traceId.empty()) {
+      m_requestHeaders[RequestTrace::HeaderName].push_back(traceId);
+    }
+
     if (postData.empty()) {
       m_get = true;
     } else {
@@ -122,9 +161,12 @@ public:
     }
   }
   virtual void onSendEndImpl() {
-    Lock lock(this);
-    m_done = true;
-    notify();
+    {
+      Lock lock(this);
+      m_done = true;
+      notify();
+    }
+    m_notifier->signal();
   }
   virtual bool isUploadedFile(CStrRef filename) {
     return m_rfc1867UploadedFiles.find(filename.c_str()) !=
@@ -148,9 +190,12 @@ public:
   }
 
   void addToPipeline(const string &s) {
-    Lock lock(this);
-    m_pipeline.push_back(s);
-    notify();
+    {
+      Lock lock(this);
+      m_pipeline.push_back(s);
+      notify();
+    }
+    m_notifier->signal();
   }
 
   bool isPipelineEmpty() {
@@ -158,6 +203,17 @@ public:
     return m_pipeline.empty();
   }
 
+  bool isReady() {
+    Lock lock(this);
+    return m_done || !m_pipeline.empty();
+  }
+
+  // batching: the next transport to run in the same worker job
+  PageletTransport *getNext() const { return m_next; }
+  void setNext(PageletTransport *next) { m_next = next; }
+
+  PageletNotifier *getNotifier() const { return m_notifier.get(); }
+
   String getResults(Array &headers, int &code, int64 timeout_ms) {
     {
       Lock lock(this);
@@ -213,6 +269,7 @@ public:
   timespec getStartTimer() const { return m_queueTime; }
 private:
   int m_refCount;
+  PageletTransport *m_next;
 
   string m_url;
   HeaderMap m_requestHeaders;
@@ -228,6 +285,8 @@ private:
   deque<string> m_pipeline; // the intermediate pagelet results
   set<string> m_rfc1867UploadedFiles;
   string m_files; // serialized to use as $_FILES
+
+  PageletNotifierPtr m_notifier; // of the thread that started this task
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -236,12 +295,18 @@ struct PageletWorker
   : JobQueueWorker<PageletTransport*,false,false,JobQueueDropVMStack>
 {
   virtual void doJob(PageletTransport *job) {
-    try {
-      job->onRequestStart(job->getStartTimer());
-      HttpRequestHandler().handleRequest(job);
-      job->decRefCount();
-    } catch (...) {
-      Logger::Error("HttpRequestHandler leaked exceptions");
+    // a batch is a chain of transports all run by this one job
+    HttpRequestHandler handler;
+    while (job) {
+      PageletTransport *next = job->getNext();
+      try {
+        job->onRequestStart(job->getStartTimer());
+        handler.handleRequest(job);
+        job->decRefCount();
+      } catch (...) {
+        Logger::Error("HttpRequestHandler leaked exceptions");
+      }
+      job = next;
     }
   }
 };
@@ -327,6 +392,107 @@ Object PageletServer::TaskStart(CStrRef url, CArrRef headers,
   return ret;
 }
 
+Array PageletServer::TaskStartBatch(CArrRef requests, CStrRef remote_host) {
+  Array ret = Array::Create();
+  if (RuntimeOption::PageletServerThreadCount <= 0) {
+    return ret;
+  }
+  if (RuntimeOption::PageletServerQueueLimit > 0 &&
+      s_dispatcher->getQueuedJobs() > RuntimeOption::PageletServerQueueLimit) {
+    return ret;
+  }
+  ASSERT(s_dispatcher);
+
+  int batchSize = RuntimeOption::PageletServerBatchSize;
+  if (batchSize <= 0) batchSize = 1;
+
+  const std::set<std::string> &uploadedFiles = get_uploaded_files();
+  PageletTransport *head = NULL;
+  PageletTransport *tail = NULL;
+  int count = 0;
+  for (ArrayIter iter(requests); iter; ++iter) {
+    Array request = iter.second().toArray();
+    PageletTask *task =
+      NEWOBJ(PageletTask)(request["url"].toString(),
+                          request["headers"].toArray(), remote_host,
+                          request["post_data"].toString(),
+                          uploadedFiles, request["files"].toArray());
+    ret.set(iter.first(), Object(task));
+
+    PageletTransport *job = task->getJob();
+    job->incRefCount(); // paired with worker's decRefCount()
+    if (tail) {
+      tail->setNext(job);
+    } else {
+      head = job;
+    }
+    tail = job;
+    if (++count == batchSize) {
+      s_dispatcher->enqueue(head);
+      head = tail = NULL;
+      count = 0;
+    }
+  }
+  if (head) {
+    s_dispatcher->enqueue(head);
+  }
+  return ret;
+}
+
+Array PageletServer::TaskSelect(CArrRef tasks, int64 timeout_ms) {
+  Array ready = Array::Create();
+  PageletNotifierPtr notifier = *s_notifier;
+  if (!notifier) {
+    // this thread never started any pagelet
+    return ready;
+  }
+
+  timespec deadline;
+  if (timeout_ms > 0) {
+    gettime(CLOCK_MONOTONIC, &deadline);
+    deadline.tv_sec += timeout_ms / 1000;
+    deadline.tv_nsec += (timeout_ms % 1000) * 1000000;
+    if (deadline.tv_nsec >= 1000000000) {
+      deadline.tv_sec++;
+      deadline.tv_nsec -= 1000000000;
+    }
+  }
+
+  // Workers signal the notifier while holding its lock, so checking every
+  // task with the lock held and then waiting on it can't miss a wakeup.
+  Lock lock(notifier.get());
+  while (true) {
+    bool pending = false;
+    for (ArrayIter iter(tasks); iter; ++iter) {
+      PageletTask *ptask =
+        iter.second().toObject().getTyped<PageletTask>(true, true);
+      if (!ptask) continue;
+      PageletTransport *job = ptask->getJob();
+      if (job->isReady()) {
+        ready.append(iter.first());
+      } else if (job->getNotifier() == notifier.get()) {
+        pending = true;
+      }
+    }
+    if (!ready.empty() || !pending) {
+      return ready;
+    }
+
+    if (timeout_ms > 0) {
+      timespec now;
+      gettime(CLOCK_MONOTONIC, &now);
+      int64 remaining = gettime_diff_us(now, deadline);
+      if (remaining <= 0 ||
+          !notifier->wait(remaining / 1000000,
+                          (remaining % 1000000) * 1000)) {
+        return ready;
+      }
+    } else {
+      notifier->wait();
+    }
+  }
+}
+
 int64 PageletServer::TaskStatus(CObjRef task) {
   PageletTask *ptask = task.getTyped<PageletTask>();
   PageletTransport *job = ptask->getJob();
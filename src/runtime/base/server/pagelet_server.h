@@ -36,6 +36,16 @@ public:
                           CStrRef post_data = null_string,
                           CArrRef files = null_array);
 
+  /**
+   * Create a batch of tasks. Each element of requests is an array with
+   * "url", "headers", "post_data" and "files" entries. Tasks are grouped
+   * into worker jobs of up to PageletServer.BatchSize requests, so that small
+   * pagelets don't each pay for a queue round trip and a thread wakeup.
+   * Returns task handles keyed the same way as requests, or an empty array
+   * if there are no worker threads.
+   */
+  static Array TaskStartBatch(CArrRef requests, CStrRef remote_host);
+
   /**
    * Query if a task is finished. This is non-blocking and can be called as
    * many times as desired.
@@ -51,6 +61,13 @@ public:
                            int &code,
                            int64 timeout_ms);
 
+  /**
+   * Wait until at least one of the tasks has (partial) data available or is
+   * done, or until timeout. A timeout of zero waits forever. Returns the keys
+   * of all tasks that are ready, or an empty array on timeout.
+   */
+  static Array TaskSelect(CArrRef tasks, int64 timeout_ms);
+
   /**
    * Add a piece of response to the pipeline.
    */
@@ -0,0 +1,278 @@
+/*
+   +----------------------------------------------------------------------+
+   | HipHop for PHP                                                       |
+   +----------------------------------------------------------------------+
+   | Copyright (c) 2010- Facebook, Inc. (http://www.facebook.com)         |
+   +----------------------------------------------------------------------+
+   | This source file is subject to version 3.01 of the PHP license,      |
+   | that is bundled with this package in the file LICENSE, and is        |
+   | available through the world-wide-web at the following url:           |
+   | http://www.php.net/license/3_01.txt                                  |
+   | If you did not receive a copy of the PHP license and are unable to   |
+   | obtain it through the world-wide-web, please send a note to          |
+   | license@php.net so we can mail you a copy immediately.               |
+   +----------------------------------------------------------------------+
+*/
+
+#include <runtime/base/server/request_trace.h>
+#include <runtime/base/server/transport.h>
+#include <runtime/base/runtime_option.h>
+#include <util/compatibility.h>
+#include <util/thread_local.h>
+#include <util/lock.h>
+#include <util/logger.h>
+#include <util/process.h>
+#include <deque>
+
+namespace HPHP {
+///////////////////////////////////////////////////////////////////////////////
+
+const char *RequestTrace::HeaderName = "X-HPHP-Trace-Id";
+
+// more than this many spans in one request is almost always a loop of I/O
+// calls, and the first ones tell the story already
+static const unsigned int MaxSpans = 1000;
+
+// ids we make are 16 hex digits; leave room for other tracers' formats
+static const unsigned int MaxTraceIdLength = 64;
+
+namespace {
+struct Span {
+  const char *name;
+  std::string detail;
+  int64 start; // us since the request started
+  int64 duration;
+};
+
+struct TraceData {
+  TraceData() : active(false), count(0) {}
+
+  bool active;
+  int64 count; // requests seen by this thread, for sampling
+  std::string id;
+  std::string url;
+  timespec start;    // CLOCK_MONOTONIC, for span offsets
+  int64 startEpoch;  // us since epoch, for trace event timestamps
+  std::vector<Span> spans;
+};
+}
+
+static IMPLEMENT_THREAD_LOCAL(TraceData, s_trace);
+
+static Mutex s_recent_mutex;
+static std::deque<std::string> s_recent;
+static FILE *s_file = NULL;
+
+static std::string new_trace_id() {
+  char buf[20];
+  snprintf(buf, sizeof(buf), "%08x%08x", (unsigned)random(),
+           (unsigned)random());
+  return buf;
+}
+
+static bool valid_trace_id(const std::string &id) {
+  if (id.empty() || id.size() > MaxTraceIdLength) return false;
+  for (unsigned int i = 0; i < id.size(); i++) {
+    char c = id[i];
+    if (!(c >= 'a' && c <= 'z') && !(c >= 'A' && c <= 'Z') &&
+        !(c >= '0' && c <= '9') && c != '-') {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Pagelet and local xbox requests were started by this server, which only
+ * passes them the id of a request it is already tracing, so their ids are
+ * ours. Anything off the network has to come from a configured host, or any
+ * client could make us trace whatever it wants.
+ */
+static bool trusted_source(Transport *transport) {
+  switch (transport->getThreadType()) {
+  case Transport::PageletThread:
+  case Transport::XboxThread:
+    return true;
+  default:
+    break;
+  }
+  const char *remote = transport->getRemoteHost();
+  return remote && RequestTrace::IsTrustedHost(remote);
+}
+
+static void json_escape(std::string &out, const std::string &s) {
+  for (unsigned int i = 0; i < s.size(); i++) {
+    unsigned char c = s[i];
+    if (c == '"' || c == '\\') {
+      out += '\\';
+      out += c;
+    } else if (c < 0x20) {
+      char buf[8];
+      snprintf(buf, sizeof(buf), "\\u%04x", c);
+      out += buf;
+    } else {
+      out += c;
+    }
+  }
+}
+
+void RequestTrace::Begin(Transport *transport) {
+  TraceData *data = s_trace.get();
+  data->active = false;
+  data->spans.clear();
+
+  std::string id;
+  if (trusted_source(transport)) {
+    id = transport->getHeader(HeaderName);
+    if (!id.empty() && !valid_trace_id(id)) {
+      Logger::Verbose("ignoring bad %s header", HeaderName);
+      id.clear();
+    }
+  }
+  if (id.empty()) {
+    if (RuntimeOption::TraceSampleRate <= 0 ||
+        ++data->count % RuntimeOption::TraceSampleRate != 0) {
+      return;
+    }
+    id = new_trace_id();
+  }
+
+  data->active = true;
+  data->id = id;
+  data->url = transport->getUrl() ? transport->getUrl() : "";
+  gettime(CLOCK_MONOTONIC, &data->start);
+  timespec now;
+  gettime(CLOCK_REALTIME, &now);
+  data->startEpoch = now.tv_sec * 1000000LL + now.tv_nsec / 1000;
+
+  // queuing happened before we got here; it starts the trace off
+  const timespec &queued = transport->getQueueTime();
+  if (queued.tv_sec) {
+    int64 wait = gettime_diff_us(queued, data->start);
+    data->startEpoch -= wait;
+    data->start = queued;
+    AddSpan("queue", "", queued, transport->getWallTime());
+  }
+}
+
+bool RequestTrace::IsTrustedHost(const std::string &host) {
+  return RuntimeOption::TraceTrustedHosts.find(host) !=
+    RuntimeOption::TraceTrustedHosts.end();
+}
+
+bool RequestTrace::Active() {
+  return s_trace.get()->active;
+}
+
+std::string RequestTrace::GetTraceId() {
+  TraceData *data = s_trace.get();
+  return data->active ? data->id : "";
+}
+
+void RequestTrace::AddSpan(const char *name, const std::string &detail,
+                           const timespec &start, const timespec &end) {
+  TraceData *data = s_trace.get();
+  if (!data->active || data->spans.size() >= MaxSpans) return;
+
+  Span span;
+  span.name = name;
+  span.detail = detail;
+  span.start = gettime_diff_us(data->start, start);
+  span.duration = gettime_diff_us(start, end);
+  data->spans.push_back(span);
+}
+
+void RequestTrace::End() {
+  TraceData *data = s_trace.get();
+  if (!data->active) return;
+  data->active = false;
+
+  timespec end;
+  gettime(CLOCK_MONOTONIC, &end);
+  int pid = getpid();
+  int tid = Process::GetThreadPid();
+
+  std::string out = "{\"traceId\":\"";
+  json_escape(out, data->id);
+  out += "\",\"url\":\"";
+  json_escape(out, data->url);
+  out += "\",\"traceEvents\":[";
+  char buf[256];
+  snprintf(buf, sizeof(buf),
+           "{\"name\":\"request\",\"ph\":\"X\",\"ts\":%lld,\"dur\":%lld,"
+           "\"pid\":%d,\"tid\":%d}",
+           data->startEpoch, gettime_diff_us(data->start, end), pid, tid);
+  out += buf;
+  for (unsigned int i = 0; i < data->spans.size(); i++) {
+    const Span &span = data->spans[i];
+    out += ",{\"name\":\"";
+    json_escape(out, span.name);
+    snprintf(buf, sizeof(buf),
+             "\",\"ph\":\"X\",\"ts\":%lld,\"dur\":%lld,"
+             "\"pid\":%d,\"tid\":%d",
+             data->startEpoch + span.start, span.duration, pid, tid);
+    out += buf;
+    if (!span.detail.empty()) {
+      out += ",\"args\":{\"detail\":\"";
+      json_escape(out, span.detail);
+      out += "\"}";
+    }
+    out += "}";
+  }
+  out += "]}";
+  data->spans.clear();
+
+  Lock lock(s_recent_mutex);
+  if (!RuntimeOption::TraceFile.empty()) {
+    if (!s_file) {
+      s_file = fopen(RuntimeOption::TraceFile.c_str(), "a");
+      if (!s_file) {
+        Logger::Error("Unable to open trace file %s",
+                      RuntimeOption::TraceFile.c_str());
+        RuntimeOption::TraceFile.clear();
+      }
+    }
+    if (s_file) {
+      fprintf(s_file, "%s\n", out.c_str());
+      fflush(s_file);
+    }
+  }
+  s_recent.push_back(out);
+  while ((int)s_recent.size() > RuntimeOption::TraceKeepRecent) {
+    s_recent.pop_front();
+  }
+}
+
+std::string RequestTrace::GetRecent(int count) {
+  Lock lock(s_recent_mutex);
+  std::string out = "[";
+  int first = (int)s_recent.size() - count;
+  if (first < 0) first = 0;
+  for (int i = first; i < (int)s_recent.size(); i++) {
+    if (i > first) out += ",\n";
+    out += s_recent[i];
+  }
+  out += "]\n";
+  return out;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+TraceSpan::TraceSpan(const char *name, const char *detail /* = NULL */)
+  : m_name(name), m_active(RequestTrace::Active()) {
+  if (m_active) {
+    if (detail) m_detail = detail;
+    gettime(CLOCK_MONOTONIC, &m_start);
+  }
+}
+
+TraceSpan::~TraceSpan() {
+  if (m_active) {
+    timespec end;
+    gettime(CLOCK_MONOTONIC, &end);
+    RequestTrace::AddSpan(m_name, m_detail, m_start, end);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+}
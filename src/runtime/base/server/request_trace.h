@@ -0,0 +1,96 @@
+/*
+   +----------------------------------------------------------------------+
+   | HipHop for PHP                                                       |
+   +----------------------------------------------------------------------+
+   | Copyright (c) 2010- Facebook, Inc. (http://www.facebook.com)         |
+   +----------------------------------------------------------------------+
+   | This source file is subject to version 3.01 of the PHP license,      |
+   | that is bundled with this package in the file LICENSE, and is        |
+   | available through the world-wide-web at the following url:           |
+   | http://www.php.net/license/3_01.txt                                  |
+   | If you did not receive a copy of the PHP license and are unable to   |
+   | obtain it through the world-wide-web, please send a note to          |
+   | license@php.net so we can mail you a copy immediately.               |
+   +----------------------------------------------------------------------+
+*/
+
+#ifndef __HPHP_REQUEST_TRACE_H__
+#define __HPHP_REQUEST_TRACE_H__
+
+#include <runtime/base/types.h>
+#include <util/timer.h>
+
+namespace HPHP {
+///////////////////////////////////////////////////////////////////////////////
+
+class Transport;
+
+/**
+ * Span-based tracing of single requests. A sampled request collects timed
+ * spans in a thread-local buffer as it goes through input, reqinit, invoke,
+ * I/O calls and so on, and the whole trace is written out in Chrome's trace
+ * event JSON format when the request ends.
+ */
+class RequestTrace {
+public:
+  static const char *HeaderName;
+
+  /**
+   * Starts tracing this request if it is sampled, or if a trusted caller
+   * passed a well-formed trace id in. Time spent queuing counts as the first
+   * span.
+   */
+  static void Begin(Transport *transport);
+  static void End();
+
+  static bool Active();
+
+  /**
+   * Whether a host is in Stats.Trace.TrustedHosts: we take trace ids from it
+   * and pass ours on to it.
+   */
+  static bool IsTrustedHost(const std::string &host);
+
+  /**
+   * Trace id of the current request, to pass on to pagelets, xbox messages
+   * and curl calls. Empty if the request isn't traced.
+   */
+  static std::string GetTraceId();
+
+  static void AddSpan(const char *name, const std::string &detail,
+                      const timespec &start, const timespec &end);
+
+  /**
+   * Last few traces as a JSON array, most recent last.
+   */
+  static std::string GetRecent(int count);
+};
+
+/**
+ * Tracing a whole request in a scoped manner.
+ */
+class RequestTraceScope {
+public:
+  RequestTraceScope(Transport *transport) { RequestTrace::Begin(transport);}
+  ~RequestTraceScope() { RequestTrace::End();}
+};
+
+/**
+ * Recording a span of the current request's trace in a scoped manner.
+ */
+class TraceSpan {
+public:
+  TraceSpan(const char *name, const char *detail = NULL);
+  ~TraceSpan();
+
+private:
+  const char *m_name;
+  std::string m_detail;
+  timespec m_start;
+  bool m_active;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+}
+
+#endif // __HPHP_REQUEST_TRACE_H__
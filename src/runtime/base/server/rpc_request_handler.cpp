@@ -70,6 +70,7 @@ void RPCRequestHandler::handleRequest(Transport *transport) {
   m_context->setTransport(transport);
   transport->enableCompression();
 
+  RequestTraceScope trace(transport);
   ServerStatsHelper ssh("all", ServerStatsHelper::TRACK_MEMORY);
   Logger::Verbose("receiving %s", transport->getCommand().c_str());
 
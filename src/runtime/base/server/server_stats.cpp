@@ -1230,7 +1230,7 @@ Array ServerStats::getThreadIOStatuses() {
 
 ServerStatsHelper::ServerStatsHelper(const char *section,
                                      uint32 track /* = false */)
-  : m_section(section), m_instStart(0), m_track(track) {
+  : m_section(section), m_span(section), m_instStart(0), m_track(track) {
   if (RuntimeOption::EnableStats && RuntimeOption::EnableWebStats) {
     gettime(CLOCK_MONOTONIC, &m_wallStart);
     gettime(CLOCK_THREAD_CPUTIME_ID, &m_cpuStart);
@@ -1277,7 +1277,7 @@ void ServerStatsHelper::logTime(const std::string &prefix,
 IOStatusHelper::IOStatusHelper(const char *name,
                                const char *address /* = NULL */,
                                int port /* = 0 */)
-    : m_exeProfiler(ThreadInfo::NetworkIO) {
+    : m_exeProfiler(ThreadInfo::NetworkIO), m_span(name, address) {
   ASSERT(name && *name);
 
   if (ServerStats::s_profile_network ||
@@ -23,6 +23,7 @@
 #include <time.h>
 #include <runtime/base/shared/shared_string.h>
 #include <runtime/base/types.h>
+#include <runtime/base/server/request_trace.h>
 
 namespace HPHP {
 ///////////////////////////////////////////////////////////////////////////////
@@ -211,6 +212,7 @@ public:
 
 private:
   const char *m_section;
+  TraceSpan m_span;
   timespec m_wallStart;
   timespec m_cpuStart;
   int64 m_instStart;
@@ -232,6 +234,7 @@ public:
 
 private:
   ExecutionProfiler m_exeProfiler;
+  TraceSpan m_span;
 };
 
 /**
@@ -0,0 +1,197 @@
+/*
+   +----------------------------------------------------------------------+
+   | HipHop for PHP                                                       |
+   +----------------------------------------------------------------------+
+   | Copyright (c) 2010- Facebook, Inc. (http://www.facebook.com)         |
+   +----------------------------------------------------------------------+
+   | This source file is subject to version 3.01 of the PHP license,      |
+   | that is bundled with this package in the file LICENSE, and is        |
+   | available through the world-wide-web at the following url:           |
+   | http://www.php.net/license/3_01.txt                                  |
+   | If you did not receive a copy of the PHP license and are unable to   |
+   | obtain it through the world-wide-web, please send a note to          |
+   | license@php.net so we can mail you a copy immediately.               |
+   +----------------------------------------------------------------------+
+*/
+
+#include <runtime/base/server/takeover_state.h>
+#include <runtime/base/shared/shared_store_base.h>
+#include <runtime/base/program_functions.h>
+#include <runtime/base/runtime_option.h>
+#include <runtime/eval/runtime/file_repository.h>
+#include <util/lock.h>
+#include <util/logger.h>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+
+/*
+The state file is plain text up to the APC section, which is a sequence of
+binary records as written by SharedStore::snapshot():
+
+  HPHP-TAKEOVER 1
+  files <count>
+  <one loaded file per line>
+  warmup <count>
+  <one warmup request file per line>
+  apc
+  <apc snapshot until end of file>
+
+Files and warmup requests come first since they're small, and because a
+truncated APC section still leaves the new server with a useful prefix.
+*/
+
+#define STATE_HEADER "HPHP-TAKEOVER 1"
+
+namespace HPHP {
+///////////////////////////////////////////////////////////////////////////////
+
+Mutex TakeoverState::s_mutex;
+TakeoverState::Phase TakeoverState::s_phase = TakeoverState::Idle;
+int64 TakeoverState::s_apcCount = 0;
+int TakeoverState::s_fileCount = 0;
+int TakeoverState::s_warmupCount = 0;
+
+void TakeoverState::setPhase(Phase phase) {
+  Lock lock(s_mutex);
+  s_phase = phase;
+}
+
+TakeoverState::Phase TakeoverState::GetPhase() {
+  Lock lock(s_mutex);
+  return s_phase;
+}
+
+std::string TakeoverState::GetStatus() {
+  static const char *names[] = {
+    "idle", "saving", "saved", "loading", "loaded", "failed"
+  };
+  Lock lock(s_mutex);
+  std::ostringstream out;
+  out << names[s_phase] << "\n"
+      << "apc keys: " << s_apcCount << "\n"
+      << "files: " << s_fileCount << "\n"
+      << "warmup requests: " << s_warmupCount << "\n";
+  return out.str();
+}
+
+static void write_list(std::ostream &out, const char *name,
+                       const std::vector<std::string> &items) {
+  out << name << " " << items.size() << "\n";
+  for (unsigned int i = 0; i < items.size(); i++) {
+    out << items[i] << "\n";
+  }
+}
+
+static bool read_list(std::istream &in, const char *name,
+                      std::vector<std::string> &items) {
+  std::string tag;
+  int count = 0;
+  if (!(in >> tag >> count) || tag != name || in.get() != '\n') {
+    return false;
+  }
+  for (int i = 0; i < count; i++) {
+    std::string item;
+    if (!std::getline(in, item)) return false;
+    items.push_back(item);
+  }
+  return true;
+}
+
+bool TakeoverState::Save(const std::string &path) {
+  setPhase(Saving);
+  Logger::Info("takeover: saving state to %s", path.c_str());
+
+  // write to a temp file so a half-written state is never picked up
+  std::string tmp = path + ".tmp";
+  std::ofstream out(tmp.c_str());
+  if (out.fail()) {
+    Logger::Error("takeover: unable to write %s", tmp.c_str());
+    setPhase(Failed);
+    return false;
+  }
+
+  std::vector<std::string> files;
+  if (hhvm) {
+    Eval::FileRepository::getLoadedFileNames(files);
+  }
+
+  hphp_session_init();
+  ExecutionContext *context = hphp_context_init();
+  out << STATE_HEADER << "\n";
+  write_list(out, "files", files);
+  write_list(out, "warmup", RuntimeOption::ServerWarmupRequests);
+  out << "apc\n";
+  int64 apcCount = s_apc_store[0].snapshot(out);
+  hphp_context_exit(context, false);
+  hphp_session_exit();
+
+  out.close();
+  if (out.fail() || rename(tmp.c_str(), path.c_str()) < 0) {
+    Logger::Error("takeover: unable to save state to %s", path.c_str());
+    unlink(tmp.c_str());
+    setPhase(Failed);
+    return false;
+  }
+
+  Lock lock(s_mutex);
+  s_apcCount = apcCount;
+  s_fileCount = files.size();
+  s_warmupCount = RuntimeOption::ServerWarmupRequests.size();
+  s_phase = Saved;
+  Logger::Info("takeover: saved %lld apc keys, %d files",
+               apcCount, s_fileCount);
+  return true;
+}
+
+bool TakeoverState::Load(const std::string &path,
+                         std::vector<std::string> &warmupRequests) {
+  setPhase(Loading);
+  Logger::Info("takeover: loading state from %s", path.c_str());
+
+  std::ifstream in(path.c_str());
+  std::string header;
+  std::vector<std::string> files;
+  std::vector<std::string> warmup;
+  std::string apcTag;
+  if (!std::getline(in, header) || header != STATE_HEADER ||
+      !read_list(in, "files", files) || !read_list(in, "warmup", warmup) ||
+      !std::getline(in, apcTag) || apcTag != "apc") {
+    Logger::Error("takeover: bad state file %s", path.c_str());
+    setPhase(Failed);
+    return false;
+  }
+
+  for (unsigned int i = 0; i < warmup.size(); i++) {
+    if (std::find(warmupRequests.begin(), warmupRequests.end(), warmup[i]) ==
+        warmupRequests.end()) {
+      warmupRequests.push_back(warmup[i]);
+    }
+  }
+
+  hphp_session_init();
+  ExecutionContext *context = hphp_context_init();
+  int64 apcCount = s_apc_store[0].loadSnapshot(in);
+  int fileCount = 0;
+  if (hhvm) {
+    try {
+      fileCount = Eval::FileRepository::preloadFiles(files);
+    } catch (const Exception &e) {
+      Logger::Error("takeover: preloading files: %s", e.what());
+    }
+  }
+  hphp_context_exit(context, false);
+  hphp_session_exit();
+
+  Lock lock(s_mutex);
+  s_apcCount = apcCount;
+  s_fileCount = fileCount;
+  s_warmupCount = warmup.size();
+  s_phase = Loaded;
+  Logger::Info("takeover: loaded %lld apc keys, %d of %d files",
+               apcCount, fileCount, (int)files.size());
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+}
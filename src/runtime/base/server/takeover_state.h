@@ -0,0 +1,74 @@
+/*
+   +----------------------------------------------------------------------+
+   | HipHop for PHP                                                       |
+   +----------------------------------------------------------------------+
+   | Copyright (c) 2010- Facebook, Inc. (http://www.facebook.com)         |
+   +----------------------------------------------------------------------+
+   | This source file is subject to version 3.01 of the PHP license,      |
+   | that is bundled with this package in the file LICENSE, and is        |
+   | available through the world-wide-web at the following url:           |
+   | http://www.php.net/license/3_01.txt                                  |
+   | If you did not receive a copy of the PHP license and are unable to   |
+   | obtain it through the world-wide-web, please send a note to          |
+   | license@php.net so we can mail you a copy immediately.               |
+   +----------------------------------------------------------------------+
+*/
+
+#ifndef __HTTP_SERVER_TAKEOVER_STATE_H__
+#define __HTTP_SERVER_TAKEOVER_STATE_H__
+
+#include <runtime/base/types.h>
+#include <util/mutex.h>
+
+namespace HPHP {
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Runtime state handed from a running server to the one taking it over, so
+ * the new process is warm before it accepts its first connection: APC
+ * contents, the files the old server had loaded, and its warmup requests.
+ */
+class TakeoverState {
+public:
+  enum Phase {
+    Idle,
+    Saving,  // old server: writing the state file
+    Saved,
+    Loading, // new server: priming itself from the state file
+    Loaded,
+    Failed,
+  };
+
+  /**
+   * Old server: writes current state to path.
+   */
+  static bool Save(const std::string &path);
+
+  /**
+   * New server: primes APC and the file repository from a file written by
+   * Save(), and adds the old server's warmup requests to warmupRequests.
+   */
+  static bool Load(const std::string &path,
+                   std::vector<std::string> &warmupRequests);
+
+  static Phase GetPhase();
+
+  /**
+   * Human readable progress, for the admin server.
+   */
+  static std::string GetStatus();
+
+private:
+  static Mutex s_mutex;
+  static Phase s_phase;
+  static int64 s_apcCount;
+  static int s_fileCount;
+  static int s_warmupCount;
+
+  static void setPhase(Phase phase);
+};
+
+///////////////////////////////////////////////////////////////////////////////
+}
+
+#endif // __HTTP_SERVER_TAKEOVER_STATE_H__
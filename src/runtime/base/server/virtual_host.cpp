@@ -215,6 +215,20 @@ void VirtualHost::init(Hdf vh) {
     m_queryStringFilters.push_back(filter);
   }
 
+  Hdf pageCache = vh["PageCache"];
+  for (Hdf hdf = pageCache.firstChild(); hdf.exists(); hdf = hdf.next()) {
+    PageCacheRule rule;
+    rule.pattern = Util::format_pattern(hdf["url"].getString(""), true);
+    rule.ttl = hdf["ttl"].getInt32(0);
+    rule.stale = hdf["stale"].getInt32(0);
+    hdf["vary"].get(rule.varyHeaders);
+    hdf["exclude_cookies"].get(rule.excludeCookies);
+    if (rule.ttl <= 0) {
+      throw InvalidArgumentException("page cache rule", "(ttl must be > 0)");
+    }
+    m_pageCacheRules.push_back(rule);
+  }
+
   vh["ServerVariables"].get(m_serverVars);
   m_serverName = vh["ServerName"].getString();
 }
@@ -402,5 +416,25 @@ std::string VirtualHost::filterUrl(const std::string &url) const {
   return url;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// full-page cache rules
+
+const VirtualHost::PageCacheRule *
+VirtualHost::getPageCacheRule(const std::string &url) const {
+  for (unsigned int i = 0; i < m_pageCacheRules.size(); i++) {
+    const PageCacheRule &rule = m_pageCacheRules[i];
+    if (rule.pattern.empty()) {
+      return &rule;
+    }
+    Variant ret = preg_match(String(rule.pattern.c_str(), rule.pattern.size(),
+                                    AttachLiteral),
+                             String(url.c_str(), url.size(), AttachLiteral));
+    if (ret.toInt64() > 0) {
+      return &rule;
+    }
+  }
+  return NULL;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 }
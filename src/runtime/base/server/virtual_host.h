@@ -64,6 +64,17 @@ public:
   bool hasLogFilter() const { return !m_queryStringFilters.empty();}
   std::string filterUrl(const std::string &url) const;
 
+  // full-page cache rules
+  struct PageCacheRule {
+    std::string pattern;                     // matching URLs
+    int ttl;                                 // seconds a page stays fresh
+    int stale;                               // seconds it may be served stale
+    std::vector<std::string> varyHeaders;    // request headers in cache key
+    std::vector<std::string> excludeCookies; // never cache if any is present
+  };
+  bool hasPageCacheRule() const { return !m_pageCacheRules.empty();}
+  const PageCacheRule *getPageCacheRule(const std::string &url) const;
+
 private:
   struct RewriteCond {
     enum Type {
@@ -112,6 +123,7 @@ private:
   std::vector<RewriteRule> m_rewriteRules;
   IpBlockMapPtr m_ipBlocks;
   std::vector<QueryStringFilter> m_queryStringFilters;
+  std::vector<PageCacheRule> m_pageCacheRules;
 
   VhostRuntimeOption m_runtimeOption;
 };
@@ -20,6 +20,8 @@
 #include <runtime/base/server/satellite_server.h>
 #include <runtime/base/util/libevent_http_client.h>
 #include <runtime/base/server/job_queue_vm_stack.h>
+#include <runtime/base/server/server_stats.h>
+#include <runtime/base/server/request_trace.h>
 #include <runtime/ext/ext_json.h>
 #include <util/job_queue.h>
 #include <util/lock.h>
@@ -37,6 +39,8 @@ public:
 
     m_message.append(message.data(), message.size());
     m_reqInitDoc.append(reqInitDoc.data(), reqInitDoc.size());
+    m_traceId = RequestTrace::GetTraceId();
+    m_threadType = XboxThread;
     disableCompression(); // so we don't have to decompress during sendImpl()
   }
 
@@ -67,6 +71,7 @@ public:
   virtual std::string getHeader(const char *name) {
     if (!strcasecmp(name, "Host")) return m_host;
     if (!strcasecmp(name, "ReqInitDoc")) return m_reqInitDoc;
+    if (!strcasecmp(name, RequestTrace::HeaderName)) return m_traceId;
     return "";
   }
   virtual void getHeaders(HeaderMap &headers) {
@@ -139,6 +144,7 @@ private:
   string m_response;
   int m_code;
   string m_host;
+  string m_traceId;
   string m_reqInitDoc;
 };
 
@@ -243,6 +249,149 @@ static bool isLocalHost(CStrRef host) {
   return host.empty() || host == "localhost" || host == "127.0.0.1";
 }
 
+/**
+ * Per-destination state for remote xbox calls: bounds how many messages can
+ * be in flight to one host at a time, so a slow peer can't soak up every
+ * request thread and every pooled connection.
+ */
+class XboxDestination : public Synchronizable {
+public:
+  XboxDestination() : m_inflight(0) {}
+
+  /**
+   * Takes a slot in the window, waiting up to timeoutSeconds for one to
+   * free up; 0 means don't wait.
+   */
+  bool acquire(int maxInFlight, int timeoutSeconds) {
+    Lock lock(this);
+    if (maxInFlight > 0) {
+      while (m_inflight >= maxInFlight) {
+        if (timeoutSeconds <= 0 || !wait(timeoutSeconds)) {
+          return false;
+        }
+      }
+    }
+    ++m_inflight;
+    return true;
+  }
+
+  void release() {
+    Lock lock(this);
+    --m_inflight;
+    notify();
+  }
+
+  int getInFlight() const { return m_inflight; }
+
+private:
+  int m_inflight;
+};
+
+static Mutex s_destinations_mutex;
+static hphp_string_map<XboxDestination*> s_destinations;
+
+static XboxDestination *getDestination(const string &host, int port) {
+  string key = host + ':' + lexical_cast<string>(port);
+  Lock lock(s_destinations_mutex);
+  XboxDestination *&dest = s_destinations[key];
+  if (!dest) {
+    dest = new XboxDestination();
+    if (RuntimeOption::XboxConnectionPoolSize > 0) {
+      // keep-alive connections to this host go back into the evhttp pool
+      LibEventHttpClient::SetCache(host, port,
+                                   RuntimeOption::XboxConnectionPoolSize);
+    }
+  }
+  return dest;
+}
+
+/**
+ * Splits "host:port" or "[ipv6]:port" into address and port, leaving port
+ * alone when none is given. A bare IPv6 address has more than one colon
+ * and is taken whole.
+ */
+static void splitHostPort(const string &host, string &addr, int &port) {
+  if (!host.empty() && host[0] == '[') {
+    size_t close = host.find(']');
+    if (close != string::npos) {
+      addr = host.substr(1, close - 1);
+      if (close + 1 < host.size() && host[close + 1] == ':') {
+        port = atoi(host.c_str() + close + 2);
+      }
+      return;
+    }
+  }
+  size_t colon = host.find(':');
+  if (colon != string::npos && host.find(':', colon + 1) == string::npos) {
+    addr = host.substr(0, colon);
+    port = atoi(host.c_str() + colon + 1);
+    return;
+  }
+  addr = host;
+}
+
+/**
+ * Sends a message to the xbox server on a remote host, reusing a pooled
+ * keep-alive connection when one is idle. The host may name a port
+ * ("host:port" or "[ipv6]:port"); otherwise Xbox.ServerInfo.Port is used. Returns false if
+ * the message got no HTTP response, with code set to 503 when the in-flight
+ * window stayed full and 502 when the peer couldn't be reached, and
+ * response holding the reason. Otherwise code and response hold the HTTP
+ * result.
+ */
+static bool sendRemote(CStrRef host, const string &url, CStrRef message,
+                       int timeoutSeconds, int &code, String &response) {
+  string hostStr;
+  int port = RuntimeOption::XboxServerPort;
+  splitHostPort(host.data(), hostStr, port);
+  XboxDestination *dest = getDestination(hostStr, port);
+
+  ServerStats::Log("xbox.remote.requests", 1);
+  if (!dest->acquire(RuntimeOption::XboxConnectionPoolMaxInFlight,
+                     timeoutSeconds)) {
+    ServerStats::Log("xbox.remote.window_full", 1);
+    code = 503;
+    response = "too many messages in flight to " + string(host.data());
+    return false;
+  }
+
+  timespec start;
+  gettime(CLOCK_MONOTONIC, &start);
+
+  bool ret = false;
+  vector<string> headers;
+  std::string traceId = RequestTrace::GetTraceId();
+  if (!traceId.empty()) {
+    headers.push_back(string(RequestTrace::HeaderName) + ": " + traceId);
+  }
+  LibEventHttpClientPtr http = LibEventHttpClient::Get(hostStr, port);
+  if (http->getRequests() > 0) {
+    ServerStats::Log("xbox.remote.reused", 1);
+  }
+  if (http->send(url, headers, timeoutSeconds, false,
+                 message.data(), message.size())) {
+    code = http->getCode();
+    if (code > 0) {
+      int len = 0;
+      char *data = http->recv(len);
+      response = String(data, len, AttachString);
+      ret = true;
+    }
+  }
+  http->release();
+  dest->release();
+
+  timespec end;
+  gettime(CLOCK_MONOTONIC, &end);
+  ServerStats::Log("xbox.remote.latency_us", gettime_diff_us(start, end));
+  if (!ret) {
+    ServerStats::Log("xbox.remote.errors", 1);
+    code = 502;
+    response = "no response from " + string(host.data());
+  }
+  return ret;
+}
+
 bool XboxServer::SendMessage(CStrRef message, Variant &ret, int timeout_ms,
                              CStrRef host /* = "localhost" */) {
   if (isLocalHost(host)) {
@@ -287,29 +436,20 @@ bool XboxServer::SendMessage(CStrRef message, Variant &ret, int timeout_ms,
       timeoutSeconds = RuntimeOption::XboxDefaultRemoteTimeoutSeconds;
     }
 
-    string hostStr(host.data());
-    vector<string> headers;
-    LibEventHttpClientPtr http =
-      LibEventHttpClient::Get(hostStr, RuntimeOption::XboxServerPort);
-    if (http->send(url, headers, timeoutSeconds, false,
-                   message.data(), message.size())) {
-      int code = http->getCode();
-      if (code > 0) {
-        int len = 0;
-        char *response = http->recv(len);
-        String sresponse(response, len, AttachString);
-        ret.set("code", code);
-        if (code == 200) {
-          ret.set("response", f_unserialize(sresponse));
-        } else {
-          ret.set("error", sresponse);
-        }
-        return true;
+    int code = 0;
+    String sresponse;
+    if (sendRemote(host, url, message, timeoutSeconds, code, sresponse)) {
+      ret.set("code", code);
+      if (code == 200) {
+        ret.set("response", f_unserialize(sresponse));
+      } else {
+        ret.set("error", sresponse);
       }
-      // code wasn't correctly set by http client, treat it as not found
-      ret.set("code", 404);
-      ret.set("error", "http client failed");
+      return true;
     }
+    // the peer never answered: report why, not a status it didn't send
+    ret.set("code", code);
+    ret.set("error", sresponse);
   }
 
   return false;
@@ -335,20 +475,11 @@ bool XboxServer::PostMessage(CStrRef message,
     url += host.data();
     url += "/xbox_post_message";
 
-    vector<string> headers;
-    string hostStr(host.data());
-    LibEventHttpClientPtr http =
-      LibEventHttpClient::Get(hostStr, RuntimeOption::XboxServerPort);
-    if (http->send(url, headers, 0, false, message.data(), message.size())) {
-      int code = http->getCode();
-      if (code > 0) {
-        int len = 0;
-        char *response = http->recv(len);
-        String sresponse(response, len, AttachString);
-        if (code == 200 && same(f_unserialize(sresponse), true)) {
-          return true;
-        }
-      }
+    int code = 0;
+    String sresponse;
+    if (sendRemote(host, url, message, 0, code, sresponse) &&
+        code == 200 && same(f_unserialize(sresponse), true)) {
+      return true;
     }
   }
 
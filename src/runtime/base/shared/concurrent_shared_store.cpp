@@ -618,5 +618,41 @@ void ConcurrentTableSharedStore::dump(std::ostream & out, bool keyOnly,
   }
 }
 
+int64 ConcurrentTableSharedStore::snapshot(std::ostream &out) {
+  // Same locking as dump(): readers keep going, writers wait for us.
+  WriteLock l(m_lock);
+  int64 count = 0;
+  time_t now = time(NULL);
+  for (Map::iterator iter = m_vars.begin(); iter != m_vars.end(); ++iter) {
+    const StoreValue *sval = &iter->second;
+    // A ttl of 0 means "never expires" on reload, so anything that has
+    // run out by now (even if expired() hasn't noticed yet) is dropped.
+    int64 ttl = sval->expiry ? sval->expiry - now : 0;
+    if (sval->expired() || (sval->expiry && ttl <= 0)) continue;
+    Variant value;
+    if (sval->inMem()) {
+      value = sval->var->toLocal();
+    } else {
+      ASSERT(sval->inFile());
+      String s(sval->sAddr, sval->getSerializedSize(), AttachLiteral);
+      value = apc_unserialize(s);
+    }
+    String valS;
+    try {
+      VariableSerializer vs(VariableSerializer::Serialize);
+      valS = vs.serialize(value, true);
+    } catch (const Exception &) {
+      continue; // not everything in apc can be serialized
+    }
+    const char *key = iter->first;
+    int keyLen = strlen(key);
+    out << keyLen << " " << ttl << " " << valS.size() << "\n";
+    out.write(key, keyLen);
+    out.write(valS.data(), valS.size());
+    count++;
+  }
+  return count;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 }
@@ -59,6 +59,7 @@ public:
 
   // debug support
   virtual void dump(std::ostream & out, bool keyOnly, int waitSeconds);
+  virtual int64 snapshot(std::ostream &out);
 
 protected:
   virtual SharedVariant* construct(CVarRef v) {
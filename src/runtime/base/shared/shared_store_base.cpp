@@ -66,6 +66,29 @@ bool SharedStore::erase(CStrRef key, bool expired /* = false */) {
   return success;
 }
 
+int64 SharedStore::loadSnapshot(std::istream &in) {
+  int64 count = 0;
+  int keyLen, valLen;
+  int64 ttl;
+  while (in >> keyLen >> ttl >> valLen && in.get() == '\n') {
+    if (keyLen <= 0 || valLen <= 0) {
+      Logger::Error("Bad entry in apc snapshot after %lld keys", count);
+      break;
+    }
+    std::string key(keyLen, '\0');
+    std::string value(valLen, '\0');
+    if (!in.read(&key[0], keyLen) || !in.read(&value[0], valLen)) {
+      Logger::Error("Truncated apc snapshot after %lld keys", count);
+      break;
+    }
+    Variant v = f_unserialize(String(value.data(), valLen, AttachLiteral));
+    if (store(String(key.data(), keyLen, AttachLiteral), v, ttl, false)) {
+      count++;
+    }
+  }
+  return count;
+}
+
 void StoreValue::set(SharedVariant *v, int64 ttl) {
   var = v;
   expiry = ttl ? time(NULL) + ttl : 0;
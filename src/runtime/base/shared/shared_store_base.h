@@ -113,6 +113,14 @@ public:
     /* Default does nothing*/
   }
 
+  // takeover support: write all live entries to a stream another process can
+  // load back, returning how many entries were written or loaded
+  virtual int64 snapshot(std::ostream &out) {
+    /* Default writes nothing */
+    return 0;
+  }
+  int64 loadSnapshot(std::istream &in);
+
 protected:
   int m_id;
 
@@ -23,6 +23,7 @@
 
 #include "util/trace.h"
 #include "util/logger.h"
+#include "util/atomic.h"
 #include "runtime/base/runtime_option.h"
 #include "runtime/vm/translator/hooks.h"
 
@@ -411,7 +412,7 @@ StatCache::NodePtr StatCache::Node::getChild(const std::string& childName,
 
 StatCache::StatCache()
   : m_lock(false /*reentrant*/, RankStatCache), m_ifd(-1),
-    m_lastRefresh(time(NULL)) {
+    m_lastRefresh(time(NULL)), m_generation(0) {
 }
 
 StatCache::~StatCache() {
@@ -640,6 +641,7 @@ void StatCache::refresh() {
       TRACE(1, "StatCache: refresh time %lu\n", (unsigned long)m_lastRefresh);
       return;
     }
+    atomic_inc(m_generation);
     for (char* p = m_readBuf; p < m_readBuf + nread;) {
       struct inotify_event* event = (struct inotify_event*) p;
       if (handleEvent(event)) {
@@ -898,5 +900,10 @@ std::string StatCache::realpath(const char* path) {
   return s_sc.realpathImpl(path);
 }
 
+int64 StatCache::generation() {
+  if (!RuntimeOption::ServerStatCache || s_sc.m_ifd == -1) return -1;
+  return atomic_acquire_load(&s_sc.m_generation);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 }
@@ -95,6 +95,13 @@ class StatCache {
   static std::string readlink(const std::string& path);
   static std::string realpath(const char* path);
 
+  /*
+   * Bumped whenever requestInit() merges file change notifications, so
+   * callers can cache anything derived from the file system and drop it
+   * when this moves.  -1 if changes aren't being tracked at all.
+   */
+  static int64 generation();
+
  private:
   bool init();
   void clear();
@@ -123,6 +130,7 @@ class StatCache {
                                            + NAME_MAX + 1);
   char m_readBuf[kReadBufSize];
   time_t m_lastRefresh; // Used for debugging.
+  int64 m_generation;
   WatchNodeMap m_watch2Node;
   NodePtr m_root;
 };
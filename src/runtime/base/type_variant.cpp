@@ -24,8 +24,10 @@
 #include <runtime/base/runtime_option.h>
 #include <runtime/base/zend/zend_string.h>
 #include <runtime/base/array/array_iterator.h>
+#include <runtime/base/tv_helpers.h>
 #include <util/parser/hphp.tab.hpp>
 #include <runtime/vm/translator/translator-x64.h>
+#include <runtime/vm/class.h>
 #include <runtime/vm/runtime.h>
 #include <system/lib/systemlib.h>
 #include <runtime/ext/ext_collection.h>
@@ -43,6 +45,18 @@ const VarNR INF_varNR(std::numeric_limits<double>::infinity());
 const VarNR NEGINF_varNR(std::numeric_limits<double>::infinity());
 const VarNR NAN_varNR(std::numeric_limits<double>::quiet_NaN());
 
+/**
+ * Declared property of obj that lives at addr, so later objects of the same
+ * class can skip the name lookup.
+ */
+static int findDeclSlot(ObjectData *obj, void *addr) {
+  const VM::Class *cls = obj->getVMClass();
+  for (VM::Slot i = 0; i < cls->numDeclProperties(); i++) {
+    if ((char*)obj + cls->declPropOffset(i) == addr) return i;
+  }
+  return VariableUnserializer::NoSlot;
+}
+
 static void unserializeProp(VariableUnserializer *uns,
                             ObjectData *obj, CStrRef key,
                             CStrRef context, CStrRef realKey,
@@ -3637,10 +3651,26 @@ static void unserializeProp(VariableUnserializer *uns,
                             ObjectData *obj, CStrRef key,
                             CStrRef context, CStrRef realKey,
                             int nProp) {
+  int *slot = NULL;
+  if (hhvm) {
+    const VM::Class *cls = obj->getVMClass();
+    slot = &uns->propSlot(cls, realKey);
+    if (*slot >= 0) {
+      TypedValue *tv = (TypedValue*)((char*)obj + cls->declPropOffset(*slot));
+      if (tv->m_type != KindOfUninit) {
+        tvAsVariant(tv).unserialize(uns);
+        return;
+      }
+    }
+  }
+
   // Do a two-step look up
   int flags = ObjectData::RealPropWrite;
   DataType type;
   void *addr = obj->o_realPropTyped(key, flags, context, &type);
+  if (slot && *slot == VariableUnserializer::UnknownSlot) {
+    *slot = addr ? findDeclSlot(obj, addr) : VariableUnserializer::NoSlot;
+  }
   if (addr) {
     if (UNLIKELY(type != KindOfUnknown)) {
       ASSERT(uns->peek() != 'V' && uns->peek() != 'K');
@@ -3749,7 +3779,9 @@ void Variant::unserialize(VariableUnserializer *uns) {
     }
     break;
   case 's':
-    {
+    if (uns->readingKey()) {
+      operator=(uns->readKeyString());
+    } else {
       String v;
       v.unserialize(uns);
       operator=(v);
@@ -3789,7 +3821,7 @@ void Variant::unserialize(VariableUnserializer *uns) {
 
       Object obj;
       try {
-        obj = create_object_only(clsName);
+        obj = uns->createObject(clsName);
         obj.get()->clearNoDestruct();
       } catch (ClassNotFoundException &e) {
         obj = create_object_only(s_PHP_Incomplete_Class);
@@ -15,6 +15,7 @@
 */
 
 #include <runtime/base/util/http_client.h>
+#include <runtime/base/util/http_connection_pool.h>
 #include <runtime/base/runtime_option.h>
 #include <runtime/base/server/server_stats.h>
 #include <util/timer.h>
@@ -110,7 +111,8 @@ int HttpClient::impl(const char *url, const char *data, int size,
   char error_str[CURL_ERROR_SIZE + 1];
   memset(error_str, 0, sizeof(error_str));
 
-  CURL *cp = curl_easy_init();
+  std::string poolKey = HttpConnectionPool::GetKey(url);
+  CURL *cp = HttpConnectionPool::Acquire(poolKey);
   curl_easy_setopt(cp, CURLOPT_URL,               url);
   curl_easy_setopt(cp, CURLOPT_WRITEFUNCTION,     curl_write);
   curl_easy_setopt(cp, CURLOPT_WRITEDATA,         (void*)this);
@@ -218,12 +220,17 @@ int HttpClient::impl(const char *url, const char *data, int size,
   }
 
   set_curl_statuses(cp, url);
+  HttpConnectionPool::LogTransfer(cp);
 
   if (slist) {
     curl_slist_free_all(slist);
   }
 
-  curl_easy_cleanup(cp);
+  if (!m_username.empty() || !m_proxyUsername.empty()) {
+    // authenticated connections stay bound to these credentials
+    poolKey.clear();
+  }
+  HttpConnectionPool::Release(poolKey, cp);
   return code;
 }
 
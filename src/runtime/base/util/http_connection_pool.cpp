@@ -0,0 +1,196 @@
+/*
+   +----------------------------------------------------------------------+
+   | HipHop for PHP                                                       |
+   +----------------------------------------------------------------------+
+   | Copyright (c) 2010- Facebook, Inc. (http://www.facebook.com)         |
+   +----------------------------------------------------------------------+
+   | This source file is subject to version 3.01 of the PHP license,      |
+   | that is bundled with this package in the file LICENSE, and is        |
+   | available through the world-wide-web at the following url:           |
+   | http://www.php.net/license/3_01.txt                                  |
+   | If you did not receive a copy of the PHP license and are unable to   |
+   | obtain it through the world-wide-web, please send a note to          |
+   | license@php.net so we can mail you a copy immediately.               |
+   +----------------------------------------------------------------------+
+*/
+
+#include <runtime/base/util/http_connection_pool.h>
+#include <runtime/base/runtime_option.h>
+#include <runtime/base/server/server_stats.h>
+#include <util/lock.h>
+#include <util/util.h>
+
+namespace HPHP {
+///////////////////////////////////////////////////////////////////////////////
+
+struct IdleHandle {
+  IdleHandle(CURL *c, time_t t) : cp(c), since(t) {}
+  CURL *cp;
+  time_t since;
+};
+typedef std::deque<IdleHandle> IdleHandleDeque; // oldest first
+
+static Mutex s_mutex;
+static hphp_string_map<IdleHandleDeque> s_idle;
+static time_t s_lastSweep = 0;
+
+/**
+ * Moves handles idle for too long out of idle, into expired.
+ */
+static void expire(IdleHandleDeque &idle, time_t now,
+                   std::vector<CURL*> &expired) {
+  time_t timeout = RuntimeOption::HttpConnectionPoolIdleTimeout;
+  while (!idle.empty() && now - idle.front().since >= timeout) {
+    expired.push_back(idle.front().cp);
+    idle.pop_front();
+  }
+}
+
+static void cleanup(const std::vector<CURL*> &handles) {
+  for (unsigned int i = 0; i < handles.size(); i++) {
+    curl_easy_cleanup(handles[i]);
+  }
+}
+
+/**
+ * Only hosts named in Http.ConnectionPool.Hosts are pooled: a pooled handle
+ * carries state from one caller to the next, which has to be something the
+ * site asked for.
+ */
+static bool configured(const std::string &key) {
+  if (key.empty() || RuntimeOption::HttpConnectionPoolMaxPerHost <= 0) {
+    return false;
+  }
+  size_t begin = key.find("://");
+  size_t end = key.rfind(':');
+  if (begin == std::string::npos || end <= begin + 3) return false;
+  begin += 3;
+  return HttpConnectionPool::IsPooledHost(key.substr(begin, end - begin));
+}
+
+bool HttpConnectionPool::IsPooledHost(const std::string &host) {
+  const std::set<std::string> &hosts = RuntimeOption::HttpConnectionPoolHosts;
+  return hosts.find(Util::toLower(host)) != hosts.end();
+}
+
+std::string HttpConnectionPool::GetKey(const char *url) {
+  const char *p = strstr(url, "://");
+  if (!p) return "";
+  std::string scheme(url, p - url);
+  const char *defaultPort;
+  if (strcasecmp(scheme.c_str(), "http") == 0) {
+    defaultPort = "80";
+  } else if (strcasecmp(scheme.c_str(), "https") == 0) {
+    defaultPort = "443";
+  } else {
+    return "";
+  }
+
+  const char *host = p + 3;
+  const char *end = host + strcspn(host, "/?#");
+  for (const char *q = host; q < end; q++) {
+    if (*q == '@') host = q + 1; // user:password@
+  }
+  if (host == end) return "";
+
+  std::string key = Util::toLower(scheme);
+  key += "://";
+  key += Util::toLower(std::string(host, end - host));
+  if (!memchr(host, ':', end - host) || end[-1] == ']') {
+    key += ':';
+    key += defaultPort;
+  }
+  return key;
+}
+
+CURL *HttpConnectionPool::Acquire(const std::string &key) {
+  if (!configured(key)) {
+    return curl_easy_init();
+  }
+
+  CURL *cp = NULL;
+  std::vector<CURL*> expired;
+  {
+    Lock lock(s_mutex);
+    hphp_string_map<IdleHandleDeque>::iterator iter = s_idle.find(key);
+    if (iter != s_idle.end()) {
+      IdleHandleDeque &idle = iter->second;
+      expire(idle, time(NULL), expired);
+      if (!idle.empty()) {
+        // most recently used, so the least likely to be closed by the server
+        cp = idle.back().cp;
+        idle.pop_back();
+      }
+    }
+  }
+  cleanup(expired);
+
+  if (cp) {
+    ServerStats::Log("http.pool.hit", 1);
+    return cp;
+  }
+  ServerStats::Log("http.pool.miss", 1);
+  return curl_easy_init();
+}
+
+void HttpConnectionPool::Release(const std::string &key, CURL *cp) {
+  int maxPerHost = RuntimeOption::HttpConnectionPoolMaxPerHost;
+  if (!configured(key)) {
+    curl_easy_cleanup(cp);
+    return;
+  }
+
+  // drops the options, and with them any pointers into the last user,
+  // but keeps the connections; cookies outlive a reset, so they go
+  // separately
+  curl_easy_reset(cp);
+  curl_easy_setopt(cp, CURLOPT_COOKIELIST, "ALL");
+
+  std::vector<CURL*> expired;
+  {
+    Lock lock(s_mutex);
+    time_t now = time(NULL);
+    IdleHandleDeque &idle = s_idle[key];
+    expire(idle, now, expired);
+    if ((int)idle.size() < maxPerHost) {
+      idle.push_back(IdleHandle(cp, now));
+      cp = NULL;
+    }
+
+    // hosts we stopped talking to would otherwise keep their handles
+    if (now - s_lastSweep >= RuntimeOption::HttpConnectionPoolIdleTimeout) {
+      s_lastSweep = now;
+      for (hphp_string_map<IdleHandleDeque>::iterator iter = s_idle.begin();
+           iter != s_idle.end(); ++iter) {
+        expire(iter->second, now, expired);
+      }
+    }
+  }
+  if (cp) {
+    expired.push_back(cp);
+  }
+  cleanup(expired);
+}
+
+void HttpConnectionPool::LogTransfer(CURL *cp) {
+  long connects = 0;
+  if (curl_easy_getinfo(cp, CURLINFO_NUM_CONNECTS, &connects) != CURLE_OK ||
+      connects <= 0) {
+    ServerStats::Log("http.pool.reused", 1);
+    return;
+  }
+  ServerStats::Log("http.pool.connect", connects);
+  double seconds = 0;
+  if (curl_easy_getinfo(cp, CURLINFO_CONNECT_TIME, &seconds) == CURLE_OK) {
+    ServerStats::Log("http.pool.connect.us", (int64)(seconds * 1000000));
+  }
+}
+
+int HttpConnectionPool::GetIdleCount(const std::string &key) {
+  Lock lock(s_mutex);
+  hphp_string_map<IdleHandleDeque>::const_iterator iter = s_idle.find(key);
+  return iter == s_idle.end() ? 0 : iter->second.size();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+}
@@ -0,0 +1,76 @@
+/*
+   +----------------------------------------------------------------------+
+   | HipHop for PHP                                                       |
+   +----------------------------------------------------------------------+
+   | Copyright (c) 2010- Facebook, Inc. (http://www.facebook.com)         |
+   +----------------------------------------------------------------------+
+   | This source file is subject to version 3.01 of the PHP license,      |
+   | that is bundled with this package in the file LICENSE, and is        |
+   | available through the world-wide-web at the following url:           |
+   | http://www.php.net/license/3_01.txt                                  |
+   | If you did not receive a copy of the PHP license and are unable to   |
+   | obtain it through the world-wide-web, please send a note to          |
+   | license@php.net so we can mail you a copy immediately.               |
+   +----------------------------------------------------------------------+
+*/
+
+#ifndef __HTTP_CONNECTION_POOL_H__
+#define __HTTP_CONNECTION_POOL_H__
+
+#include <util/base.h>
+#include <curl/curl.h>
+
+namespace HPHP {
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Process wide pool of idle keep-alive connections for outgoing HTTP,
+ * keyed by scheme://host:port. curl keeps the connections it opened inside
+ * the easy handle that opened them, so what we pool is the handle: taking
+ * one out for the same host lets curl skip the connect and handshake.
+ * HttpClient and curl_init() handles share it; LibEventHttpClient pools its
+ * evhttp connections under the same limits.
+ *
+ * Limits come from Http.ConnectionPool: only hosts listed in Hosts are
+ * pooled, with at most MaxPerHost idle handles per key, each dropped after
+ * IdleTimeout seconds without use. Callers must not release handles that
+ * carried credentials or cookies under a key; those are per-caller state
+ * that a reset doesn't fully clear.
+ */
+class HttpConnectionPool {
+public:
+  /**
+   * Pool key for a URL, or "" for anything but http:// and https://.
+   */
+  static std::string GetKey(const char *url);
+
+  /**
+   * Whether Http.ConnectionPool.Hosts lists host.
+   */
+  static bool IsPooledHost(const std::string &host);
+
+  /**
+   * An idle handle last used for key, or a new one. Either way it has no
+   * options set.
+   */
+  static CURL *Acquire(const std::string &key);
+
+  /**
+   * Done with a handle that last talked to key. It is reset and kept for
+   * the next Acquire() if there is room, and cleaned up otherwise.
+   */
+  static void Release(const std::string &key, CURL *cp);
+
+  /**
+   * Logs whether the last transfer on cp had to connect, and how long it
+   * took when it did.
+   */
+  static void LogTransfer(CURL *cp);
+
+  static int GetIdleCount(const std::string &key);
+};
+
+///////////////////////////////////////////////////////////////////////////////
+}
+
+#endif // __HTTP_CONNECTION_POOL_H__
@@ -15,6 +15,7 @@
 */
 
 #include <runtime/base/util/libevent_http_client.h>
+#include <runtime/base/util/http_connection_pool.h>
 #include <runtime/base/server/server_stats.h>
 #include <runtime/base/runtime_option.h>
 #include <util/compression.h>
@@ -66,41 +67,52 @@ void LibEventHttpClient::SetCache(const std::string &address, int port,
   string hash = get_hash(address, port);
 
   WriteLock lock(ConnectionPoolMutex);
-  if (maxConnection > 0) {
-    ConnectionPoolConfig[hash] = maxConnection;
-  } else {
-    ConnectionPoolConfig.erase(hash);
-  }
+  ConnectionPoolConfig[hash] = maxConnection;
 }
 
 LibEventHttpClientPtr LibEventHttpClient::Get(const std::string &address,
                                               int port) {
   string hash = get_hash(address, port);
 
-  int maxConnection = 0;
+  // hosts without evhttp_set_cache() share Http.ConnectionPool's limit, if
+  // they are listed there
+  int maxConnection = HttpConnectionPool::IsPooledHost(address) ?
+    RuntimeOption::HttpConnectionPoolMaxPerHost : 0;
   {
     ReadLock lock(ConnectionPoolMutex);
     std::map<string, int>::const_iterator iter =
       ConnectionPoolConfig.find(hash);
-    if (iter == ConnectionPoolConfig.end()) {
-      // not configured to cache
-      ServerStats::Log("evhttp.skip", 1);
-      ServerStats::Log("evhttp.skip." + hash, 1);
-      return LibEventHttpClientPtr(new LibEventHttpClient(address, port));
+    if (iter != ConnectionPoolConfig.end()) {
+      maxConnection = iter->second;
     }
-    maxConnection = iter->second;
+  }
+  if (maxConnection <= 0) {
+    // not configured to cache
+    ServerStats::Log("evhttp.skip", 1);
+    ServerStats::Log("evhttp.skip." + hash, 1);
+    return LibEventHttpClientPtr(new LibEventHttpClient(address, port));
   }
 
   WriteLock lock(ConnectionPoolMutex);
   LibEventHttpClientPtrVec &pool = ConnectionPool[hash];
-  for (unsigned int i = 0; i < pool.size(); i++) {
+  time_t now = time(NULL);
+  for (unsigned int i = 0; i < pool.size(); ) {
     LibEventHttpClientPtr client = pool[i];
-    if (!client->m_busy) {
-      client->m_busy = true;
-      ServerStats::Log("evhttp.hit", 1);
-      ServerStats::Log("evhttp.hit." + hash, 1);
-      return client;
+    if (client->m_busy) {
+      i++;
+      continue;
+    }
+    if (now - client->m_lastUsed >=
+        RuntimeOption::HttpConnectionPoolIdleTimeout) {
+      // the server has likely closed it by now
+      pool.erase(pool.begin() + i);
+      continue;
     }
+    client->m_busy = true;
+    ServerStats::Log("evhttp.hit", 1);
+    ServerStats::Log("evhttp.hit." + hash, 1);
+    ServerStats::Log("http.pool.hit", 1);
+    return client;
   }
 
   LibEventHttpClientPtr ret(new LibEventHttpClient(address, port));
@@ -112,6 +124,7 @@ LibEventHttpClientPtr LibEventHttpClient::Get(const std::string &address,
   }
   ServerStats::Log("evhttp.miss", 1);
   ServerStats::Log("evhttp.miss." + hash, 1);
+  ServerStats::Log("http.pool.miss", 1);
   return ret;
 }
 
@@ -119,7 +132,8 @@ LibEventHttpClientPtr LibEventHttpClient::Get(const std::string &address,
 // constructor and destructor
 
 LibEventHttpClient::LibEventHttpClient(const std::string &address, int port)
-  : m_busy(true), m_address(address), m_port(port), m_requests(0),
+  : m_busy(true), m_lastUsed(0), m_address(address), m_port(port),
+    m_requests(0),
     m_conn(NULL), m_thread(NULL), m_code(0), m_response(NULL), m_len(0) {
   m_eventBase = event_base_new();
 }
@@ -156,6 +170,7 @@ void LibEventHttpClient::clear() {
 
 void LibEventHttpClient::release() {
   clear();
+  m_lastUsed = time(NULL);
   m_busy = false;
 }
 
@@ -29,13 +29,15 @@ namespace HPHP {
  * Use evhttp as our HTTP client. This isn't the same as HttpClient that's CURL
  * based. HttpClient supports SSL and follows redirections, whereas this class
  * doesn't. But this class allows keep-alive connections to be pooled for
- * repetitively HTTP requests.
+ * repetitively HTTP requests, up to Http.ConnectionPool's limits unless
+ * SetCache() says otherwise for a host.
  */
 DECLARE_BOOST_TYPES(LibEventHttpClient);
 class LibEventHttpClient {
 public:
   /**
-   * Specify an address:port to be cached. Set to 0 to clear it.
+   * Specify how many connections to address:port to keep. Set to 0 to not
+   * pool them at all.
    */
   static void SetCache(const std::string &address, int port,
                        int maxConnection);
@@ -93,6 +95,7 @@ public:
 
 private:
   bool m_busy;               // telling connection pool this object is in use
+  time_t m_lastUsed;         // when release() last returned it to the pool
   std::string m_address;     // server address
   unsigned short m_port;     // server port
   int m_requests;            // number of requests we've sent on this conn.
@@ -253,8 +253,31 @@ void StringBuffer::appendJsonEscape(const char *s, int len, int options) {
     int start = size();
     append('"');
 
+    // characters the switch below may escape, for copying runs of the rest
+    char stops[9];
+    int nstops = 0;
+    stops[nstops++] = '"';
+    stops[nstops++] = '\\';
+    if (!(options & k_JSON_UNESCAPED_SLASHES)) stops[nstops++] = '/';
+    if (options & (k_JSON_HEX_TAG | k_JSON_FB_EXTRA_ESCAPES)) {
+      stops[nstops++] = '<';
+    }
+    if (options & k_JSON_HEX_TAG) stops[nstops++] = '>';
+    if (options & k_JSON_HEX_AMP) stops[nstops++] = '&';
+    if (options & k_JSON_HEX_APOS) stops[nstops++] = '\'';
+    if (options & k_JSON_FB_EXTRA_ESCAPES) {
+      stops[nstops++] = '@';
+      stops[nstops++] = '%';
+    }
+
     UTF8To16Decoder decoder(s, len, options & k_JSON_FB_LOOSE);
     for (;;) {
+      int run = decoder.asciiRun(stops, nstops);
+      if (run) {
+        append(decoder.current(), run);
+        decoder.skip(run);
+      }
+
       int c = decoder.decode();
       if (c == UTF8_END) {
         append('"');
@@ -42,7 +42,7 @@ VariableSerializer::VariableSerializer(Type type, int option /* = 0 */,
                                        int maxRecur /* = 3 */)
   : m_type(type), m_option(option), m_buf(NULL), m_indent(0),
     m_valueCount(0), m_referenced(false), m_refCount(1), m_maxCount(maxRecur),
-    m_levelDebugger(0) {
+    m_levelDebugger(0), m_streaming(false) {
   m_maxLevelDebugger = g_context->getDebuggerPrintLevel();
   if (type == Serialize || type == APCSerialize || type == DebuggerSerialize) {
     m_arrayIds = new PointerCounterMap();
@@ -69,7 +69,9 @@ void VariableSerializer::setResourceInfo(CStrRef rsrcName, int rsrcId) {
   m_rsrcId = rsrcId;
 }
 
-String VariableSerializer::serialize(CVarRef v, bool ret) {
+String VariableSerializer::serialize(CVarRef v, bool ret,
+                                     bool stream /* = false */) {
+  ASSERT(!ret || !stream);
   StringBuffer buf;
   m_buf = &buf;
   if (ret) {
@@ -77,8 +79,10 @@ String VariableSerializer::serialize(CVarRef v, bool ret) {
   } else {
     buf.setOutputLimit(StringData::MaxSize);
   }
+  m_streaming = stream;
   m_valueCount = 1;
   write(v);
+  m_streaming = false;
   if (ret) {
     return m_buf->detach();
   } else {
@@ -739,6 +743,10 @@ void VariableSerializer::writeArrayValue(CVarRef value) {
 
   ArrayInfo &info = m_arrayInfos.back();
   info.first_element = false;
+
+  if (m_streaming && m_buf->size() >= OutputChunkSize) {
+    g_context->write(m_buf->detach());
+  }
 }
 
 void VariableSerializer::writeArrayFooter() {
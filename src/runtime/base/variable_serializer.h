@@ -58,9 +58,11 @@ public:
   }
 
   /**
-   * Top level entry function called by f_ functions.
+   * Top level entry function called by f_ functions. With stream (only
+   * without ret), the output is written out in chunks of OutputChunkSize
+   * bytes as it is built instead of all at once at the end.
    */
-  String serialize(CVarRef v, bool ret);
+  String serialize(CVarRef v, bool ret, bool stream = false);
   String serializeValue(CVarRef v, bool limit);
 
   // Serialize with limit size of output, always return the serialized string.
@@ -123,6 +125,9 @@ private:
   int m_maxCount;                // for max recursive levels
   int m_levelDebugger;           // keep track of levels for DebuggerSerialize
   int m_maxLevelDebugger;        // for max level of DebuggerSerialize
+  bool m_streaming;              // serialize() with stream, flushing chunks
+
+  static const int OutputChunkSize = 64 * 1024;
 
   struct ArrayInfo {
     bool is_object;     // nested arrays or objects
@@ -17,11 +17,52 @@
 #include <runtime/base/variable_unserializer.h>
 #include <runtime/base/complex_types.h>
 #include <runtime/base/zend/zend_strtod.h>
-
+#include <runtime/base/externals.h>
+#include <runtime/base/util/request_local.h>
+#include <runtime/vm/class.h>
+#include <runtime/vm/instance.h>
+#include <runtime/vm/runtime.h>
+#include <runtime/vm/unit.h>
 
 namespace HPHP {
 ///////////////////////////////////////////////////////////////////////////////
 
+// longer keys are rarely repeated, and cost more to hash than to copy
+static const int MaxInternedKeySize = 128;
+
+/**
+ * Class lookups and property slots shared by every unserialize() in a
+ * request. Neither can change while the request runs.
+ */
+class UnserializeCache : public RequestEventHandler {
+public:
+  virtual void requestInit() {
+    clear();
+  }
+
+  virtual void requestShutdown() {
+    clear();
+  }
+
+  StringIMap<VM::Class*> classes;
+  hphp_hash_map<const VM::Class*, StringMap<int>,
+                pointer_hash<VM::Class> > slots;
+
+private:
+  void clear() {
+    classes.clear();
+    slots.clear();
+  }
+};
+IMPLEMENT_STATIC_REQUEST_LOCAL(UnserializeCache, s_unserialize_cache);
+
+bool VariableUnserializer::HasRefs(const char *str, const char *end) {
+  // "r:" inside string data is a false positive, which only costs the
+  // bookkeeping we would have done anyway
+  size_t len = end > str ? end - str : 0;
+  return memmem(str, len, "r:", 2) || memmem(str, len, "R:", 2);
+}
+
 Variant VariableUnserializer::unserialize() {
   Variant v;
   v.unserialize(this);
@@ -65,6 +106,63 @@ void VariableUnserializer::read(char *buf, uint n) {
   m_buf += BUFFER_LIMIT;
 }
 
+String VariableUnserializer::readKeyString() {
+  const char *start = m_buf;
+  int64 size = readInt();
+  const char *data = m_buf + 2;
+  if (size >= 0 && size <= MaxInternedKeySize && data + size < m_end &&
+      m_buf[0] == ':' && m_buf[1] == '"' && data[size] == '"') {
+    KeySlice slice(data, size);
+    KeyMap::const_iterator iter = m_keys.find(slice);
+    if (iter != m_keys.end()) {
+      m_buf = data + size + 1;
+      return iter->second;
+    }
+    m_buf = start;
+    String s;
+    s.unserialize(this);
+    m_keys[slice] = s;
+    return s;
+  }
+  // let String::unserialize() report whatever is wrong with it
+  m_buf = start;
+  String s;
+  s.unserialize(this);
+  return s;
+}
+
+Object VariableUnserializer::createObject(CStrRef clsName) {
+  if (hhvm) {
+    UnserializeCache *cache = s_unserialize_cache.get();
+    VM::Class *cls;
+    StringIMap<VM::Class*>::const_iterator iter =
+      cache->classes.find(clsName);
+    if (iter != cache->classes.end()) {
+      cls = iter->second;
+    } else {
+      cls = VM::Unit::loadClass(clsName.get());
+      if (!cls) {
+        // not cached: autoloading may still define it later in the request
+        return create_object_only(clsName);
+      }
+      cache->classes[clsName] = cls;
+    }
+    Object obj(VM::newInstance(cls));
+    obj->init();
+    return obj;
+  }
+  return create_object_only(clsName);
+}
+
+int &VariableUnserializer::propSlot(const VM::Class *cls, CStrRef key) {
+  StringMap<int> &slots = s_unserialize_cache->slots[cls];
+  StringMap<int>::iterator iter = slots.find(key);
+  if (iter == slots.end()) {
+    iter = slots.insert(std::make_pair(key, (int)UnknownSlot)).first;
+  }
+  return iter->second;
+}
+
 Variant &VariableUnserializer::addVar() {
   m_vars.push_back(null);
   return m_vars.back();
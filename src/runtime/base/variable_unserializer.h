@@ -18,10 +18,16 @@
 #define __HPHP_VARIABLE_UNSERIALIZER_H__
 
 #include <runtime/base/types.h>
+#include <runtime/base/complex_types.h>
+#include <util/hash.h>
 
 namespace HPHP {
 ///////////////////////////////////////////////////////////////////////////////
 
+namespace VM {
+class Class;
+}
+
 class VariableUnserializer {
 public:
   /**
@@ -36,19 +42,22 @@ public:
   VariableUnserializer(const char *str, size_t len, Type type,
                        bool allowUnknownSerializableClass = false)
       : m_type(type), m_buf(str), m_end(str + len), m_key(false),
-        m_unknownSerializable(allowUnknownSerializableClass) {}
+        m_unknownSerializable(allowUnknownSerializableClass),
+        m_hasRefs(HasRefs(str, str + len)) {}
   VariableUnserializer(const char *str, const char *end, Type type,
                        bool allowUnknownSerializableClass = false)
       : m_type(type), m_buf(str), m_end(end), m_key(false),
-        m_unknownSerializable(allowUnknownSerializableClass) {}
+        m_unknownSerializable(allowUnknownSerializableClass),
+        m_hasRefs(HasRefs(str, end)) {}
 
   Type getType() const { return m_type;}
   bool allowUnknownSerializableClass() const { return m_unknownSerializable;}
 
   Variant unserialize();
   Variant unserializeKey();
+  bool readingKey() const { return m_key;}
   void add(Variant* v) {
-    if (!m_key) {
+    if (!m_key && m_hasRefs) {
       m_refs.push_back(v);
     }
   }
@@ -70,7 +79,46 @@ public:
   const char *head() { return m_buf; }
   Variant &addVar();
 
+  /**
+   * Reads the rest of an s: entry that is an array key or property name.
+   * Short keys repeated within the payload share one StringData, so they
+   * are only allocated and hashed once.
+   */
+  String readKeyString();
+
+  /**
+   * Same as create_object_only(), but under hhvm the class is looked up
+   * once per request.
+   */
+  Object createObject(CStrRef clsName);
+
+  /**
+   * Declared property slot a serialized property name ended up in on an
+   * earlier object of cls in this request, remembered per request.
+   * UnknownSlot until set, NoSlot when it was not a declared property.
+   */
+  static const int UnknownSlot = -2;
+  static const int NoSlot = -1;
+  int &propSlot(const VM::Class *cls, CStrRef key);
+
  private:
+  struct KeySlice {
+    KeySlice(const char *d, int l) : data(d), len(l) {}
+    const char *data;
+    int len;
+  };
+  struct KeySliceHash {
+    size_t operator()(const KeySlice &k) const {
+      return hash_string(k.data, k.len);
+    }
+  };
+  struct KeySliceEq {
+    bool operator()(const KeySlice &k1, const KeySlice &k2) const {
+      return k1.len == k2.len && !memcmp(k1.data, k2.data, k1.len);
+    }
+  };
+  typedef hphp_hash_map<KeySlice, String, KeySliceHash, KeySliceEq> KeyMap;
+
   Type m_type;
   const char *m_buf;
   const char *m_end;
@@ -78,6 +126,10 @@ public:
   std::list<Variant> m_vars;
   bool m_key;
   bool m_unknownSerializable;
+  bool m_hasRefs; // whether m_refs is needed at all
+  KeyMap m_keys;  // keys seen so far, pointing into the payload
+
+  static bool HasRefs(const char *str, const char *end);
 
   void check() {
     if (m_buf >= m_end) {
@@ -27,6 +27,12 @@ SOFTWARE.
 */
 
 #include <runtime/base/zend/utf8_decode.h>
+#include <util/assertions.h>
+
+#include <string.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 /*
     Very Strict UTF-8 Decoder
@@ -193,5 +199,36 @@ int UTF8To16Decoder::decode() {
   }
 }
 
+int UTF8To16Decoder::asciiRun(const char *stops, int nstops) const {
+  if (m_low_surrogate) return 0;
+  const char *p = current();
+  int len = m_decode.the_length - m_decode.the_index;
+  int i = 0;
+#ifdef __SSE2__
+  static const int MaxStops = 16;
+  ASSERT(nstops <= MaxStops);
+  __m128i stopv[MaxStops];
+  for (int j = 0; j < nstops; j++) {
+    stopv[j] = _mm_set1_epi8(stops[j]);
+  }
+  const __m128i space = _mm_set1_epi8(' ');
+  for (; i + 16 <= len; i += 16) {
+    __m128i v = _mm_loadu_si128((const __m128i *)(p + i));
+    // signed compare, so this catches control characters and non-ASCII
+    __m128i stop = _mm_cmplt_epi8(v, space);
+    for (int j = 0; j < nstops; j++) {
+      stop = _mm_or_si128(stop, _mm_cmpeq_epi8(v, stopv[j]));
+    }
+    int mask = _mm_movemask_epi8(stop);
+    if (mask) return i + __builtin_ctz(mask);
+  }
+#endif
+  for (; i < len; i++) {
+    unsigned char c = p[i];
+    if (c < ' ' || c >= 0x80 || memchr(stops, c, nstops)) break;
+  }
+  return i;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 }
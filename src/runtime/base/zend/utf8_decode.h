@@ -38,6 +38,21 @@ public:
   UTF8To16Decoder(const char *utf8, int length, bool loose);
   int decode();
 
+  /**
+   * Length of the run of bytes at the current position that are printable
+   * ASCII and not one of the nstops characters in stops, so callers can copy
+   * them in bulk and skip() over them instead of decoding one at a time.
+   * Checks 16 bytes at a time with SSE2.
+   */
+  int asciiRun(const char *stops, int nstops) const;
+  const char *current() const {
+    return m_decode.the_input + m_decode.the_index;
+  }
+  void skip(int n) {
+    m_decode.the_index += n;
+    m_decode.the_char += n;
+  }
+
 private:
   json_utf8_decode m_decode;
   int m_loose; // Faceook: json_utf8_loose
@@ -20,11 +20,17 @@
 #include <util/process.h>
 #include <util/atomic.h>
 #include <util/trace.h>
+#include <util/timer.h>
+#include <util/async_job.h>
+#include <util/logger.h>
 #include <runtime/base/stat_cache.h>
 #include <runtime/base/server/source_root_info.h>
+#include <runtime/base/server/server_stats.h>
+#include <runtime/base/program_functions.h>
 
 #include <runtime/vm/translator/targetcache.h>
 #include <runtime/vm/translator/translator-x64.h>
+#include <runtime/vm/autoload_index.h>
 #include <runtime/vm/bytecode.h>
 #include <runtime/vm/pendq.h>
 #include <runtime/vm/repo.h>
@@ -90,6 +96,7 @@ void PhpFile::setId(int id) {
 
 ReadWriteMutex FileRepository::s_md5Lock(RankFileMd5);
 ParsedFilesMap FileRepository::s_files;
+ReadWriteMutex FileRepository::s_filesLock(RankParsedFiles);
 Md5FileMap FileRepository::s_md5Files;
 UnitMd5Map FileRepository::s_unitMd5Map;
 
@@ -102,10 +109,13 @@ static class FileDumpInitializer {
 bool FileRepository::fileDump(const char *filename) {
   std::ofstream out(filename);
   if (out.fail()) return false;
-  out << "s_files: " << s_files.size() << endl;
-  for (ParsedFilesMap::const_iterator it =
-       s_files.begin(); it != s_files.end(); it++) {
-    out << it->first->data() << endl;
+  {
+    WriteLock lock(s_filesLock);
+    out << "s_files: " << s_files.size() << endl;
+    for (ParsedFilesMap::const_iterator it =
+         s_files.begin(); it != s_files.end(); it++) {
+      out << it->first->data() << endl;
+    }
   }
   {
     ReadLock lock(s_md5Lock);
@@ -120,6 +130,163 @@ bool FileRepository::fileDump(const char *filename) {
   return true;
 }
 
+void FileRepository::getLoadedFileNames(std::vector<std::string> &names) {
+  WriteLock lock(s_filesLock);
+  for (ParsedFilesMap::const_iterator it =
+       s_files.begin(); it != s_files.end(); it++) {
+    names.push_back(it->first->data());
+  }
+}
+
+int FileRepository::preloadFiles(const std::vector<std::string> &names) {
+  int count = 0;
+  for (unsigned int i = 0; i < names.size(); i++) {
+    StringData *name = StringData::GetStaticString(names[i]);
+    struct stat s;
+    if (!findFile(name, &s)) continue;
+    PhpFile *f = checkoutFile(name, s);
+    if (f) {
+      f->decRefAndDelete();
+      count++;
+    }
+  }
+  return count;
+}
+
+DECLARE_BOOST_TYPES(PreloadJob);
+class PreloadJob {
+public:
+  explicit PreloadJob(const std::string &name)
+    : m_name(name), m_unit(NULL), m_done(false) {}
+  std::string m_name;
+  VM::Unit *m_unit;
+  bool m_done; // loaded, and every hoistable class defined (or given up)
+};
+
+class PreloadWorker {
+public:
+  void onThreadEnter() {
+    hphp_session_init();
+    m_context = hphp_context_init();
+  }
+  void doJob(PreloadJobPtr job) {
+    try {
+      if (!job->m_unit) {
+        StringData *name = StringData::GetStaticString(job->m_name);
+        struct stat s;
+        PhpFile *f = FileRepository::findFile(name, &s) ?
+          FileRepository::checkoutFile(name, s) : NULL;
+        if (!f) {
+          job->m_done = true;
+          return;
+        }
+        job->m_unit = f->unit();
+        f->decRefAndDelete();
+      }
+      job->m_done = job->m_unit->preload();
+    } catch (const Exception &e) {
+      Logger::Warning("preload: %s: %s", job->m_name.c_str(), e.what());
+      job->m_done = true;
+    }
+  }
+  void onThreadExit() {
+    hphp_context_exit(m_context, false);
+    hphp_session_exit();
+  }
+private:
+  ExecutionContext *m_context;
+};
+
+void FileRepository::preloadRepo() {
+  if (!isAuthoritativeRepo() || RuntimeOption::RepoPreloadThreads <= 0) {
+    return;
+  }
+
+  std::vector<std::string> names;
+  const std::string &list = RuntimeOption::RepoPreloadFileList;
+  if (!list.empty()) {
+    std::ifstream in(list.c_str());
+    std::string name;
+    while (std::getline(in, name)) {
+      if (!name.empty()) names.push_back(name);
+    }
+  }
+  if (names.empty()) {
+    VM::Repo::get().enumerateFiles(names);
+    Logger::Info("preload: loading all %d files in the repo",
+                 (int)names.size());
+  } else {
+    Logger::Info("preload: loading %d files listed in %s",
+                 (int)names.size(), list.c_str());
+  }
+  preloadUnits(names);
+}
+
+void FileRepository::preloadUnits(const std::vector<std::string> &names) {
+  Timer timer(Timer::WallTime, "preloading repo");
+  PreloadJobPtrVec jobs;
+  jobs.reserve(names.size());
+  for (unsigned int i = 0; i < names.size(); i++) {
+    // The repo and the list hold paths relative to the source root, but
+    // requests check files out by absolute path; loading the relative
+    // name would create a second unit for the same file.
+    std::string name = names[i];
+    if (!name.empty() && name[0] != '/') {
+      name = RuntimeOption::SourceRoot + name;
+    }
+    jobs.push_back(PreloadJobPtr(new PreloadJob(name)));
+  }
+
+  // A class can only be defined once its parent and interfaces are, and
+  // each round runs in fresh requests, so repeat while persistent classes
+  // keep getting defined.  Classes that aren't persistent are created but
+  // only bound by the first request that merges them.
+  for (int round = 1; !jobs.empty(); round++) {
+    JobDispatcher<PreloadJob, PreloadWorker>
+      (jobs, RuntimeOption::RepoPreloadThreads).run();
+    PreloadJobPtrVec pending;
+    for (unsigned int i = 0; i < jobs.size(); i++) {
+      if (!jobs[i]->m_done) pending.push_back(jobs[i]);
+    }
+    Logger::Info("preload: round %d: %d files loaded, %d with classes "
+                 "not yet defined", round, (int)getLoadedFiles(),
+                 (int)pending.size());
+    if (pending.size() == jobs.size()) break;
+    jobs.swap(pending);
+  }
+}
+
+void FileRepository::recordPreloadList() {
+  if (!isAuthoritativeRepo() || !RuntimeOption::RepoPreloadRecord ||
+      RuntimeOption::RepoPreloadFileList.empty()) {
+    return;
+  }
+  std::vector<std::string> names;
+  getLoadedFileNames(names);
+  const std::string &path = RuntimeOption::RepoPreloadFileList;
+  std::string tmp = path + ".tmp";
+  std::ofstream out(tmp.c_str(), std::ios::trunc);
+  // Loaded files go by absolute path; write them relative to the source
+  // root, like the lists hphp builds, and preloadUnits() puts it back.
+  const std::string &root = RuntimeOption::SourceRoot;
+  for (unsigned int i = 0; i < names.size(); i++) {
+    const std::string &name = names[i];
+    if (!root.empty() && name.compare(0, root.size(), root) == 0) {
+      out << name.substr(root.size()) << '\n';
+    } else {
+      out << name << '\n';
+    }
+  }
+  out.close();
+  if (!out || rename(tmp.c_str(), path.c_str())) {
+    Logger::Error("preload: unable to write %s", path.c_str());
+    unlink(tmp.c_str());
+    return;
+  }
+  Logger::Info("preload: recorded %d loaded files in %s",
+               (int)names.size(), path.c_str());
+}
+
 void FileRepository::onDelete(PhpFile *f) {
   ASSERT(f->getRef() == 0);
   if (md5Enabled()) {
@@ -166,6 +333,9 @@ PhpFile *FileRepository::checkoutFile(StringData *rname,
   TRACE(1, "FR fast path miss: %s\n", rname->data());
   bool interceptsEnabled = s_interceptsEnabled;
   const StringData *n = StringData::GetStaticString(name.get());
+  // Held shared until we return: it only keeps walkers of s_files out
+  // while we may insert or erase.
+  ReadLock filesLock(s_filesLock);
   ParsedFilesMap::accessor acc;
   bool isNew = s_files.insert(acc, n);
   ASSERT(isNew || acc->second); // We don't leave null entries around.
@@ -437,6 +607,7 @@ PhpFile *FileRepository::parseFile(const std::string &name,
   VM::Unit* unit = VM::compile_file(fileInfo.m_inputString->data(),
                                     fileInfo.m_inputString->size(),
                                     md5, name.c_str());
+  VM::AutoloadIndex::Record(unit);
   PhpFile *p = new PhpFile(name, fileInfo.m_srcRoot, fileInfo.m_relPath,
                            fileInfo.m_md5, unit);
   return p;
@@ -498,12 +669,108 @@ static bool findFileWrapper(CStrRef file, void* ctx) {
   return false;
 }
 
+/*
+ * Server.IncludeResolveCacheSize: successful resolutions, shared by all
+ * requests.  An entry is only good for the generation it was made in;
+ * the generation is fixed in RepoAuthoritative mode and otherwise follows
+ * StatCache's change notifications, so any file system change makes every
+ * entry stale.  Without either there is nothing to invalidate on, and the
+ * cache is off.  When it fills up, stale entries are evicted, or every
+ * entry if none are stale.
+ */
+struct ResolvedInclude {
+  StringData* path; // static
+  struct stat s;
+  int64 generation;
+};
+typedef tbb::concurrent_hash_map<std::string, ResolvedInclude,
+                                 stringHashCompare> ResolvedIncludeMap;
+static ResolvedIncludeMap s_resolvedIncludes;
+// Finds and inserts hold this shared; eviction walks the map, so it holds
+// it exclusively.
+static ReadWriteMutex s_resolvedIncludesLock(RankLeaf);
+
+static int64 includeCacheGeneration() {
+  if (RuntimeOption::IncludeResolveCacheSize <= 0) return -1;
+  if (RuntimeOption::RepoAuthoritative) return 0;
+  return StatCache::generation();
+}
+
+// Everything resolve_include() and findFileWrapper() depend on.
+static std::string includeCacheKey(StringData* path, const char* currentDir) {
+  std::string key(path->data(), path->size());
+  key += '\0';
+  key += currentDir;
+  key += '\0';
+  key += g_context->getCwd().data();
+  key += '\0';
+  key += g_context->getIncludePath().data();
+  key += '\0';
+  key += SourceRootInfo::GetCurrentSourceRoot();
+  return key;
+}
+
+static void evictResolvedIncludes(int64 generation) {
+  static const std::string s_evict("include_cache.evict");
+
+  WriteLock lock(s_resolvedIncludesLock);
+  if (s_resolvedIncludes.size() <
+      (size_t)RuntimeOption::IncludeResolveCacheSize) {
+    return; // someone else got here first
+  }
+  std::vector<std::string> stale;
+  for (ResolvedIncludeMap::const_iterator it = s_resolvedIncludes.begin();
+       it != s_resolvedIncludes.end(); ++it) {
+    if (it->second.generation != generation) stale.push_back(it->first);
+  }
+  if (stale.empty()) {
+    ServerStats::Log(s_evict, s_resolvedIncludes.size());
+    s_resolvedIncludes.clear();
+    return;
+  }
+  ServerStats::Log(s_evict, stale.size());
+  for (unsigned int i = 0; i < stale.size(); i++) {
+    s_resolvedIncludes.erase(stale[i]);
+  }
+}
+
 String resolveVmInclude(StringData* path, const char* currentDir,
                         struct stat *s) {
+  static const std::string s_hit("include_cache.hit");
+  static const std::string s_miss("include_cache.miss");
+
+  int64 generation = includeCacheGeneration();
+  std::string key;
+  if (generation >= 0) {
+    key = includeCacheKey(path, currentDir);
+    ReadLock lock(s_resolvedIncludesLock);
+    ResolvedIncludeMap::const_accessor acc;
+    if (s_resolvedIncludes.find(acc, key) &&
+        acc->second.generation == generation) {
+      ServerStats::Log(s_hit, 1);
+      *s = acc->second.s;
+      return acc->second.path;
+    }
+    ServerStats::Log(s_miss, 1);
+  }
+
   ResolveIncludeContext ctx;
   ctx.s = s;
   resolve_include(path, currentDir, findFileWrapper,
                   (void*)&ctx);
+
+  if (generation >= 0 && !ctx.path.isNull()) {
+    if (s_resolvedIncludes.size() >=
+        (size_t)RuntimeOption::IncludeResolveCacheSize) {
+      evictResolvedIncludes(generation);
+    }
+    ReadLock lock(s_resolvedIncludesLock);
+    ResolvedIncludeMap::accessor acc;
+    s_resolvedIncludes.insert(acc, key);
+    acc->second.path = StringData::GetStaticString(ctx.path.get());
+    acc->second.s = *s;
+    acc->second.generation = generation;
+  }
   // If resolve_include() could not find the file, return NULL
   return ctx.path;
 }
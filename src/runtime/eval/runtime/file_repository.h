@@ -161,8 +161,34 @@ public:
   static void onDelete(PhpFile *f);
   static void forEachUnit(VM::UnitVisitor& uit);
   static size_t getLoadedFiles();
+
+  /**
+   * Takeover support: names of every file currently loaded, and a way to
+   * load a list of them ahead of the first request that needs them.
+   */
+  static void getLoadedFileNames(std::vector<std::string> &names);
+  static int preloadFiles(const std::vector<std::string> &names);
+
+  /**
+   * Repo.Preload: before the server opens its port, load the hot set
+   * recorded by an earlier run (or every file in the repo) on a pool of
+   * threads and define their persistent functions and classes, so early
+   * requests don't pay for it.  recordPreloadList() saves the hot set on
+   * shutdown.
+   */
+  static void preloadRepo();
+  /**
+   * Loads and preloads the named files, resolving relative names against
+   * RuntimeOption::SourceRoot the way requests do.
+   */
+  static void preloadUnits(const std::vector<std::string> &names);
+  static void recordPreloadList();
 private:
   static ParsedFilesMap s_files;
+  // Inserts and erases on s_files are safe against each other but not
+  // against iteration, so they share this lock and walkers take it
+  // exclusively.
+  static ReadWriteMutex s_filesLock;
   static UnitMd5Map s_unitMd5Map;
   static ReadWriteMutex s_md5Lock;
   static Md5FileMap s_md5Files;
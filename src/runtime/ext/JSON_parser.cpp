@@ -519,6 +519,16 @@ bool JSON_parser(Variant &z, const char *p, int length, bool assoc/*<fb>*/,
 
   UTF8To16Decoder decoder(p, length, loose);
   for (;;) {
+    if (the_state == 3 && type == KindOfString) {
+      // inside a string, plain ASCII goes to the buffer as is; both quote
+      // characters stop the run so loose mode's qchr check still happens
+      int run = decoder.asciiRun("\"'\\", 3);
+      if (run) {
+        buf->append(decoder.current(), run);
+        decoder.skip(run);
+      }
+    }
+
     b = decoder.decode();
     if (b == UTF8_END) break; // UTF-8 decoding finishes successfully.
     if (b == UTF8_ERROR) {
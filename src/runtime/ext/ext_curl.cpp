@@ -18,10 +18,16 @@
 #include <runtime/ext/ext_curl.h>
 #include <runtime/ext/ext_function.h>
 #include <runtime/base/util/string_buffer.h>
+#include <runtime/base/util/http_connection_pool.h>
 #include <runtime/base/util/libevent_http_client.h>
 #include <runtime/base/runtime_option.h>
 #include <runtime/base/server/server_stats.h>
+#include <runtime/base/server/request_trace.h>
+#include <runtime/base/zend/zend_url.h>
 #include <runtime/vm/translator/translator-inline.h>
+#include <util/timer.h>
+#include <fcntl.h>
+#include <sys/epoll.h>
 
 #define CURLOPT_RETURNTRANSFER 19913
 #define CURLOPT_BINARYTRANSFER 19914
@@ -92,8 +98,12 @@ public:
 
   CurlResource(CStrRef url) : m_exception(NULL),
                               m_phpException(false),
-                              m_emptyPost(true) {
-    m_cp = curl_easy_init();
+                              m_emptyPost(true),
+                              m_httpHeaders(NULL),
+                              m_traceHeaderAdded(false),
+                              m_poolable(true) {
+    m_cp = HttpConnectionPool::Acquire(
+      HttpConnectionPool::GetKey(url.c_str()));
     m_url = url;
 
     memset(m_error_str, 0, sizeof(m_error_str));
@@ -137,7 +147,8 @@ public:
     }
   }
 
-  CurlResource(CurlResource *src) : m_exception(NULL), m_phpException(false) {
+  CurlResource(CurlResource *src)
+    : m_exception(NULL), m_phpException(false), m_poolable(true) {
     ASSERT(src && src != this);
     ASSERT(!src->m_exception);
 
@@ -166,7 +177,10 @@ public:
     curl_easy_setopt(m_cp, CURLOPT_WRITEHEADER,       (void*)this);
 
     m_to_free = src->m_to_free;
+    m_poolable = src->m_poolable;
     m_emptyPost = src->m_emptyPost;
+    m_httpHeaders = src->m_httpHeaders;
+    m_traceHeaderAdded = src->m_traceHeaderAdded;
   }
 
   ~CurlResource() {
@@ -176,17 +190,60 @@ public:
   void closeForSweep() {
     ASSERT(!m_exception);
     if (m_cp) {
-      curl_easy_cleanup(m_cp);
+      HttpConnectionPool::Release(m_poolKey, m_cp);
       m_cp = NULL;
     }
+    std::string().swap(m_poolKey); // sweeping skips the destructor
     m_to_free.reset();
   }
 
+  /**
+   * Handles that were ever in a multi handle are not pooled, since they may
+   * still be in it when closed.
+   */
+  void addedToMulti() {
+    dontPool();
+  }
+
+  void dontPool() {
+    m_poolable = false;
+    m_poolKey.clear();
+  }
+
   void close() {
     closeForSweep();
     m_opts.clear();
   }
 
+  /**
+   * Passes the current request's trace id on to the server we are calling,
+   * as long as it is one of ours.
+   */
+  void addTraceHeader() {
+    std::string traceId = RequestTrace::GetTraceId();
+    if (traceId.empty() || m_traceHeaderAdded) {
+      return;
+    }
+    Url url;
+    if (!url_parse(url, m_url.data(), m_url.size()) || !url.host ||
+        !RequestTrace::IsTrustedHost(url.host)) {
+      return;
+    }
+    std::string header = RequestTrace::HeaderName;
+    header += ": ";
+    header += traceId;
+    curl_slist *slist = curl_slist_append(m_httpHeaders, header.c_str());
+    if (!slist) {
+      return;
+    }
+    if (!m_httpHeaders) {
+      m_to_free->slist.push_back(slist);
+    }
+    m_httpHeaders = slist;
+    m_traceHeaderAdded = true;
+    curl_easy_setopt(m_cp, CURLOPT_HTTPHEADER, slist);
+  }
+
   Variant execute() {
     ASSERT(!m_exception);
     if (m_cp == NULL) {
@@ -201,6 +258,7 @@ public:
     m_write.content.clear();
     m_header.clear();
     memset(m_error_str, 0, sizeof(m_error_str));
+    addTraceHeader();
 
     {
       IOStatusHelper io("curl_easy_perform", m_url.data());
@@ -220,6 +278,13 @@ public:
       }
     }
     set_curl_statuses(m_cp, m_url.data());
+    HttpConnectionPool::LogTransfer(m_cp);
+    if (m_poolable) {
+      // where the connection curl may keep open actually goes
+      char *effectiveUrl = NULL;
+      curl_easy_getinfo(m_cp, CURLINFO_EFFECTIVE_URL, &effectiveUrl);
+      m_poolKey = effectiveUrl ? HttpConnectionPool::GetKey(effectiveUrl) : "";
+    }
 
     /* CURLE_PARTIAL_FILE is returned by HEAD requests */
     if (m_error_no != CURLE_OK && m_error_no != CURLE_PARTIAL_FILE) {
@@ -266,6 +331,25 @@ public:
     }
     m_error_no = CURLE_OK;
 
+    switch (option) {
+    case CURLOPT_USERPWD:
+    case CURLOPT_PROXYUSERPWD:
+    case CURLOPT_HTTPAUTH:
+    case CURLOPT_PROXYAUTH:
+    case CURLOPT_SSLCERT:
+    case CURLOPT_SSLKEY:
+    case CURLOPT_COOKIE:
+    case CURLOPT_COOKIEFILE:
+    case CURLOPT_COOKIEJAR:
+    case CURLOPT_COOKIESESSION:
+      // credentials and cookies stick to the handle or its connections,
+      // so whoever took it from the pool next would be sending them
+      dontPool();
+      break;
+    default:
+      break;
+    }
+
     switch (option) {
     case CURLOPT_INFILESIZE:
     case CURLOPT_VERBOSE:
@@ -509,6 +593,10 @@ public:
 
         m_to_free->slist.push_back(slist);
         m_error_no = curl_easy_setopt(m_cp, (CURLoption)option, slist);
+        if (option == CURLOPT_HTTPHEADER) {
+          m_httpHeaders = slist;
+          m_traceHeaderAdded = false;
+        }
 
       } else {
         raise_warning("You must pass either an object or an array with "
@@ -708,6 +796,14 @@ private:
 
   bool m_phpException;
   bool m_emptyPost;
+
+  // the CURLOPT_HTTPHEADER list, which we may add a trace id header to
+  curl_slist *m_httpHeaders;
+  bool m_traceHeaderAdded;
+
+  // pool key of the last host we talked to, "" to not pool m_cp
+  std::string m_poolKey;
+  bool m_poolable;
 };
 IMPLEMENT_OBJECT_ALLOCATION_NO_DEFAULT_SWEEP(CurlResource);
 void CurlResource::sweep() {
@@ -962,20 +1058,109 @@ public:
   // overriding ResourceData
   CStrRef o_getClassNameHook() const { return s_class_name; }
 
-  CurlMultiResource() {
+  CurlMultiResource() : m_epfd(-1), m_timerDeadline(-1) {
     m_multi = curl_multi_init();
+    // curl tells us which sockets to watch and for how long as transfers
+    // go, both from curl_multi_exec() and from await()
+    m_epfd = epoll_create(16);
+    if (m_epfd >= 0) {
+      fcntl(m_epfd, F_SETFD, FD_CLOEXEC);
+      curl_multi_setopt(m_multi, CURLMOPT_SOCKETFUNCTION, curl_socket);
+      curl_multi_setopt(m_multi, CURLMOPT_SOCKETDATA, (void*)this);
+      curl_multi_setopt(m_multi, CURLMOPT_TIMERFUNCTION, curl_timer);
+      curl_multi_setopt(m_multi, CURLMOPT_TIMERDATA, (void*)this);
+    }
   }
 
   ~CurlMultiResource() {
     close();
   }
 
-  void close() {
+  void closeForSweep() {
     if (m_multi) {
       curl_multi_cleanup(m_multi);
-      m_easyh.clear();
       m_multi = NULL;
     }
+    if (m_epfd >= 0) {
+      ::close(m_epfd);
+      m_epfd = -1;
+    }
+  }
+
+  void close() {
+    closeForSweep();
+    m_easyh.clear();
+    m_done.clear();
+  }
+
+  /**
+   * Runs transfers until at least one finishes or timeout seconds pass,
+   * sleeping in epoll_wait() in between, so it only wakes up for sockets
+   * that are ready or for curl's own timers. Returns how many finished
+   * transfers curl_multi_info_read() has to report, or -1 on failure.
+   */
+  int await(double timeout) {
+    collect();
+    if (!m_done.empty()) return m_done.size();
+    if (m_epfd < 0) return -1;
+
+    int64 deadline = Timer::GetCurrentTimeMicros() + (int64)(timeout * 1000000);
+    int running = 0;
+    // starts handles added since the last call, and fires due timers
+    curl_multi_socket_action(get(), CURL_SOCKET_TIMEOUT, 0, &running);
+    while (true) {
+      collect();
+      if (!m_done.empty() || running == 0) break;
+
+      int64 now = Timer::GetCurrentTimeMicros();
+      if (m_timerDeadline >= 0 && m_timerDeadline <= now) {
+        // due even if sockets kept us busy; curl re-arms it if it needs to
+        m_timerDeadline = -1;
+        curl_multi_socket_action(get(), CURL_SOCKET_TIMEOUT, 0, &running);
+        continue;
+      }
+      int64 left = deadline - now;
+      if (left <= 0) break;
+      if (m_timerDeadline >= 0 && m_timerDeadline - now < left) {
+        left = m_timerDeadline - now;
+      }
+      int wait = (int)std::min((left + 999) / 1000, (int64)INT_MAX);
+
+      struct epoll_event events[64];
+      int n = epoll_wait(m_epfd, events, sizeof(events) / sizeof(events[0]),
+                         wait);
+      if (n < 0) {
+        if (errno == EINTR) continue;
+        return -1;
+      }
+      if (n == 0) {
+        continue; // the deadlines are checked at the top
+      }
+      for (int i = 0; i < n; i++) {
+        int flags = 0;
+        if (events[i].events & EPOLLIN)  flags |= CURL_CSELECT_IN;
+        if (events[i].events & EPOLLOUT) flags |= CURL_CSELECT_OUT;
+        if (events[i].events & (EPOLLERR | EPOLLHUP)) {
+          flags |= CURL_CSELECT_ERR;
+        }
+        curl_multi_socket_action(get(), events[i].data.fd, flags, &running);
+      }
+    }
+    return m_done.size();
+  }
+
+  /**
+   * Next message for curl_multi_info_read(), or null when there is none.
+   */
+  Variant nextMessage(int &queued) {
+    collect();
+    if (m_done.empty()) {
+      queued = 0;
+      return null;
+    }
+    Variant ret = m_done.dequeue();
+    queued = m_done.size();
+    return ret;
   }
 
   void add(CObjRef ch) {
@@ -1012,12 +1197,61 @@ private:
   int m_still_running;
   CURLM *m_multi;
   Array m_easyh;
+
+  int m_epfd;       // sockets curl asked us to watch
+  int64 m_timerDeadline; // us when curl wants CURL_SOCKET_TIMEOUT, or -1
+  Array m_done;     // finished transfers not yet read, in order
+
+  /**
+   * Moves curl's finished transfer messages into m_done, which await()
+   * can check without consuming them.
+   */
+  void collect() {
+    int queued;
+    CURLMsg *msg;
+    while (m_multi && (msg = curl_multi_info_read(m_multi, &queued))) {
+      Array info;
+      info.set("msg", msg->msg);
+      info.set("result", msg->data.result);
+      Object curle = find(msg->easy_handle);
+      if (!curle.isNull()) {
+        info.set("handle", curle);
+      }
+      m_done.append(info);
+    }
+  }
+
+  static int curl_socket(CURL *easy, curl_socket_t s, int what, void *ctx,
+                         void *socketp) {
+    CurlMultiResource *curlm = (CurlMultiResource*)ctx;
+    if (what == CURL_POLL_REMOVE) {
+      // curl may have closed it already, which removed it for us
+      epoll_ctl(curlm->m_epfd, EPOLL_CTL_DEL, s, NULL);
+      return 0;
+    }
+    struct epoll_event event;
+    memset(&event, 0, sizeof(event));
+    event.data.fd = s;
+    if (what & CURL_POLL_IN)  event.events |= EPOLLIN;
+    if (what & CURL_POLL_OUT) event.events |= EPOLLOUT;
+    if (epoll_ctl(curlm->m_epfd, EPOLL_CTL_MOD, s, &event) < 0 &&
+        errno == ENOENT) {
+      epoll_ctl(curlm->m_epfd, EPOLL_CTL_ADD, s, &event);
+    }
+    return 0;
+  }
+
+  static int curl_timer(CURLM *multi, long timeoutMs, void *ctx) {
+    // curl gives it relative to now; kept absolute so socket activity in
+    // between doesn't keep pushing it back
+    ((CurlMultiResource*)ctx)->m_timerDeadline = timeoutMs < 0 ? -1 :
+      Timer::GetCurrentTimeMicros() + (int64)timeoutMs * 1000;
+    return 0;
+  }
 };
 IMPLEMENT_OBJECT_ALLOCATION_NO_DEFAULT_SWEEP(CurlMultiResource);
 void CurlMultiResource::sweep() {
-  if (m_multi) {
-    curl_multi_cleanup(m_multi);
-  }
+  closeForSweep();
 }
 
 StaticString CurlMultiResource::s_class_name("cURL Multi Handle");
@@ -1039,6 +1273,8 @@ Variant f_curl_multi_add_handle(CObjRef mh, CObjRef ch) {
   CHECK_MULTI_RESOURCE(curlm);
   CurlResource *curle = ch.getTyped<CurlResource>();
   curlm->add(ch);
+  curle->addedToMulti();
+  curle->addTraceHeader();
   return curl_multi_add_handle(curlm->get(), curle->get());
 }
 
@@ -1112,6 +1348,17 @@ Variant f_curl_multi_select(CObjRef mh, double timeout /* = 1.0 */) {
   return ret;
 }
 
+int64 f_curl_multi_await(CObjRef mh, double timeout /* = 1.0 */) {
+  CurlMultiResource *curlm = mh.getTyped<CurlMultiResource>(true, true);
+  if (curlm == NULL) {
+    raise_warning("expects parameter 1 to be cURL multi resource");
+    return -1;
+  }
+  IOStatusHelper io("curl_multi_await");
+  SYNC_VM_REGS_SCOPED();
+  return curlm->await(timeout);
+}
+
 Variant f_curl_multi_getcontent(CObjRef ch) {
   CHECK_RESOURCE(curl);
   return curl->getContents();
@@ -1158,19 +1405,11 @@ Variant f_curl_multi_info_read(CObjRef mh,
   CHECK_MULTI_RESOURCE(curlm);
 
   int queued_msgs;
-  CURLMsg *tmp_msg = curl_multi_info_read(curlm->get(), &queued_msgs);
-  if (tmp_msg == NULL) {
+  Variant ret = curlm->nextMessage(queued_msgs);
+  if (ret.isNull()) {
     return false;
   }
   msgs_in_queue = queued_msgs;
-
-  Array ret;
-  ret.set("msg", tmp_msg->msg);
-  ret.set("result", tmp_msg->data.result);
-  Object curle = curlm->find(tmp_msg->easy_handle);
-  if (!curle.isNull()) {
-    ret.set("handle", curle);
-  }
   return ret;
 }
 
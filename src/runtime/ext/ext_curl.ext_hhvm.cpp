@@ -886,6 +886,69 @@ TypedValue* fg_curl_multi_select(HPHP::VM::ActRec *ar) {
 
 
 
+/*
+long long HPHP::f_curl_multi_await(HPHP::Object const&, double)
+_ZN4HPHP18f_curl_multi_awaitERKNS_6ObjectEd
+
+(return value) => rax
+mh => rdi
+timeout => xmm0
+*/
+
+long long fh_curl_multi_await(Value* mh, double timeout) asm("_ZN4HPHP18f_curl_multi_awaitERKNS_6ObjectEd");
+
+TypedValue * fg1_curl_multi_await(TypedValue* rv, HPHP::VM::ActRec* ar, long long count) __attribute__((noinline,cold));
+TypedValue * fg1_curl_multi_await(TypedValue* rv, HPHP::VM::ActRec* ar, long long count) {
+  TypedValue* args UNUSED = ((TypedValue*)ar) - 1;
+  rv->_count = 0;
+  rv->m_type = KindOfInt64;
+  switch (count) {
+  default: // count >= 2
+    if ((args-1)->m_type != KindOfDouble) {
+      tvCastToDoubleInPlace(args-1);
+    }
+  case 1:
+    break;
+  }
+  if ((args-0)->m_type != KindOfObject) {
+    tvCastToObjectInPlace(args-0);
+  }
+  rv->m_data.num = (long long)fh_curl_multi_await((Value*)(args-0), (count > 1) ? (args[-1].m_data.dbl) : (double)(1.0));
+  return rv;
+}
+
+TypedValue* fg_curl_multi_await(HPHP::VM::ActRec *ar) {
+    TypedValue rv;
+    long long count = ar->numArgs();
+    TypedValue* args UNUSED = ((TypedValue*)ar) - 1;
+    if (count >= 1LL && count <= 2LL) {
+      if ((count <= 1 || (args-1)->m_type == KindOfDouble) && (args-0)->m_type == KindOfObject) {
+        rv._count = 0;
+        rv.m_type = KindOfInt64;
+        rv.m_data.num = (long long)fh_curl_multi_await((Value*)(args-0), (count > 1) ? (args[-1].m_data.dbl) : (double)(1.0));
+        frame_free_locals_no_this_inl(ar, 2);
+        memcpy(&ar->m_r, &rv, sizeof(TypedValue));
+        return &ar->m_r;
+      } else {
+        fg1_curl_multi_await(&rv, ar, count);
+        frame_free_locals_no_this_inl(ar, 2);
+        memcpy(&ar->m_r, &rv, sizeof(TypedValue));
+        return &ar->m_r;
+      }
+    } else {
+      throw_wrong_arguments_nr("curl_multi_await", count, 1, 2, 1);
+    }
+    rv.m_data.num = 0LL;
+    rv._count = 0;
+    rv.m_type = KindOfNull;
+    frame_free_locals_no_this_inl(ar, 2);
+    memcpy(&ar->m_r, &rv, sizeof(TypedValue));
+    return &ar->m_r;
+  return &ar->m_r;
+}
+
+
+
 /*
 HPHP::Variant HPHP::f_fb_curl_multi_fdset(HPHP::Object const&, HPHP::VRefParamValue const&, HPHP::VRefParamValue const&, HPHP::VRefParamValue const&, HPHP::VRefParamValue const&)
 _ZN4HPHP21f_fb_curl_multi_fdsetERKNS_6ObjectERKNS_14VRefParamValueES5_S5_S5_
@@ -198,6 +198,17 @@ timeout => xmm0
 
 TypedValue* fh_curl_multi_select(TypedValue* _rv, Value* mh, double timeout) asm("_ZN4HPHP19f_curl_multi_selectERKNS_6ObjectEd");
 
+/*
+long long HPHP::f_curl_multi_await(HPHP::Object const&, double)
+_ZN4HPHP18f_curl_multi_awaitERKNS_6ObjectEd
+
+(return value) => rax
+mh => rdi
+timeout => xmm0
+*/
+
+long long fh_curl_multi_await(Value* mh, double timeout) asm("_ZN4HPHP18f_curl_multi_awaitERKNS_6ObjectEd");
+
 /*
 HPHP::Variant HPHP::f_fb_curl_multi_fdset(HPHP::Object const&, HPHP::VRefParamValue const&, HPHP::VRefParamValue const&, HPHP::VRefParamValue const&, HPHP::VRefParamValue const&)
 _ZN4HPHP21f_fb_curl_multi_fdsetERKNS_6ObjectERKNS_14VRefParamValueES5_S5_S5_
@@ -519,6 +519,18 @@ Variant f_fb_unserialize(CVarRef thing, VRefParam success,
  *  14 (VECTOR): followed by n serialized values until STOP is seen.
  *      Represents a vector of n values.
  *
+ *  15 (RECORDS): a list of maps that all have the same keys in the same
+ *      order, stored column by column. Followed by the number of keys k,
+ *      the k keys, the number of rows n, then k columns of n values each.
+ *      A column starts with a serialized int64 saying how it is stored:
+ *        0 (PLAIN): n serialized values
+ *        1 (DICT):  the number of distinct strings d, the d strings, then
+ *                   n serialized int64 indexes into them
+ *        2 (DELTA): n serialized int64 differences, each from the value in
+ *                   the row before (the first one from 0)
+ *      Represents a map with numeric keys 0, 1, ..., n-1. Only written by
+ *      version 2 of the format, see FbCompactSerialize.Version.
+ *
  *  In addition, if <c> & 0xf0 != 0xf0, most significant bits of <c> mean:
  *
  *  - 0....... 7-bit unsigned int
@@ -547,9 +559,19 @@ enum FbCompactSerializeCode {
   FB_CS_STOP       = 12,
   FB_CS_SKIP       = 13,
   FB_CS_VECTOR     = 14,
-  FB_CS_MAX_CODE   = 15,
+  FB_CS_RECORDS    = 15,
+  FB_CS_MAX_CODE   = 16,
+};
+
+enum FbCompactSerializeColumn {
+  FB_CS_COLUMN_PLAIN = 0,
+  FB_CS_COLUMN_DICT  = 1,
+  FB_CS_COLUMN_DELTA = 2,
 };
 
+// shorter lists don't make up for the extra header
+const int64_t kRecordsMinRows       = 2;
+
 // 1 byte: 0<7 bits>
 const uint64_t kInt7Mask            = 0x7f;
 const uint64_t kInt7Prefix          = 0x00;
@@ -636,6 +658,25 @@ static void fb_compact_serialize_string(StringData* sd, CStrRef str) {
   }
 }
 
+// Bytes fb_compact_serialize_int64() will write for val
+static int fb_compact_serialize_int64_size(int64_t val) {
+  if (val >= 0 && (uint64_t)val <= kInt7Mask) return 1;
+  if (val >= 0 && (uint64_t)val <= kInt13Mask) return 2;
+  if (val == (int64_t)(int16_t)val) return 3;
+  if (val >= 0 && (uint64_t)val <= kInt20Mask) return 3;
+  if (val == (int64_t)(int32_t)val) return 5;
+  if (val >= 0 && (uint64_t)val <= kInt54Mask) return 7;
+  return 9;
+}
+
+static void fb_compact_serialize_key(StringData* sd, CVarRef key) {
+  if (key.isNumeric()) {
+    fb_compact_serialize_int64(sd, key.toInt64());
+  } else {
+    fb_compact_serialize_string(sd, key.toString());
+  }
+}
+
 static bool fb_compact_serialize_is_list(CArrRef arr, int64_t& index_limit) {
   index_limit = arr.size();
   int64_t max_index = 0;
@@ -683,17 +724,152 @@ static void fb_compact_serialize_array_as_map(
 
   fb_compact_serialize_code(sd, FB_CS_MAP);
   for (ArrayIter it(arr); it; ++it) {
-    Variant key = it.first();
-    if (key.isNumeric()) {
-      fb_compact_serialize_int64(sd, key.toInt64());
-    } else {
-      fb_compact_serialize_string(sd, key.toString());
-    }
+    fb_compact_serialize_key(sd, it.first());
     fb_compact_serialize_variant(sd, it.second(), depth + 1);
   }
   fb_compact_serialize_code(sd, FB_CS_STOP);
 }
 
+/**
+ * Whether a list (as in fb_compact_serialize_is_list() with no gaps) holds
+ * only arrays that all have the same keys in the same order. On success
+ * the keys are in keys and the values, column by column, in columns.
+ */
+static bool fb_compact_serialize_is_records(
+  CArrRef arr, int64_t index_limit, std::vector<Variant>& keys,
+  std::vector<std::vector<const Variant*> >& columns) {
+
+  if (index_limit != arr.size() || index_limit < kRecordsMinRows) {
+    return false;
+  }
+  for (int64 i = 0; i < index_limit; ++i) {
+    CVarRef row = arr.rvalAtRef(i);
+    if (!row.is(KindOfArray)) {
+      return false;
+    }
+    CArrRef fields = row.toCArrRef();
+    if (i == 0) {
+      if (fields.empty()) {
+        return false;
+      }
+      for (ArrayIter it(fields); it; ++it) {
+        keys.push_back(it.first());
+      }
+      columns.resize(keys.size());
+      for (size_t c = 0; c < keys.size(); ++c) {
+        columns[c].reserve(index_limit);
+      }
+    } else if (fields.size() != (ssize_t)keys.size()) {
+      return false;
+    }
+    size_t c = 0;
+    for (ArrayIter it(fields); it; ++it, ++c) {
+      if (i > 0 && !same(it.first(), keys[c])) {
+        return false;
+      }
+      columns[c].push_back(&it.secondRef());
+    }
+  }
+  return true;
+}
+
+static int fb_compact_serialize_column(
+  StringData* sd, const std::vector<const Variant*>& column, int depth) {
+
+  bool ints = true;
+  bool strings = true;
+  for (size_t r = 0; r < column.size() && (ints || strings); ++r) {
+    DataType type = column[r]->getType();
+    ints = ints && type == KindOfInt64;
+    strings = strings && IS_STRING_TYPE(type);
+  }
+
+  if (strings) {
+    // worth it once values repeat at least every other row on average
+    StringMap<int64_t> dict;
+    std::vector<int64_t> indexes;
+    indexes.reserve(column.size());
+    for (size_t r = 0; r < column.size(); ++r) {
+      String str = column[r]->toString();
+      StringMap<int64_t>::const_iterator iter = dict.find(str);
+      if (iter != dict.end()) {
+        indexes.push_back(iter->second);
+      } else {
+        int64_t index = dict.size();
+        dict[str] = index;
+        indexes.push_back(index);
+      }
+    }
+    if (dict.size() * 2 <= column.size()) {
+      std::vector<const String*> values(dict.size());
+      for (StringMap<int64_t>::const_iterator iter = dict.begin();
+           iter != dict.end(); ++iter) {
+        values[iter->second] = &iter->first;
+      }
+      fb_compact_serialize_int64(sd, FB_CS_COLUMN_DICT);
+      fb_compact_serialize_int64(sd, values.size());
+      for (size_t i = 0; i < values.size(); ++i) {
+        fb_compact_serialize_string(sd, *values[i]);
+      }
+      for (size_t r = 0; r < indexes.size(); ++r) {
+        fb_compact_serialize_int64(sd, indexes[r]);
+      }
+      return 0;
+    }
+  }
+
+  if (ints) {
+    // ids and timestamps tend to be close to the row before
+    int plainSize = 0;
+    int deltaSize = 0;
+    int64_t prev = 0;
+    for (size_t r = 0; r < column.size(); ++r) {
+      int64_t val = column[r]->toInt64();
+      plainSize += fb_compact_serialize_int64_size(val);
+      deltaSize += fb_compact_serialize_int64_size(
+        (int64_t)((uint64_t)val - (uint64_t)prev));
+      prev = val;
+    }
+    if (deltaSize < plainSize) {
+      fb_compact_serialize_int64(sd, FB_CS_COLUMN_DELTA);
+      prev = 0;
+      for (size_t r = 0; r < column.size(); ++r) {
+        int64_t val = column[r]->toInt64();
+        fb_compact_serialize_int64(sd, (int64_t)((uint64_t)val -
+                                                 (uint64_t)prev));
+        prev = val;
+      }
+      return 0;
+    }
+  }
+
+  fb_compact_serialize_int64(sd, FB_CS_COLUMN_PLAIN);
+  for (size_t r = 0; r < column.size(); ++r) {
+    if (fb_compact_serialize_variant(sd, *column[r], depth)) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+static int fb_compact_serialize_array_as_records(
+  StringData* sd, const std::vector<Variant>& keys,
+  const std::vector<std::vector<const Variant*> >& columns, int depth) {
+
+  fb_compact_serialize_code(sd, FB_CS_RECORDS);
+  fb_compact_serialize_int64(sd, keys.size());
+  for (size_t c = 0; c < keys.size(); ++c) {
+    fb_compact_serialize_key(sd, keys[c]);
+  }
+  fb_compact_serialize_int64(sd, columns[0].size());
+  for (size_t c = 0; c < columns.size(); ++c) {
+    if (fb_compact_serialize_column(sd, columns[c], depth + 2)) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
 
 static int fb_compact_serialize_variant(
   StringData* sd, CVarRef var, int depth) {
@@ -738,6 +914,13 @@ static int fb_compact_serialize_variant(
       Array arr = var.toArray();
       int64_t index_limit;
       if (fb_compact_serialize_is_list(arr, index_limit)) {
+        std::vector<Variant> keys;
+        std::vector<std::vector<const Variant*> > columns;
+        if (RuntimeOption::FbCompactSerializeVersion >= 2 &&
+            fb_compact_serialize_is_records(arr, index_limit, keys, columns)) {
+          return fb_compact_serialize_array_as_records(sd, keys, columns,
+                                                       depth);
+        }
         fb_compact_serialize_array_as_list_map(sd, arr, index_limit, depth);
       } else {
         fb_compact_serialize_array_as_map(sd, arr, depth);
@@ -841,6 +1024,130 @@ int fb_compact_unserialize_int64_from_buffer(
   return 0;
 }
 
+int fb_compact_unserialize_from_buffer(
+  Variant& out, const char* buf, int n, int& p);
+
+static int fb_compact_unserialize_records_from_buffer(
+  Variant& out, const char* buf, int n, int& p) {
+
+  int64_t nkeys;
+  int err = fb_compact_unserialize_int64_from_buffer(nkeys, buf, n, p);
+  if (err) {
+    return err;
+  }
+  // every key takes at least a byte
+  if (nkeys <= 0 || nkeys > n - p) {
+    return FB_UNSERIALIZE_UNEXPECTED_END;
+  }
+  std::vector<Variant> keys(nkeys);
+  for (int64_t c = 0; c < nkeys; ++c) {
+    Variant key;
+    err = fb_compact_unserialize_from_buffer(key, buf, n, p);
+    if (err) {
+      return err;
+    }
+    if (key.getType() == KindOfInt64) {
+      keys[c] = key;
+    } else if (key.getType() == KindOfString ||
+               key.getType() == KindOfStaticString) {
+      keys[c] = key.toString().toKey();
+    } else {
+      return FB_UNSERIALIZE_UNEXPECTED_ARRAY_KEY_TYPE;
+    }
+  }
+
+  int64_t nrows;
+  err = fb_compact_unserialize_int64_from_buffer(nrows, buf, n, p);
+  if (err) {
+    return err;
+  }
+  // and every cell at least a byte, so this bounds what we allocate
+  if (nrows < 0 || nrows > (n - p) / nkeys) {
+    return FB_UNSERIALIZE_UNEXPECTED_END;
+  }
+  std::vector<Array> rows(nrows);
+  for (int64_t r = 0; r < nrows; ++r) {
+    rows[r] = ArrayInit(nkeys).create();
+  }
+
+  for (int64_t c = 0; c < nkeys; ++c) {
+    CVarRef key = keys[c];
+    int64_t kind;
+    err = fb_compact_unserialize_int64_from_buffer(kind, buf, n, p);
+    if (err) {
+      return err;
+    }
+    switch (kind) {
+      case FB_CS_COLUMN_PLAIN:
+        for (int64_t r = 0; r < nrows; ++r) {
+          Variant value;
+          err = fb_compact_unserialize_from_buffer(value, buf, n, p);
+          if (err) {
+            return err;
+          }
+          rows[r].set(key, value, true);
+        }
+        break;
+
+      case FB_CS_COLUMN_DICT:
+      {
+        int64_t ndict;
+        err = fb_compact_unserialize_int64_from_buffer(ndict, buf, n, p);
+        if (err) {
+          return err;
+        }
+        if (ndict < 0 || ndict > n - p) {
+          return FB_UNSERIALIZE_UNEXPECTED_END;
+        }
+        std::vector<Variant> dict(ndict);
+        for (int64_t i = 0; i < ndict; ++i) {
+          err = fb_compact_unserialize_from_buffer(dict[i], buf, n, p);
+          if (err) {
+            return err;
+          }
+        }
+        for (int64_t r = 0; r < nrows; ++r) {
+          int64_t index;
+          err = fb_compact_unserialize_int64_from_buffer(index, buf, n, p);
+          if (err) {
+            return err;
+          }
+          if (index < 0 || index >= ndict) {
+            return FB_UNSERIALIZE_UNRECOGNIZED_OBJECT_TYPE;
+          }
+          rows[r].set(key, dict[index], true);
+        }
+        break;
+      }
+
+      case FB_CS_COLUMN_DELTA:
+      {
+        int64_t prev = 0;
+        for (int64_t r = 0; r < nrows; ++r) {
+          int64_t delta;
+          err = fb_compact_unserialize_int64_from_buffer(delta, buf, n, p);
+          if (err) {
+            return err;
+          }
+          prev = (int64_t)((uint64_t)prev + (uint64_t)delta);
+          rows[r].set(key, Variant((int64)prev), true);
+        }
+        break;
+      }
+
+      default:
+        return FB_UNSERIALIZE_UNRECOGNIZED_OBJECT_TYPE;
+    }
+  }
+
+  ArrayInit ret(nrows, ArrayInit::vectorInit);
+  for (int64_t r = 0; r < nrows; ++r) {
+    ret.set(rows[r]);
+  }
+  out = ret.create();
+  return 0;
+}
+
 int fb_compact_unserialize_from_buffer(
   Variant& out, const char* buf, int n, int& p) {
 
@@ -969,6 +1276,9 @@ int fb_compact_unserialize_from_buffer(
       break;
     }
 
+    case FB_CS_RECORDS:
+      return fb_compact_unserialize_records_from_buffer(out, buf, n, p);
+
     default:
       return FB_UNSERIALIZE_UNRECOGNIZED_OBJECT_TYPE;
   }
@@ -1005,15 +1315,18 @@ static void output_dataset(Array &ret, int affected, DBDataSet &ds,
 
   Array rows;
   MYSQL_FIELD *fields = ds.getFields();
+  int cols = ds.getColCount();
+  std::vector<String> names(cols);
+  for (int i = 0; i < cols; i++) {
+    names[i] = String(fields[i].name, CopyString);
+  }
   for (ds.moveFirst(); ds.getRow(); ds.moveNext()) {
-    Array row;
-    for (int i = 0; i < ds.getColCount(); i++) {
-      const char *field = ds.getField(i);
-      int len = ds.getFieldLength(i);
-      row.set(String(fields[i].name, CopyString),
-              mysql_makevalue(String(field, len, CopyString), fields + i));
+    ArrayInit row(cols);
+    for (int i = 0; i < cols; i++) {
+      row.set(names[i], mysql_makevalue(ds.getField(i), ds.getFieldLength(i),
+                                        fields + i));
     }
-    rows.append(row);
+    rows.append(Array(row.create()));
   }
   ret.set("result", rows);
 
@@ -38,16 +38,24 @@ const int64 k_JSON_FB_EXTRA_ESCAPES = 1<<22;
 
 ///////////////////////////////////////////////////////////////////////////////
 
-String f_json_encode(CVarRef value, CVarRef options /* = 0 */) {
-  int64 json_options = options.toInt64();
+static int64 json_encode_options(CVarRef options) {
   if (options.isBoolean() && options.toBooleanVal()) {
-    json_options = k_JSON_FB_LOOSE;
+    return k_JSON_FB_LOOSE;
   }
+  return options.toInt64();
+}
 
+String f_json_encode(CVarRef value, CVarRef options /* = 0 */) {
+  int64 json_options = json_encode_options(options);
   VariableSerializer vs(VariableSerializer::JSON, json_options);
   return vs.serializeValue(value, !(json_options & k_JSON_FB_UNLIMITED));
 }
 
+void f_json_encode_to_output(CVarRef value, CVarRef options /* = 0 */) {
+  VariableSerializer vs(VariableSerializer::JSON, json_encode_options(options));
+  vs.serialize(value, false, true);
+}
+
 Variant f_json_decode(CStrRef json, bool assoc /* = false */,
                       CVarRef options /* = 0 */) {
   if (json.empty()) {
@@ -63,6 +63,43 @@ TypedValue* fg_json_encode(HPHP::VM::ActRec *ar) {
 
 
 
+/*
+void HPHP::f_json_encode_to_output(HPHP::Variant const&, HPHP::Variant const&)
+_ZN4HPHP23f_json_encode_to_outputERKNS_7VariantES2_
+
+value => rdi
+options => rsi
+*/
+
+void fh_json_encode_to_output(TypedValue* value, TypedValue* options) asm("_ZN4HPHP23f_json_encode_to_outputERKNS_7VariantES2_");
+
+TypedValue* fg_json_encode_to_output(HPHP::VM::ActRec *ar) {
+    TypedValue rv;
+    long long count = ar->numArgs();
+    TypedValue* args UNUSED = ((TypedValue*)ar) - 1;
+    if (count >= 1LL && count <= 2LL) {
+      rv.m_data.num = 0LL;
+      rv._count = 0;
+      rv.m_type = KindOfNull;
+      Variant defVal1 = 0;
+      fh_json_encode_to_output((args-0), (count > 1) ? (args-1) : (TypedValue*)(&defVal1));
+      frame_free_locals_no_this_inl(ar, 2);
+      memcpy(&ar->m_r, &rv, sizeof(TypedValue));
+      return &ar->m_r;
+    } else {
+      throw_wrong_arguments_nr("json_encode_to_output", count, 1, 2, 1);
+    }
+    rv.m_data.num = 0LL;
+    rv._count = 0;
+    rv.m_type = KindOfNull;
+    frame_free_locals_no_this_inl(ar, 2);
+    memcpy(&ar->m_r, &rv, sizeof(TypedValue));
+    return &ar->m_r;
+  return &ar->m_r;
+}
+
+
+
 /*
 HPHP::Variant HPHP::f_json_decode(HPHP::String const&, bool, HPHP::Variant const&)
 _ZN4HPHP13f_json_decodeERKNS_6StringEbRKNS_7VariantE
@@ -28,6 +28,16 @@ options => rdx
 
 Value* fh_json_encode(Value* _rv, TypedValue* value, TypedValue* options) asm("_ZN4HPHP13f_json_encodeERKNS_7VariantES2_");
 
+/*
+void HPHP::f_json_encode_to_output(HPHP::Variant const&, HPHP::Variant const&)
+_ZN4HPHP23f_json_encode_to_outputERKNS_7VariantES2_
+
+value => rdi
+options => rsi
+*/
+
+void fh_json_encode_to_output(TypedValue* value, TypedValue* options) asm("_ZN4HPHP23f_json_encode_to_outputERKNS_7VariantES2_");
+
 /*
 HPHP::Variant HPHP::f_json_decode(HPHP::String const&, bool, HPHP::Variant const&)
 _ZN4HPHP13f_json_decodeERKNS_6StringEbRKNS_7VariantE
@@ -26,6 +26,7 @@ namespace HPHP {
 ///////////////////////////////////////////////////////////////////////////////
 
 String f_json_encode(CVarRef value, CVarRef options = 0);
+void f_json_encode_to_output(CVarRef value, CVarRef options = 0);
 Variant f_json_decode(CStrRef json, bool assoc = false, CVarRef options = 0);
 extern const int64 k_JSON_HEX_TAG;
 extern const int64 k_JSON_HEX_AMP;
@@ -18,6 +18,7 @@
 #include <runtime/ext/ext_memcache.h>
 #include <runtime/base/util/request_local.h>
 #include <runtime/base/ini_setting.h>
+#include <runtime/base/server/server_stats.h>
 
 #include <system/lib/systemlib.h>
 
@@ -34,17 +35,21 @@ class MEMCACHEGlobals : public RequestEventHandler {
 public:
   std::string hash_strategy;
   std::string hash_function;
+  bool request_cache;
 
-  MEMCACHEGlobals() {}
+  MEMCACHEGlobals() : request_cache(false) {}
 
   virtual void requestInit() {
     hash_strategy = "standard";
     hash_function = "crc32";
+    request_cache = false;
 
     IniSetting::Bind("memcache.hash_strategy",     "standard",
                      ini_on_update_hash_strategy,  &hash_strategy);
     IniSetting::Bind("memcache.hash_function",     "crc32",
                      ini_on_update_hash_function,  &hash_function);
+    IniSetting::Bind("memcache.request_cache",     "0",
+                     ini_on_update_bool,           &request_cache);
   }
 
   virtual void requestShutdown() {
@@ -171,6 +176,7 @@ bool c_Memcache::t_add(CStrRef key, CVarRef var, int flag /*= 0*/,
     raise_warning("Key cannot be empty");
     return false;
   }
+  forget(key);
 
   String serialized = memcache_prepare_for_storage(var, flag);
 
@@ -190,6 +196,7 @@ bool c_Memcache::t_set(CStrRef key, CVarRef var, int flag /*= 0*/,
     raise_warning("Key cannot be empty");
     return false;
   }
+  forget(key);
 
   String serialized = memcache_prepare_for_storage(var, flag);
 
@@ -213,6 +220,7 @@ bool c_Memcache::t_replace(CStrRef key, CVarRef var, int flag /*= 0*/,
     raise_warning("Key cannot be empty");
     return false;
   }
+  forget(key);
 
   String serialized = memcache_prepare_for_storage(var, flag);
 
@@ -228,82 +236,193 @@ Variant c_Memcache::t_get(CVarRef key, VRefParam flags /*= null*/) {
   INSTANCE_METHOD_INJECTION_BUILTIN(Memcache, Memcache::get);
   TAINT_OBSERVER(TAINT_BIT_ALL, TAINT_BIT_NONE);
   if (key.is(KindOfArray)) {
-    std::vector<const char *> real_keys;
-    std::vector<size_t> key_len;
     Array keyArr = key.toArray();
+    if (keyArr.empty()) {
+      return false;
+    }
 
-    real_keys.reserve(keyArr.size());
-    key_len.reserve(keyArr.size());
+    Array return_val;
+    Array missing;
 
     for (ArrayIter iter(keyArr); iter; ++iter) {
-      real_keys.push_back(const_cast<char *>(iter.second().toString().c_str()));
-      key_len.push_back(iter.second().toString().length());
+      String skey = iter.second().toString();
+      if (cached(skey)) {
+        ServerStats::Log("memcache.cache_hit", 1);
+        if (m_results.exists(skey)) {
+          return_val.set(skey, m_results.rvalAt(skey));
+        }
+        consumed(skey);
+      } else {
+        missing.set(skey, true);
+      }
     }
 
-    if (!real_keys.empty()) {
-      const char *payload = NULL;
-      size_t payload_len = 0;
-      uint32_t flags = 0;
-      const char *res_key = NULL;
-      size_t res_key_len = 0;
+    if (!missing.empty()) {
+      // found has the deferred keys too; only hand back what was asked for
+      Array found;
+      dispatch(missing, found);
+      for (ArrayIter iter(missing); iter; ++iter) {
+        Variant k = iter.first();
+        if (found.exists(k, true)) {
+          return_val.set(k, found.rvalAt(k), true);
+        }
+      }
+    }
+    return return_val;
+  }
 
-      memcached_result_st result;
+  String skey = key.toString();
+  if (skey.length() == 0) {
+    return false;
+  }
 
-      memcached_return_t ret = memcached_mget(&m_memcache, &real_keys[0],
-                                              &key_len[0], real_keys.size());
-      memcached_result_create(&m_memcache, &result);
-      Array return_val;
+  if (cached(skey)) {
+    ServerStats::Log("memcache.cache_hit", 1);
+    Variant retval = m_results.exists(skey) ? m_results.rvalAt(skey)
+                                            : Variant(false);
+    consumed(skey);
+    return retval;
+  }
 
-      while ((memcached_fetch_result(&m_memcache, &result, &ret)) != NULL) {
-        if (ret != MEMCACHED_SUCCESS) {
-          // should probably notify about errors
-          continue;
-        }
+  if (!m_deferred.empty()) {
+    // first use of a deferred batch: fetch it along with this key
+    Array found;
+    dispatch(CREATE_MAP1(skey, true), found);
+    return found.exists(skey) ? found.rvalAt(skey) : Variant(false);
+  }
 
-        payload     = memcached_result_value(&result);
-        payload_len = memcached_result_length(&result);
-        flags       = memcached_result_flags(&result);
-        res_key     = memcached_result_key_value(&result);
-        res_key_len = memcached_result_key_length(&result);
+  char *payload = NULL;
+  size_t payload_len = 0;
+  uint32_t payload_flags = 0;
+  memcached_return_t ret;
 
-        return_val.set(String(res_key, res_key_len, CopyString),
-                       memcache_fetch_from_storage(payload,
-                                                   payload_len, flags));
-      }
-      memcached_result_free(&result);
+  ServerStats::Log("memcache.roundtrip", 1);
+  ServerStats::Log("memcache.key", 1);
+  payload = memcached_get(&m_memcache, skey.c_str(), skey.length(),
+                          &payload_len, &payload_flags, &ret);
 
-      return return_val;
+  /* This is for historical reasons from libmemcached*/
+  if (ret == MEMCACHED_END) {
+    ret = MEMCACHED_NOTFOUND;
+  }
+
+  if (ret == MEMCACHED_NOTFOUND) {
+    if (MEMCACHEG(request_cache)) {
+      m_misses.set(skey, true);
     }
-  } else {
-    char *payload = NULL;
-    size_t payload_len = 0;
-    uint32_t flags = 0;
+    return false;
+  }
 
-    memcached_return_t ret;
-    String skey = key.toString();
+  Variant retval = memcache_fetch_from_storage(payload, payload_len, payload_flags);
+  free(payload);
 
-    if (skey.length() == 0) {
-      return false;
+  if (MEMCACHEG(request_cache)) {
+    m_results.set(skey, retval);
+  }
+  return retval;
+}
+
+bool c_Memcache::deferGet(CVarRef key) {
+  if (key.is(KindOfArray)) {
+    bool ret = false;
+    for (ArrayIter iter(key.toArray()); iter; ++iter) {
+      ret = deferGet(iter.second()) || ret;
     }
+    return ret;
+  }
 
-    payload = memcached_get(&m_memcache, skey.c_str(), skey.length(),
-                            &payload_len, &flags, &ret);
+  String skey = key.toString();
+  if (skey.empty()) {
+    raise_warning("Key cannot be empty");
+    return false;
+  }
+  if (!cached(skey)) {
+    m_deferred.set(skey, true);
+  }
+  return true;
+}
 
-    /* This is for historical reasons from libmemcached*/
-    if (ret == MEMCACHED_END) {
-      ret = MEMCACHED_NOTFOUND;
+void c_Memcache::dispatch(CArrRef keys, Array &found) {
+  // keys are array keys here, so repeats are already folded
+  Array batch = m_deferred;
+  batch += keys;
+  m_deferred.clear();
+
+  std::vector<String> key_strs;
+  std::vector<const char *> real_keys;
+  std::vector<size_t> key_len;
+  key_strs.reserve(batch.size());
+  real_keys.reserve(batch.size());
+  key_len.reserve(batch.size());
+  for (ArrayIter iter(batch); iter; ++iter) {
+    key_strs.push_back(iter.first().toString());
+    real_keys.push_back(key_strs.back().c_str());
+    key_len.push_back(key_strs.back().length());
+  }
+
+  // libmemcached splits the keys by server and writes to all of them before
+  // reading any replies, so this is one round trip per request
+  ServerStats::Log("memcache.roundtrip", 1);
+  ServerStats::Log("memcache.key", real_keys.size());
+  memcached_return_t ret = memcached_mget(&m_memcache, &real_keys[0],
+                                          &key_len[0], real_keys.size());
+
+  memcached_result_st result;
+  memcached_result_create(&m_memcache, &result);
+  while ((memcached_fetch_result(&m_memcache, &result, &ret)) != NULL) {
+    if (ret != MEMCACHED_SUCCESS) {
+      // should probably notify about errors
+      continue;
     }
 
-    if (ret == MEMCACHED_NOTFOUND) {
-      return false;
+    String res_key(memcached_result_key_value(&result),
+                   memcached_result_key_length(&result), CopyString);
+    found.set(res_key,
+              memcache_fetch_from_storage(memcached_result_value(&result),
+                                          memcached_result_length(&result),
+                                          memcached_result_flags(&result)));
+  }
+  memcached_result_free(&result);
+
+  // deferred keys have to be remembered until they are asked for; the ones
+  // asked for right now only when the request cache is on. Without it, only
+  // the latest batch is kept, so a page that defers keys it never reads
+  // doesn't grow this without bound.
+  bool cacheAll = MEMCACHEG(request_cache);
+  if (!cacheAll) {
+    forgetAll();
+  }
+  for (ArrayIter iter(batch); iter; ++iter) {
+    Variant k = iter.first();
+    if (cacheAll || !keys.exists(k, true)) {
+      if (found.exists(k, true)) {
+        m_results.set(k, found.rvalAt(k), true);
+      } else {
+        m_misses.set(k, true, true);
+      }
     }
+  }
+}
+
+bool c_Memcache::cached(CStrRef key) const {
+  return m_results.exists(key) || m_misses.exists(key);
+}
 
-    Variant retval = memcache_fetch_from_storage(payload, payload_len, flags);
-    free(payload);
+void c_Memcache::forget(CStrRef key) {
+  m_results.remove(key);
+  m_misses.remove(key);
+}
 
-    return retval;
+void c_Memcache::consumed(CStrRef key) {
+  // without the request cache, a deferred value is only good for one read
+  if (!MEMCACHEG(request_cache)) {
+    forget(key);
   }
-  return false;
+}
+
+void c_Memcache::forgetAll() {
+  m_results.clear();
+  m_misses.clear();
 }
 
 bool c_Memcache::t_delete(CStrRef key, int expire /*= 0*/) {
@@ -312,6 +431,7 @@ bool c_Memcache::t_delete(CStrRef key, int expire /*= 0*/) {
     raise_warning("Key cannot be empty");
     return false;
   }
+  forget(key);
 
   memcached_return_t ret = memcached_delete(&m_memcache,
                                             key.c_str(), key.length(),
@@ -325,6 +445,7 @@ int64 c_Memcache::t_increment(CStrRef key, int offset /*= 1*/) {
     raise_warning("Key cannot be empty");
     return false;
   }
+  forget(key);
 
   uint64_t value;
   memcached_return_t ret = memcached_increment(&m_memcache, key.c_str(),
@@ -343,6 +464,7 @@ int64 c_Memcache::t_decrement(CStrRef key, int offset /*= 1*/) {
     raise_warning("Key cannot be empty");
     return false;
   }
+  forget(key);
 
   uint64_t value;
   memcached_return_t ret = memcached_decrement(&m_memcache, key.c_str(),
@@ -357,6 +479,8 @@ int64 c_Memcache::t_decrement(CStrRef key, int offset /*= 1*/) {
 
 bool c_Memcache::t_close() {
   INSTANCE_METHOD_INJECTION_BUILTIN(Memcache, Memcache::close);
+  forgetAll();
+  m_deferred.clear();
   memcached_quit(&m_memcache);
   return true;
 }
@@ -390,6 +514,7 @@ Variant c_Memcache::t_getversion() {
 
 bool c_Memcache::t_flush(int expire /*= 0*/) {
   INSTANCE_METHOD_INJECTION_BUILTIN(Memcache, Memcache::flush);
+  forgetAll();
   return memcached_flush(&m_memcache, expire) == MEMCACHED_SUCCESS;
 }
 
@@ -611,6 +736,11 @@ Variant f_memcache_get(CObjRef memcache, CVarRef key,
   return memcache_obj->t_get(key, flags);
 }
 
+bool f_memcache_defer_get(CObjRef memcache, CVarRef key) {
+  c_Memcache *memcache_obj = memcache.getTyped<c_Memcache>();
+  return memcache_obj->deferGet(key);
+}
+
 bool f_memcache_delete(CObjRef memcache, CStrRef key, int expire /* = 0 */) {
   c_Memcache *memcache_obj = memcache.getTyped<c_Memcache>();
   return memcache_obj->t_delete(key, expire);
@@ -450,6 +450,59 @@ TypedValue* fg_memcache_get(HPHP::VM::ActRec *ar) {
 
 
 
+/*
+bool HPHP::f_memcache_defer_get(HPHP::Object const&, HPHP::Variant const&)
+_ZN4HPHP20f_memcache_defer_getERKNS_6ObjectERKNS_7VariantE
+
+(return value) => rax
+memcache => rdi
+key => rsi
+*/
+
+bool fh_memcache_defer_get(Value* memcache, TypedValue* key) asm("_ZN4HPHP20f_memcache_defer_getERKNS_6ObjectERKNS_7VariantE");
+
+TypedValue * fg1_memcache_defer_get(TypedValue* rv, HPHP::VM::ActRec* ar, long long count) __attribute__((noinline,cold));
+TypedValue * fg1_memcache_defer_get(TypedValue* rv, HPHP::VM::ActRec* ar, long long count) {
+  TypedValue* args UNUSED = ((TypedValue*)ar) - 1;
+  rv->_count = 0;
+  rv->m_type = KindOfBoolean;
+  tvCastToObjectInPlace(args-0);
+  rv->m_data.num = (fh_memcache_defer_get((Value*)(args-0), (args-1))) ? 1LL : 0LL;
+  return rv;
+}
+
+TypedValue* fg_memcache_defer_get(HPHP::VM::ActRec *ar) {
+    TypedValue rv;
+    long long count = ar->numArgs();
+    TypedValue* args UNUSED = ((TypedValue*)ar) - 1;
+    if (count == 2LL) {
+      if ((args-0)->m_type == KindOfObject) {
+        rv._count = 0;
+        rv.m_type = KindOfBoolean;
+        rv.m_data.num = (fh_memcache_defer_get((Value*)(args-0), (args-1))) ? 1LL : 0LL;
+        frame_free_locals_no_this_inl(ar, 2);
+        memcpy(&ar->m_r, &rv, sizeof(TypedValue));
+        return &ar->m_r;
+      } else {
+        fg1_memcache_defer_get(&rv, ar, count);
+        frame_free_locals_no_this_inl(ar, 2);
+        memcpy(&ar->m_r, &rv, sizeof(TypedValue));
+        return &ar->m_r;
+      }
+    } else {
+      throw_wrong_arguments_nr("memcache_defer_get", count, 2, 2, 1);
+    }
+    rv.m_data.num = 0LL;
+    rv._count = 0;
+    rv.m_type = KindOfNull;
+    frame_free_locals_no_this_inl(ar, 2);
+    memcpy(&ar->m_r, &rv, sizeof(TypedValue));
+    return &ar->m_r;
+  return &ar->m_r;
+}
+
+
+
 /*
 bool HPHP::f_memcache_delete(HPHP::Object const&, HPHP::String const&, int)
 _ZN4HPHP17f_memcache_deleteERKNS_6ObjectERKNS_6StringEi
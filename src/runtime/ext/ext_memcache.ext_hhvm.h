@@ -99,6 +99,17 @@ flags => rcx
 
 TypedValue* fh_memcache_get(TypedValue* _rv, Value* memcache, TypedValue* key, TypedValue* flags) asm("_ZN4HPHP14f_memcache_getERKNS_6ObjectERKNS_7VariantERKNS_14VRefParamValueE");
 
+/*
+bool HPHP::f_memcache_defer_get(HPHP::Object const&, HPHP::Variant const&)
+_ZN4HPHP20f_memcache_defer_getERKNS_6ObjectERKNS_7VariantE
+
+(return value) => rax
+memcache => rdi
+key => rsi
+*/
+
+bool fh_memcache_defer_get(Value* memcache, TypedValue* key) asm("_ZN4HPHP20f_memcache_defer_getERKNS_6ObjectERKNS_7VariantE");
+
 /*
 bool HPHP::f_memcache_delete(HPHP::Object const&, HPHP::String const&, int)
 _ZN4HPHP17f_memcache_deleteERKNS_6ObjectERKNS_6StringEi
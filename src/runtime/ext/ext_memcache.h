@@ -31,6 +31,7 @@ bool f_memcache_add(CObjRef memcache, CStrRef key, CVarRef var, int flag = 0, in
 bool f_memcache_set(CObjRef memcache, CStrRef key, CVarRef var, int flag = 0, int expire = 0);
 bool f_memcache_replace(CObjRef memcache, CStrRef key, CVarRef var, int flag = 0, int expire = 0);
 Variant f_memcache_get(CObjRef memcache, CVarRef key, VRefParam flags = null);
+bool f_memcache_defer_get(CObjRef memcache, CVarRef key);
 bool f_memcache_delete(CObjRef memcache, CStrRef key, int expire = 0);
 int64 f_memcache_increment(CObjRef memcache, CStrRef key, int offset = 1);
 int64 f_memcache_decrement(CObjRef memcache, CStrRef key, int offset = 1);
@@ -103,11 +104,34 @@ class c_Memcache : public ExtObjectData, public Sweepable {
   // implemented by HPHP
   public: c_Memcache *create();
 
+  /**
+   * Queues a key, or an array of keys, to be fetched by the next get() on
+   * this connection, all in one multiget.
+   */
+  bool deferGet(CVarRef key);
 
  private:
   memcached_st m_memcache;
   int m_compress_threshold;
   double m_min_compress_savings;
+
+  // request cache: key => value for hits, key => true for misses; kept
+  // apart because false is a perfectly good cached value. With
+  // memcache.request_cache off they only hold deferred values not read yet.
+  Array m_results;
+  Array m_misses;
+  // keys from deferGet() not fetched yet, as key => true
+  Array m_deferred;
+
+  /**
+   * Fetches keys together with everything deferred in one memcached_mget,
+   * filling found with the hits.
+   */
+  void dispatch(CArrRef keys, Array &found);
+  bool cached(CStrRef key) const;
+  void forget(CStrRef key);
+  void consumed(CStrRef key);
+  void forgetAll();
 };
 
 ///////////////////////////////////////////////////////////////////////////////
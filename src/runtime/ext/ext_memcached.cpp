@@ -18,6 +18,7 @@
 
 #include <runtime/ext/ext_memcached.h>
 #include <runtime/base/builtin_functions.h>
+#include <runtime/base/server/server_stats.h>
 #include <runtime/ext/ext_json.h>
 #include <zlib.h>
 
@@ -231,6 +232,8 @@ Variant c_Memcached::t_getbykey(CStrRef server_key, CStrRef key,
   size_t myServerKeyLen = server_key.length();
   const char *myKey = key.c_str();
   size_t myKeyLen = key.length();
+  ServerStats::Log("memcache.roundtrip", 1);
+  ServerStats::Log("memcache.key", 1);
   memcached_return status = memcached_mget_by_key(&m_impl->memcached,
       myServerKey, myServerKeyLen, &myKey, &myKeyLen, 1);
   if (!handleError(status)) return false;
@@ -380,6 +383,8 @@ bool c_Memcached::getMultiImpl(CStrRef server_key, CArrRef keys,
                          enableCas ? 1 : 0);
   const char *myServerKey = server_key.empty() ? NULL : server_key.c_str();
   size_t myServerKeyLen = server_key.length();
+  ServerStats::Log("memcache.roundtrip", 1);
+  ServerStats::Log("memcache.key", keysCopy.size());
   return handleError(memcached_mget_by_key(&m_impl->memcached,
       myServerKey, myServerKeyLen, keysCopy.data(), keysLengthCopy.data(),
       keysCopy.size()));
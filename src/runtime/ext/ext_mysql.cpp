@@ -23,10 +23,12 @@
 #include <runtime/base/server/server_stats.h>
 #include <runtime/base/util/request_local.h>
 #include <runtime/base/util/extended_logger.h>
+#include <runtime/base/zend/zend_strtod.h>
 #include <util/timer.h>
 #include <util/db_mysql.h>
 #include <netinet/in.h>
 #include <netdb.h>
+#include <poll.h>
 
 #include <system/lib/systemlib.h>
 
@@ -106,14 +108,23 @@ public:
     defaultConn.reset();
     readTimeout = RuntimeOption::MySQLReadTimeout;
     totalRowCount = 0;
+    asyncConns.clear();
   }
 
   virtual void requestShutdown() {
+    // a persistent link goes on to the next request, which must not find
+    // this one's result in the way
+    for (unsigned int i = 0; i < asyncConns.size(); i++) {
+      MySQL *mySQL = asyncConns[i].getTyped<MySQL>(true);
+      if (mySQL) mySQL->finishAsync(true);
+    }
+    asyncConns.clear();
     defaultConn.reset();
     totalRowCount = 0;
   }
 
   Object defaultConn;
+  std::vector<Object> asyncConns; // links that had mysql_async_query() sent
   int readTimeout;
   int totalRowCount; // from all queries in current request
 };
@@ -134,11 +145,15 @@ MySQL *MySQL::Get(CVarRef link_identifier) {
   return mysql;
 }
 
-MYSQL *MySQL::GetConn(CVarRef link_identifier, MySQL **rconn /* = NULL */) {
+MYSQL *MySQL::GetConn(CVarRef link_identifier, MySQL **rconn /* = NULL */,
+                      bool keepAsync /* = false */) {
   MySQL *mySQL = Get(link_identifier);
   MYSQL *ret = NULL;
   if (mySQL) {
     ret = mySQL->get();
+    if (ret && !keepAsync) {
+      mySQL->finishAsync();
+    }
   }
   if (ret == NULL) {
     raise_warning("supplied argument is not a valid MySQL-Link resource");
@@ -231,7 +246,7 @@ static MYSQL *create_new_conn() {
 MySQL::MySQL(const char *host, int port, const char *username,
              const char *password, const char *database)
     : m_port(port), m_last_error_set(false), m_last_errno(0),
-      m_xaction_count(0), m_multi_query(false) {
+      m_xaction_count(0), m_multi_query(false), m_async_state(AsyncIdle) {
   if (host) m_host = host;
   if (username) m_username = username;
   if (password) m_password = password;
@@ -259,11 +274,31 @@ void MySQL::close() {
     m_last_errno = 0;
     m_xaction_count = 0;
     m_last_error.clear();
+    m_async_state = AsyncIdle;
+    m_async_query.clear();
     mysql_close(m_conn);
     m_conn = NULL;
   }
 }
 
+void MySQL::finishAsync(bool quiet /* = false */) {
+  if (m_async_state == AsyncPending && m_conn) {
+    if (!quiet) {
+      raise_notice("runtime/ext_mysql: discarding unread result of [%s]",
+                   m_async_query.c_str());
+    }
+    IOStatusHelper io("mysql::async_discard", m_host.c_str(), m_port);
+    if (!mysql_read_query_result(m_conn)) {
+      MYSQL_RES *res = mysql_use_result(m_conn);
+      if (res) {
+        mysql_free_result(res); // reads and drops the remaining rows
+      }
+    }
+  }
+  m_async_state = AsyncIdle;
+  m_async_query.clear();
+}
+
 bool MySQL::connect(CStrRef host, int port, CStrRef socket, CStrRef username,
                     CStrRef password, CStrRef database,
                     int client_flags, int connect_timeout) {
@@ -562,6 +597,7 @@ static Variant php_mysql_do_connect(String server, String username,
     }
   } else {
     ret = mySQL;
+    mySQL->finishAsync(true);
     if (!mySQL->reconnect(host, port, socket, username, password,
                           database, client_flags, connect_timeout_ms)) {
       MySQL::SetDefaultConn(mySQL); // so we can report errno by mysql_errno()
@@ -727,6 +763,38 @@ Variant mysql_makevalue(CStrRef data, MYSQL_FIELD *mysql_field) {
   return data;
 }
 
+Variant mysql_makevalue(const char *data, int64 len, MYSQL_FIELD *mysql_field) {
+  bool isDouble = false;
+  switch (mysql_field->type) {
+  case MYSQL_TYPE_FLOAT:
+  case MYSQL_TYPE_DOUBLE:
+    isDouble = true;
+    // fall through
+  case MYSQL_TYPE_DECIMAL:
+  case MYSQL_TYPE_TINY:
+  case MYSQL_TYPE_SHORT:
+  case MYSQL_TYPE_LONG:
+  case MYSQL_TYPE_LONGLONG:
+  case MYSQL_TYPE_INT24:
+  case MYSQL_TYPE_YEAR: {
+    // numbers are short, so terminate a copy on the stack
+    char buf[64];
+    if (!data || len >= (int64)sizeof(buf)) break;
+    memcpy(buf, data, len);
+    buf[len] = '\0';
+    if (isDouble) {
+      return len ? zend_strtod(buf, NULL) : 0.0;
+    }
+    return (int64)strtoll(buf, NULL, 10);
+  }
+  case MYSQL_TYPE_NULL:
+    return null;
+  default:
+    break;
+  }
+  return mysql_makevalue(String(data, len, CopyString), mysql_field);
+}
+
 extern "C" {
 struct MEM_ROOT;
 unsigned long cli_safe_read(MYSQL *);
@@ -754,8 +822,7 @@ static bool php_mysql_read_rows(MYSQL *mysql, CVarRef result) {
       unsigned long len = net_field_length(&cp);
       Variant *data = NEW(Variant)();
       if (len != NULL_LENGTH) {
-        *data = mysql_makevalue(String((char *)cp, len, CopyString),
-                                mysql->fields + i);
+        *data = mysql_makevalue((const char *)cp, len, mysql->fields + i);
         cp += len;
         if (mysql->fields) {
           if (mysql->fields[i].max_length < len)
@@ -802,19 +869,17 @@ static Variant php_mysql_localize_result(MYSQL *mysql) {
   return result;
 }
 
-static Variant php_mysql_do_query_general(CStrRef query, CVarRef link_id,
-                                          bool use_store) {
+static bool php_mysql_skip_write(CStrRef query) {
   if (RuntimeOption::MySQLReadOnly &&
       same(f_preg_match("/^((\\/\\*.*?\\*\\/)|\\(|\\s)*select/i", query), 0)) {
     raise_notice("runtime/ext_mysql: write query not executed [%s]",
                     query.data());
-    return true; // pretend it worked
+    return true;
   }
+  return false;
+}
 
-  MySQL *rconn = NULL;
-  MYSQL *conn = MySQL::GetConn(link_id, &rconn);
-  if (!conn || !rconn) return false;
-
+static void php_mysql_record_stats(CStrRef query, MySQL *rconn) {
   if (RuntimeOption::EnableStats && RuntimeOption::EnableSQLStats) {
     ServerStats::Log("sql.query", 1);
 
@@ -871,6 +936,57 @@ static Variant php_mysql_do_query_general(CStrRef query, CVarRef link_id,
       }
     }
   }
+}
+
+/**
+ * Turns the result of a query that has just completed into what
+ * mysql_query() and friends return.
+ */
+static Variant php_mysql_make_result(MYSQL *conn, CStrRef query,
+                                     bool use_store) {
+  MYSQL_RES *mysql_result;
+  if (use_store) {
+    if (RuntimeOption::MySQLLocalize) {
+      return php_mysql_localize_result(conn);
+    }
+    mysql_result = mysql_store_result(conn);
+  } else {
+    mysql_result = mysql_use_result(conn);
+  }
+  if (!mysql_result) {
+    if (mysql_field_count(conn) > 0) {
+      raise_warning("Unable to save result set");
+      return false;
+    }
+    return true;
+  }
+
+  MySQLResult *r = NEWOBJ(MySQLResult)(mysql_result);
+  Object ret(r);
+
+  if (RuntimeOption::MaxSQLRowCount > 0 &&
+      (s_mysql_data->totalRowCount += r->getRowCount())
+      > RuntimeOption::MaxSQLRowCount) {
+    ExtendedLogger::Error
+      ("MaxSQLRowCount is over: fetching at least %d rows: %s",
+       s_mysql_data->totalRowCount, query.data());
+    s_mysql_data->totalRowCount = 0; // so no repetitive logging
+  }
+
+  return ret;
+}
+
+static Variant php_mysql_do_query_general(CStrRef query, CVarRef link_id,
+                                          bool use_store) {
+  if (php_mysql_skip_write(query)) {
+    return true; // pretend it worked
+  }
+
+  MySQL *rconn = NULL;
+  MYSQL *conn = MySQL::GetConn(link_id, &rconn);
+  if (!conn || !rconn) return false;
+
+  php_mysql_record_stats(query, rconn);
 
   SlowTimer timer(RuntimeOption::MySQLSlowQueryThreshold,
                   "runtime/ext_mysql: slow query", query.data());
@@ -920,36 +1036,7 @@ static Variant php_mysql_do_query_general(CStrRef query, CVarRef link_id,
   Logger::Verbose("runtime/ext_mysql: successfully executed [%dms] [%s]",
                   (int)timer.getTime(), query.data());
 
-  MYSQL_RES *mysql_result;
-  if (use_store) {
-    if (RuntimeOption::MySQLLocalize) {
-      return php_mysql_localize_result(conn);
-    }
-    mysql_result = mysql_store_result(conn);
-  } else {
-    mysql_result = mysql_use_result(conn);
-  }
-  if (!mysql_result) {
-    if (mysql_field_count(conn) > 0) {
-      raise_warning("Unable to save result set");
-      return false;
-    }
-    return true;
-  }
-
-  MySQLResult *r = NEWOBJ(MySQLResult)(mysql_result);
-  Object ret(r);
-
-  if (RuntimeOption::MaxSQLRowCount > 0 &&
-      (s_mysql_data->totalRowCount += r->getRowCount())
-      > RuntimeOption::MaxSQLRowCount) {
-    ExtendedLogger::Error
-      ("MaxSQLRowCount is over: fetching at least %d rows: %s",
-       s_mysql_data->totalRowCount, query.data());
-    s_mysql_data->totalRowCount = 0; // so no repetitive logging
-  }
-
-  return ret;
+  return php_mysql_make_result(conn, query, use_store);
 }
 
 Variant f_mysql_query(CStrRef query, CVarRef link_identifier /* = null */) {
@@ -959,6 +1046,7 @@ Variant f_mysql_query(CStrRef query, CVarRef link_identifier /* = null */) {
 Variant f_mysql_multi_query(CStrRef query, CVarRef link_identifier /* = null */) {
   MYSQL *conn = MySQL::GetConn(link_identifier);
   MySQL *mySQL = MySQL::Get(link_identifier);
+  if (!conn || !mySQL) return false;
   if (!mySQL->m_multi_query && !mysql_set_server_option(conn, MYSQL_OPTION_MULTI_STATEMENTS_ON)) {
     mySQL->m_multi_query = true;
   }
@@ -1012,6 +1100,123 @@ Variant f_mysql_unbuffered_query(CStrRef query,
   return php_mysql_do_query_general(query, link_identifier, false);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// async queries
+
+bool f_mysql_async_query(CStrRef query, CVarRef link_identifier /* = null */) {
+  MySQL *rconn = NULL;
+  MYSQL *conn = MySQL::GetConn(link_identifier, &rconn);
+  if (!conn || !rconn) return false;
+
+  if (php_mysql_skip_write(query)) {
+    rconn->m_async_state = MySQL::AsyncSkipped;
+    return true; // pretend it worked
+  }
+
+  php_mysql_record_stats(query, rconn);
+
+  if (rconn->m_multi_query &&
+      !mysql_set_server_option(conn, MYSQL_OPTION_MULTI_STATEMENTS_OFF)) {
+    rconn->m_multi_query = false;
+  }
+
+  IOStatusHelper io("mysql::async_query", rconn->m_host.c_str(),
+                    rconn->m_port);
+  if (mysql_send_query(conn, query.data(), query.size())) {
+    raise_notice("runtime/ext_mysql: failed sending [%s] [%s]", query.data(),
+                 mysql_error(conn));
+    return false;
+  }
+  rconn->m_async_state = MySQL::AsyncPending;
+  rconn->m_async_query = string(query.data(), query.size());
+  std::vector<Object> &asyncConns = s_mysql_data->asyncConns;
+  bool tracked = false;
+  for (unsigned int i = 0; i < asyncConns.size() && !tracked; i++) {
+    tracked = asyncConns[i].get() == rconn;
+  }
+  if (!tracked) asyncConns.push_back(Object(rconn));
+  return true;
+}
+
+Variant f_mysql_async_wait(CArrRef links, int timeout_ms /* = -1 */) {
+  Array ready = Array::Create();
+  std::vector<pollfd> fds;
+  std::vector<Variant> keys;
+  for (ArrayIter iter = links.begin(); !iter.end(); ++iter) {
+    MySQL *mySQL = MySQL::Get(iter.second());
+    if (!mySQL || !mySQL->get()) {
+      raise_warning("supplied argument is not a valid MySQL-Link resource");
+      return false;
+    }
+    if (mySQL->m_async_state == MySQL::AsyncSkipped) {
+      ready.append(iter.first());
+    } else if (mySQL->m_async_state == MySQL::AsyncPending) {
+      pollfd fd;
+      fd.fd = mySQL->get()->net.fd;
+      fd.events = POLLIN;
+      fd.revents = 0;
+      fds.push_back(fd);
+      keys.push_back(iter.first());
+    }
+  }
+  if (fds.empty()) {
+    return ready;
+  }
+
+  if (!ready.empty()) {
+    timeout_ms = 0; // only pick up whatever else is ready already
+  } else if (timeout_ms < 0) {
+    timeout_ms = s_mysql_data->readTimeout > 0 ? s_mysql_data->readTimeout : -1;
+  }
+
+  IOStatusHelper io("mysql::async_wait");
+  int n;
+  do {
+    n = poll(&fds[0], fds.size(), timeout_ms);
+  } while (n < 0 && errno == EINTR);
+  if (n < 0) {
+    raise_warning("mysql_async_wait(): poll failed: %s",
+                  Util::safe_strerror(errno).c_str());
+    return false;
+  }
+  for (unsigned int i = 0; i < fds.size(); i++) {
+    // errors and hangups are ready too: reading the result reports them
+    if (fds[i].revents) {
+      ready.append(keys[i]);
+    }
+  }
+  return ready;
+}
+
+Variant f_mysql_async_result(CVarRef link_identifier /* = null */,
+                             bool buffered /* = true */) {
+  MySQL *rconn = NULL;
+  MYSQL *conn = MySQL::GetConn(link_identifier, &rconn, true);
+  if (!conn || !rconn) return false;
+
+  if (rconn->m_async_state == MySQL::AsyncSkipped) {
+    rconn->m_async_state = MySQL::AsyncIdle;
+    return true;
+  }
+  if (rconn->m_async_state != MySQL::AsyncPending) {
+    raise_warning("mysql_async_result(): no query pending on this link");
+    return false;
+  }
+
+  String query(rconn->m_async_query);
+  rconn->m_async_state = MySQL::AsyncIdle;
+  rconn->m_async_query.clear();
+
+  IOStatusHelper io("mysql::async_result", rconn->m_host.c_str(),
+                    rconn->m_port);
+  if (mysql_read_query_result(conn)) {
+    raise_notice("runtime/ext_mysql: failed executing [%s] [%s]",
+                 query.data(), mysql_error(conn));
+    return false;
+  }
+  return php_mysql_make_result(conn, query, buffered);
+}
+
 Variant f_mysql_list_dbs(CVarRef link_identifier /* = null */) {
   MYSQL *conn = MySQL::GetConn(link_identifier);
   if (!conn) return false;
@@ -1072,11 +1277,15 @@ static Variant php_mysql_fetch_hash(CVarRef result, int result_type) {
   MySQLResult *res = get_result(result);
   if (res == NULL) return false;
 
-  Array ret;
+  int fields = res->getFieldCount();
+  int size = (result_type & MYSQL_NUM) && (result_type & MYSQL_ASSOC) ?
+    fields * 2 : fields;
+
   if (res->isLocalized()) {
     if (!res->fetchRow()) return false;
 
-    for (int i = 0; i < res->getFieldCount(); i++) {
+    ArrayInit ret(size);
+    for (int i = 0; i < fields; i++) {
       if (result_type & MYSQL_NUM) {
         ret.set(i, res->getField(i));
       }
@@ -1085,7 +1294,7 @@ static Variant php_mysql_fetch_hash(CVarRef result, int result_type) {
         ret.set(info->name->toString(), res->getField(i));
       }
     }
-    return ret;
+    return Array(ret.create());
   }
 
   MYSQL_RES *mysql_result = res->get();
@@ -1098,25 +1307,30 @@ static Variant php_mysql_fetch_hash(CVarRef result, int result_type) {
     return false;
   }
 
-  mysql_field_seek(mysql_result, 0);
-
-  MYSQL_FIELD *mysql_field;
-  int i;
-  for (mysql_field = mysql_fetch_field(mysql_result), i = 0; mysql_field;
-       mysql_field = mysql_fetch_field(mysql_result), i++) {
+  // column names come from the result's field info, which is built once, so
+  // every row shares the same key strings
+  MYSQL_FIELD *mysql_fields = mysql_fetch_fields(mysql_result);
+  ArrayInit ret(size);
+  for (int i = 0; i < fields; i++) {
     Variant data;
     if (mysql_row[i]) {
-      data = mysql_makevalue(String(mysql_row[i], mysql_row_lengths[i],
-                                    CopyString), mysql_field);
+      data = mysql_makevalue(mysql_row[i], mysql_row_lengths[i],
+                             mysql_fields + i);
     }
     if (result_type & MYSQL_NUM) {
       ret.set(i, data);
     }
     if (result_type & MYSQL_ASSOC) {
-      ret.set(String(mysql_field->name, CopyString), data);
+      MySQLFieldInfo *info = res->getFieldInfo(i);
+      if (info) {
+        ret.set(info->name->toString(), data);
+      } else {
+        ret.set(String(mysql_fields[i].name, CopyString), data);
+      }
     }
   }
-  return ret;
+  mysql_field_seek(mysql_result, fields);
+  return Array(ret.create());
 }
 
 Variant f_mysql_fetch_row(CVarRef result) {
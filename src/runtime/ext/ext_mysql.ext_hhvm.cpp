@@ -918,6 +918,177 @@ TypedValue* fg_mysql_unbuffered_query(HPHP::VM::ActRec *ar) {
 
 
 
+/*
+bool HPHP::f_mysql_async_query(HPHP::String const&, HPHP::Variant const&)
+_ZN4HPHP19f_mysql_async_queryERKNS_6StringERKNS_7VariantE
+
+(return value) => rax
+query => rdi
+link_identifier => rsi
+*/
+
+bool fh_mysql_async_query(Value* query, TypedValue* link_identifier) asm("_ZN4HPHP19f_mysql_async_queryERKNS_6StringERKNS_7VariantE");
+
+TypedValue * fg1_mysql_async_query(TypedValue* rv, HPHP::VM::ActRec* ar, long long count) __attribute__((noinline,cold));
+TypedValue * fg1_mysql_async_query(TypedValue* rv, HPHP::VM::ActRec* ar, long long count) {
+  TypedValue* args UNUSED = ((TypedValue*)ar) - 1;
+  rv->_count = 0;
+  rv->m_type = KindOfBoolean;
+  tvCastToStringInPlace(args-0);
+  Variant defVal1;
+  rv->m_data.num = (fh_mysql_async_query((Value*)(args-0), (count > 1) ? (args-1) : (TypedValue*)(&defVal1))) ? 1LL : 0LL;
+  return rv;
+}
+
+TypedValue* fg_mysql_async_query(HPHP::VM::ActRec *ar) {
+    TypedValue rv;
+    long long count = ar->numArgs();
+    TypedValue* args UNUSED = ((TypedValue*)ar) - 1;
+    if (count >= 1LL && count <= 2LL) {
+      if (IS_STRING_TYPE((args-0)->m_type)) {
+        rv._count = 0;
+        rv.m_type = KindOfBoolean;
+        Variant defVal1;
+        rv.m_data.num = (fh_mysql_async_query((Value*)(args-0), (count > 1) ? (args-1) : (TypedValue*)(&defVal1))) ? 1LL : 0LL;
+        frame_free_locals_no_this_inl(ar, 2);
+        memcpy(&ar->m_r, &rv, sizeof(TypedValue));
+        return &ar->m_r;
+      } else {
+        fg1_mysql_async_query(&rv, ar, count);
+        frame_free_locals_no_this_inl(ar, 2);
+        memcpy(&ar->m_r, &rv, sizeof(TypedValue));
+        return &ar->m_r;
+      }
+    } else {
+      throw_wrong_arguments_nr("mysql_async_query", count, 1, 2, 1);
+    }
+    rv.m_data.num = 0LL;
+    rv._count = 0;
+    rv.m_type = KindOfNull;
+    frame_free_locals_no_this_inl(ar, 2);
+    memcpy(&ar->m_r, &rv, sizeof(TypedValue));
+    return &ar->m_r;
+  return &ar->m_r;
+}
+
+
+
+/*
+HPHP::Variant HPHP::f_mysql_async_wait(HPHP::Array const&, int)
+_ZN4HPHP18f_mysql_async_waitERKNS_5ArrayEi
+
+(return value) => rax
+_rv => rdi
+links => rsi
+timeout_ms => rdx
+*/
+
+TypedValue* fh_mysql_async_wait(TypedValue* _rv, Value* links, int timeout_ms) asm("_ZN4HPHP18f_mysql_async_waitERKNS_5ArrayEi");
+
+TypedValue * fg1_mysql_async_wait(TypedValue* rv, HPHP::VM::ActRec* ar, long long count) __attribute__((noinline,cold));
+TypedValue * fg1_mysql_async_wait(TypedValue* rv, HPHP::VM::ActRec* ar, long long count) {
+  TypedValue* args UNUSED = ((TypedValue*)ar) - 1;
+  switch (count) {
+  default: // count >= 2
+    if ((args-1)->m_type != KindOfInt64) {
+      tvCastToInt64InPlace(args-1);
+    }
+  case 1:
+    break;
+  }
+  if ((args-0)->m_type != KindOfArray) {
+    tvCastToArrayInPlace(args-0);
+  }
+  fh_mysql_async_wait((rv), (Value*)(args-0), (count > 1) ? (int)(args[-1].m_data.num) : (int)(-1));
+  if (rv->m_type == KindOfUninit) rv->m_type = KindOfNull;
+  return rv;
+}
+
+TypedValue* fg_mysql_async_wait(HPHP::VM::ActRec *ar) {
+    TypedValue rv;
+    long long count = ar->numArgs();
+    TypedValue* args UNUSED = ((TypedValue*)ar) - 1;
+    if (count >= 1LL && count <= 2LL) {
+      if ((count <= 1 || (args-1)->m_type == KindOfInt64) && (args-0)->m_type == KindOfArray) {
+        fh_mysql_async_wait((&(rv)), (Value*)(args-0), (count > 1) ? (int)(args[-1].m_data.num) : (int)(-1));
+        if (rv.m_type == KindOfUninit) rv.m_type = KindOfNull;
+        frame_free_locals_no_this_inl(ar, 2);
+        memcpy(&ar->m_r, &rv, sizeof(TypedValue));
+        return &ar->m_r;
+      } else {
+        fg1_mysql_async_wait(&rv, ar, count);
+        frame_free_locals_no_this_inl(ar, 2);
+        memcpy(&ar->m_r, &rv, sizeof(TypedValue));
+        return &ar->m_r;
+      }
+    } else {
+      throw_wrong_arguments_nr("mysql_async_wait", count, 1, 2, 1);
+    }
+    rv.m_data.num = 0LL;
+    rv._count = 0;
+    rv.m_type = KindOfNull;
+    frame_free_locals_no_this_inl(ar, 2);
+    memcpy(&ar->m_r, &rv, sizeof(TypedValue));
+    return &ar->m_r;
+  return &ar->m_r;
+}
+
+
+
+/*
+HPHP::Variant HPHP::f_mysql_async_result(HPHP::Variant const&, bool)
+_ZN4HPHP20f_mysql_async_resultERKNS_7VariantEb
+
+(return value) => rax
+_rv => rdi
+link_identifier => rsi
+buffered => rdx
+*/
+
+TypedValue* fh_mysql_async_result(TypedValue* _rv, TypedValue* link_identifier, bool buffered) asm("_ZN4HPHP20f_mysql_async_resultERKNS_7VariantEb");
+
+TypedValue * fg1_mysql_async_result(TypedValue* rv, HPHP::VM::ActRec* ar, long long count) __attribute__((noinline,cold));
+TypedValue * fg1_mysql_async_result(TypedValue* rv, HPHP::VM::ActRec* ar, long long count) {
+  TypedValue* args UNUSED = ((TypedValue*)ar) - 1;
+  tvCastToBooleanInPlace(args-1);
+  Variant defVal0;
+  fh_mysql_async_result((rv), (count > 0) ? (args-0) : (TypedValue*)(&defVal0), (count > 1) ? (bool)(args[-1].m_data.num) : (bool)(true));
+  if (rv->m_type == KindOfUninit) rv->m_type = KindOfNull;
+  return rv;
+}
+
+TypedValue* fg_mysql_async_result(HPHP::VM::ActRec *ar) {
+    TypedValue rv;
+    long long count = ar->numArgs();
+    TypedValue* args UNUSED = ((TypedValue*)ar) - 1;
+    if (count <= 2LL) {
+      if ((count <= 1 || (args-1)->m_type == KindOfBoolean)) {
+        Variant defVal0;
+        fh_mysql_async_result((&(rv)), (count > 0) ? (args-0) : (TypedValue*)(&defVal0), (count > 1) ? (bool)(args[-1].m_data.num) : (bool)(true));
+        if (rv.m_type == KindOfUninit) rv.m_type = KindOfNull;
+        frame_free_locals_no_this_inl(ar, 2);
+        memcpy(&ar->m_r, &rv, sizeof(TypedValue));
+        return &ar->m_r;
+      } else {
+        fg1_mysql_async_result(&rv, ar, count);
+        frame_free_locals_no_this_inl(ar, 2);
+        memcpy(&ar->m_r, &rv, sizeof(TypedValue));
+        return &ar->m_r;
+      }
+    } else {
+      throw_toomany_arguments_nr("mysql_async_result", 2, 1);
+    }
+    rv.m_data.num = 0LL;
+    rv._count = 0;
+    rv.m_type = KindOfNull;
+    frame_free_locals_no_this_inl(ar, 2);
+    memcpy(&ar->m_r, &rv, sizeof(TypedValue));
+    return &ar->m_r;
+  return &ar->m_r;
+}
+
+
+
 /*
 HPHP::Variant HPHP::f_mysql_list_dbs(HPHP::Variant const&)
 _ZN4HPHP16f_mysql_list_dbsERKNS_7VariantE
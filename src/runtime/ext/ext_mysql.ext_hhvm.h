@@ -218,6 +218,41 @@ link_identifier => rdx
 
 TypedValue* fh_mysql_unbuffered_query(TypedValue* _rv, Value* query, TypedValue* link_identifier) asm("_ZN4HPHP24f_mysql_unbuffered_queryERKNS_6StringERKNS_7VariantE");
 
+/*
+bool HPHP::f_mysql_async_query(HPHP::String const&, HPHP::Variant const&)
+_ZN4HPHP19f_mysql_async_queryERKNS_6StringERKNS_7VariantE
+
+(return value) => rax
+query => rdi
+link_identifier => rsi
+*/
+
+bool fh_mysql_async_query(Value* query, TypedValue* link_identifier) asm("_ZN4HPHP19f_mysql_async_queryERKNS_6StringERKNS_7VariantE");
+
+/*
+HPHP::Variant HPHP::f_mysql_async_wait(HPHP::Array const&, int)
+_ZN4HPHP18f_mysql_async_waitERKNS_5ArrayEi
+
+(return value) => rax
+_rv => rdi
+links => rsi
+timeout_ms => rdx
+*/
+
+TypedValue* fh_mysql_async_wait(TypedValue* _rv, Value* links, int timeout_ms) asm("_ZN4HPHP18f_mysql_async_waitERKNS_5ArrayEi");
+
+/*
+HPHP::Variant HPHP::f_mysql_async_result(HPHP::Variant const&, bool)
+_ZN4HPHP20f_mysql_async_resultERKNS_7VariantEb
+
+(return value) => rax
+_rv => rdi
+link_identifier => rsi
+buffered => rdx
+*/
+
+TypedValue* fh_mysql_async_result(TypedValue* _rv, TypedValue* link_identifier, bool buffered) asm("_ZN4HPHP20f_mysql_async_resultERKNS_7VariantEb");
+
 /*
 HPHP::Variant HPHP::f_mysql_list_dbs(HPHP::Variant const&)
 _ZN4HPHP16f_mysql_list_dbsERKNS_7VariantE
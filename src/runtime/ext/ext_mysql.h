@@ -34,9 +34,12 @@ namespace HPHP {
 class MySQL : public SweepableResourceData {
 public:
   /**
-   * Operations on a resource object.
+   * Operations on a resource object. GetConn() first reads and throws away
+   * the result of a pending mysql_async_query() on the link, unless
+   * keepAsync, so any other command finds the connection in sync.
    */
-  static MYSQL *GetConn(CVarRef link_identifier, MySQL **rconn = NULL);
+  static MYSQL *GetConn(CVarRef link_identifier, MySQL **rconn = NULL,
+                        bool keepAsync = false);
   static MySQL *Get(CVarRef link_identifier);
   static bool CloseConn(CVarRef link_identifier);
 
@@ -108,6 +111,22 @@ public:
 
   MYSQL *get() { return m_conn;}
 
+  /**
+   * Where a query sent by mysql_async_query() is at.
+   */
+  enum AsyncState {
+    AsyncIdle,
+    AsyncPending,   // sent, result not read yet
+    AsyncSkipped,   // write query dropped because of MySQLReadOnly
+  };
+
+  /**
+   * Reads and throws away the result of a pending async query, so the
+   * connection can take another command. Raises a notice about it unless
+   * quiet.
+   */
+  void finishAsync(bool quiet = false);
+
 private:
   MYSQL *m_conn;
 
@@ -122,6 +141,8 @@ public:
   std::string m_last_error;
   int m_xaction_count;
   bool m_multi_query;
+  AsyncState m_async_state;
+  std::string m_async_query;
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -337,6 +358,12 @@ inline Variant f_mysql_affected_rows(CVarRef link_identifier = null) {
 
 Variant mysql_makevalue(CStrRef data, MYSQL_FIELD *mysql_field);
 
+/**
+ * Same, straight from a column's bytes as libmysql returns them, which need
+ * not be NUL-terminated. Numeric columns never become a String on the way.
+ */
+Variant mysql_makevalue(const char *data, int64 len, MYSQL_FIELD *mysql_field);
+
 bool f_mysql_set_timeout(int query_timeout_ms = -1,
                          CVarRef link_identifier = null);
 
@@ -351,6 +378,10 @@ Variant f_mysql_fetch_result(CVarRef link_identifier = null);
 
 Variant f_mysql_unbuffered_query(CStrRef query,
                                  CVarRef link_identifier = null);
+bool f_mysql_async_query(CStrRef query, CVarRef link_identifier = null);
+Variant f_mysql_async_wait(CArrRef links, int timeout_ms = -1);
+Variant f_mysql_async_result(CVarRef link_identifier = null,
+                             bool buffered = true);
 inline Variant f_mysql_db_query(CStrRef database, CStrRef query,
                                 CVarRef link_identifier = null) {
   throw NotSupportedException
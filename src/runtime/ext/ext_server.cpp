@@ -143,6 +143,34 @@ String f_pagelet_server_task_result(CObjRef task, VRefParam headers,
   return response;
 }
 
+Array f_pagelet_server_task_start_batch(CArrRef requests) {
+  String remote_host;
+  Transport *transport = g_context->getTransport();
+  if (transport) {
+    remote_host = transport->getRemoteHost();
+    if (RuntimeOption::SandboxMode) {
+      String host = transport->getHeader("Host");
+      Array tmp = requests;
+      for (ArrayIter iter(requests); iter; ++iter) {
+        Array request = iter.second().toArray();
+        Array headers = request["headers"].toArray();
+        if (!headers.exists("Host")) {
+          headers.set("Host", host);
+          request.set("headers", headers);
+          tmp.set(iter.first(), request);
+        }
+      }
+      return PageletServer::TaskStartBatch(tmp, remote_host);
+    }
+  }
+  return PageletServer::TaskStartBatch(requests, remote_host);
+}
+
+Array f_pagelet_server_task_select(CArrRef tasks,
+                                   int64 timeout_ms /* = 0 */) {
+  return PageletServer::TaskSelect(tasks, timeout_ms);
+}
+
 void f_pagelet_server_flush() {
   ExecutionContext *context = g_context.getNoCheck();
   Transport *transport = context->getTransport();
@@ -340,6 +340,127 @@ TypedValue* fg_pagelet_server_task_result(HPHP::VM::ActRec *ar) {
 
 
 
+/*
+HPHP::Array HPHP::f_pagelet_server_task_start_batch(HPHP::Array const&)
+_ZN4HPHP33f_pagelet_server_task_start_batchERKNS_5ArrayE
+
+(return value) => rax
+_rv => rdi
+requests => rsi
+*/
+
+Value* fh_pagelet_server_task_start_batch(Value* _rv, Value* requests) asm("_ZN4HPHP33f_pagelet_server_task_start_batchERKNS_5ArrayE");
+
+TypedValue * fg1_pagelet_server_task_start_batch(TypedValue* rv, HPHP::VM::ActRec* ar, long long count) __attribute__((noinline,cold));
+TypedValue * fg1_pagelet_server_task_start_batch(TypedValue* rv, HPHP::VM::ActRec* ar, long long count) {
+  TypedValue* args UNUSED = ((TypedValue*)ar) - 1;
+  rv->_count = 0;
+  rv->m_type = KindOfArray;
+  tvCastToArrayInPlace(args-0);
+  fh_pagelet_server_task_start_batch((Value*)(rv), (Value*)(args-0));
+  if (rv->m_data.num == 0LL) rv->m_type = KindOfNull;
+  return rv;
+}
+
+TypedValue* fg_pagelet_server_task_start_batch(HPHP::VM::ActRec *ar) {
+    TypedValue rv;
+    long long count = ar->numArgs();
+    TypedValue* args UNUSED = ((TypedValue*)ar) - 1;
+    if (count == 1LL) {
+      if ((args-0)->m_type == KindOfArray) {
+        rv._count = 0;
+        rv.m_type = KindOfArray;
+        fh_pagelet_server_task_start_batch((Value*)(&(rv)), (Value*)(args-0));
+        if (rv.m_data.num == 0LL) rv.m_type = KindOfNull;
+        frame_free_locals_no_this_inl(ar, 1);
+        memcpy(&ar->m_r, &rv, sizeof(TypedValue));
+        return &ar->m_r;
+      } else {
+        fg1_pagelet_server_task_start_batch(&rv, ar, count);
+        frame_free_locals_no_this_inl(ar, 1);
+        memcpy(&ar->m_r, &rv, sizeof(TypedValue));
+        return &ar->m_r;
+      }
+    } else {
+      throw_wrong_arguments_nr("pagelet_server_task_start_batch", count, 1, 1, 1);
+    }
+    rv.m_data.num = 0LL;
+    rv._count = 0;
+    rv.m_type = KindOfNull;
+    frame_free_locals_no_this_inl(ar, 1);
+    memcpy(&ar->m_r, &rv, sizeof(TypedValue));
+    return &ar->m_r;
+  return &ar->m_r;
+}
+
+
+
+/*
+HPHP::Array HPHP::f_pagelet_server_task_select(HPHP::Array const&, long long)
+_ZN4HPHP28f_pagelet_server_task_selectERKNS_5ArrayEx
+
+(return value) => rax
+_rv => rdi
+tasks => rsi
+timeout_ms => rdx
+*/
+
+Value* fh_pagelet_server_task_select(Value* _rv, Value* tasks, long long timeout_ms) asm("_ZN4HPHP28f_pagelet_server_task_selectERKNS_5ArrayEx");
+
+TypedValue * fg1_pagelet_server_task_select(TypedValue* rv, HPHP::VM::ActRec* ar, long long count) __attribute__((noinline,cold));
+TypedValue * fg1_pagelet_server_task_select(TypedValue* rv, HPHP::VM::ActRec* ar, long long count) {
+  TypedValue* args UNUSED = ((TypedValue*)ar) - 1;
+  rv->_count = 0;
+  rv->m_type = KindOfArray;
+  switch (count) {
+  default: // count >= 2
+    if ((args-1)->m_type != KindOfInt64) {
+      tvCastToInt64InPlace(args-1);
+    }
+  case 1:
+    break;
+  }
+  if ((args-0)->m_type != KindOfArray) {
+    tvCastToArrayInPlace(args-0);
+  }
+  fh_pagelet_server_task_select((Value*)(rv), (Value*)(args-0), (count > 1) ? (long long)(args[-1].m_data.num) : (long long)(0));
+  if (rv->m_data.num == 0LL) rv->m_type = KindOfNull;
+  return rv;
+}
+
+TypedValue* fg_pagelet_server_task_select(HPHP::VM::ActRec *ar) {
+    TypedValue rv;
+    long long count = ar->numArgs();
+    TypedValue* args UNUSED = ((TypedValue*)ar) - 1;
+    if (count >= 1LL && count <= 2LL) {
+      if ((count <= 1 || (args-1)->m_type == KindOfInt64) && (args-0)->m_type == KindOfArray) {
+        rv._count = 0;
+        rv.m_type = KindOfArray;
+        fh_pagelet_server_task_select((Value*)(&(rv)), (Value*)(args-0), (count > 1) ? (long long)(args[-1].m_data.num) : (long long)(0));
+        if (rv.m_data.num == 0LL) rv.m_type = KindOfNull;
+        frame_free_locals_no_this_inl(ar, 2);
+        memcpy(&ar->m_r, &rv, sizeof(TypedValue));
+        return &ar->m_r;
+      } else {
+        fg1_pagelet_server_task_select(&rv, ar, count);
+        frame_free_locals_no_this_inl(ar, 2);
+        memcpy(&ar->m_r, &rv, sizeof(TypedValue));
+        return &ar->m_r;
+      }
+    } else {
+      throw_wrong_arguments_nr("pagelet_server_task_select", count, 1, 2, 1);
+    }
+    rv.m_data.num = 0LL;
+    rv._count = 0;
+    rv.m_type = KindOfNull;
+    frame_free_locals_no_this_inl(ar, 2);
+    memcpy(&ar->m_r, &rv, sizeof(TypedValue));
+    return &ar->m_r;
+  return &ar->m_r;
+}
+
+
+
 /*
 void HPHP::f_pagelet_server_flush()
 _ZN4HPHP22f_pagelet_server_flushEv
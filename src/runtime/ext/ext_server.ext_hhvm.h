@@ -82,6 +82,29 @@ timeout_ms => r8
 
 Value* fh_pagelet_server_task_result(Value* _rv, Value* task, TypedValue* headers, TypedValue* code, long long timeout_ms) asm("_ZN4HPHP28f_pagelet_server_task_resultERKNS_6ObjectERKNS_14VRefParamValueES5_x");
 
+/*
+HPHP::Array HPHP::f_pagelet_server_task_start_batch(HPHP::Array const&)
+_ZN4HPHP33f_pagelet_server_task_start_batchERKNS_5ArrayE
+
+(return value) => rax
+_rv => rdi
+requests => rsi
+*/
+
+Value* fh_pagelet_server_task_start_batch(Value* _rv, Value* requests) asm("_ZN4HPHP33f_pagelet_server_task_start_batchERKNS_5ArrayE");
+
+/*
+HPHP::Array HPHP::f_pagelet_server_task_select(HPHP::Array const&, long long)
+_ZN4HPHP28f_pagelet_server_task_selectERKNS_5ArrayEx
+
+(return value) => rax
+_rv => rdi
+tasks => rsi
+timeout_ms => rdx
+*/
+
+Value* fh_pagelet_server_task_select(Value* _rv, Value* tasks, long long timeout_ms) asm("_ZN4HPHP28f_pagelet_server_task_selectERKNS_5ArrayEx");
+
 /*
 void HPHP::f_pagelet_server_flush()
 _ZN4HPHP22f_pagelet_server_flushEv
@@ -17,6 +17,7 @@
 
 #include <runtime/ext/pdo_mysql.h>
 #include <runtime/ext/ext_stream.h>
+#include <runtime/base/runtime_option.h>
 #include <mysql/mysql.h>
 
 #ifdef PHP_MYSQL_UNIX_SOCK_ADDR
@@ -70,8 +71,19 @@ public:
   unsigned long max_buffer_size() const { return m_max_buffer_size;}
   bool fetch_table_names() const { return m_fetch_table_names;}
 
+  /**
+   * Server-side statements released by PDOMySqlStatement, keyed by the SQL
+   * they were prepared from. takeStatement() hands one out (or NULL), and
+   * cacheStatement() takes ownership back, closing it if the cache is full.
+   */
+  MYSQL_STMT *takeStatement(CStrRef sql);
+  void cacheStatement(CStrRef sql, MYSQL_STMT *stmt);
+
 private:
+  typedef hphp_string_map<MYSQL_STMT*> StatementMap;
+
   MYSQL         *m_server;
+  StatementMap   m_stmt_cache;
   unsigned       m_attached:1;
   unsigned       m_buffered:1;
   unsigned       m_emulate_prepare:1;
@@ -79,6 +91,8 @@ private:
   unsigned       m__reserved:31;
   unsigned long  m_max_buffer_size;
   PDOMySqlError  m_einfo;
+
+  void closeStatements();
 };
 
 class PDOMySqlStatement : public PDOStatement {
@@ -101,6 +115,10 @@ public:
   MYSQL_STMT *stmt() { return m_stmt;}
 
 private:
+  friend class PDOMySqlConnection;
+
+  bool buffered() const { return m_buffered;}
+
   PDOMySqlConnection *m_conn;
   MYSQL              *m_server;
   MYSQL_RES          *m_result;
@@ -118,6 +136,8 @@ private:
   unsigned long      *m_out_length;
   unsigned int        m_params_given;
   unsigned            m_max_length:1;
+  unsigned            m_buffered:1;
+  String              m_stmt_sql; // key m_stmt goes back under, if cacheable
 
   void setRowCount();
   bool executePrepared();
@@ -230,6 +250,7 @@ PDOMySqlConnection::PDOMySqlConnection()
 }
 
 PDOMySqlConnection::~PDOMySqlConnection() {
+  closeStatements();
   if (m_server) {
     mysql_close(m_server);
   }
@@ -391,6 +412,7 @@ bool PDOMySqlConnection::support(SupportedMethod method) {
 }
 
 bool PDOMySqlConnection::closer() {
+  closeStatements();
   if (m_server) {
     mysql_close(m_server);
     m_server = NULL;
@@ -467,6 +489,14 @@ bool PDOMySqlConnection::preparer(CStrRef sql, sp_PDOStatement *stmt,
   PDOMySqlStatement *s = new PDOMySqlStatement(this, m_server);
   *stmt = s;
 
+  if (options.isArray()) {
+    /* PDO::MYSQL_ATTR_USE_BUFFERED_QUERY => false streams rows as they are
+       fetched instead of reading the whole result set on execute() */
+    s->m_buffered = pdo_attr_lval(options.toArray(),
+                                  PDO_MYSQL_ATTR_USE_BUFFERED_QUERY,
+                                  m_buffered) != 0;
+  }
+
   if (m_emulate_prepare) {
     return true;
   }
@@ -627,6 +657,46 @@ void PDOMySqlConnection::persistentShutdown() {
   // do nothing
 }
 
+MYSQL_STMT *PDOMySqlConnection::takeStatement(CStrRef sql) {
+  StatementMap::iterator iter = m_stmt_cache.find(sql.data());
+  if (iter == m_stmt_cache.end()) {
+    return NULL;
+  }
+  MYSQL_STMT *stmt = iter->second;
+  m_stmt_cache.erase(iter);
+  if (stmt->mysql != m_server) {
+    /* a reconnect detaches statements; the server no longer knows this one */
+    mysql_stmt_close(stmt);
+    return NULL;
+  }
+  return stmt;
+}
+
+void PDOMySqlConnection::cacheStatement(CStrRef sql, MYSQL_STMT *stmt) {
+  /* reset drops unread rows, sent long data and any open cursor on the
+     server, so the next execute starts from a clean statement */
+  if (!m_server || stmt->mysql != m_server ||
+      (int)m_stmt_cache.size() >= RuntimeOption::MySQLStatementCacheSize ||
+      mysql_stmt_free_result(stmt) || mysql_stmt_reset(stmt)) {
+    mysql_stmt_close(stmt);
+    return;
+  }
+  std::pair<StatementMap::iterator, bool> ret =
+    m_stmt_cache.insert(StatementMap::value_type(sql.data(), stmt));
+  if (!ret.second) {
+    /* another statement with the same SQL got here first */
+    mysql_stmt_close(stmt);
+  }
+}
+
+void PDOMySqlConnection::closeStatements() {
+  for (StatementMap::iterator iter = m_stmt_cache.begin();
+       iter != m_stmt_cache.end(); ++iter) {
+    mysql_stmt_close(iter->second);
+  }
+  m_stmt_cache.clear();
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 void PDOMySqlStatement::setRowCount() {
@@ -657,7 +727,7 @@ bool PDOMySqlStatement::executePrepared() {
     /* figure out the result set format, if any */
     m_result = mysql_stmt_result_metadata(m_stmt);
     if (m_result) {
-      int calc_max_length = m_conn->buffered() && m_max_length == 1;
+      int calc_max_length = buffered() && m_max_length == 1;
       m_fields = mysql_fetch_fields(m_result);
       if (m_bound_result) {
         int i;
@@ -729,14 +799,15 @@ bool PDOMySqlStatement::executePrepared() {
         handleError(__FILE__, __LINE__);
         return false;
       }
-
-      /* if buffered, pre-fetch all the data */
-      if (m_conn->buffered()) {
-        mysql_stmt_store_result(m_stmt);
-      }
     }
   }
 
+  /* if buffered, pre-fetch all the data; this has to happen on every
+     execute, not just the first one that set up the result bindings */
+  if (m_result && buffered()) {
+    mysql_stmt_store_result(m_stmt);
+  }
+
   setRowCount();
   return true;
 }
@@ -793,7 +864,7 @@ PDOMySqlStatement::PDOMySqlStatement(PDOMySqlConnection *conn, MYSQL *server)
       m_current_data(NULL), m_current_lengths(NULL), m_stmt(NULL),
       m_num_params(0), m_params(NULL), m_in_null(NULL), m_in_length(NULL),
       m_bound_result(NULL), m_out_null(NULL), m_out_length(NULL),
-      m_params_given(0), m_max_length(0) {
+      m_params_given(0), m_max_length(0), m_buffered(conn->buffered()) {
 }
 
 PDOMySqlStatement::~PDOMySqlStatement() {
@@ -807,7 +878,11 @@ PDOMySqlStatement::~PDOMySqlStatement() {
     m_einfo.errmsg = NULL;
   }
   if (m_stmt) {
-    mysql_stmt_close(m_stmt);
+    if (!m_stmt_sql.isNull()) {
+      m_conn->cacheStatement(m_stmt_sql, m_stmt);
+    } else {
+      mysql_stmt_close(m_stmt);
+    }
     m_stmt = NULL;
   }
 
@@ -859,20 +934,28 @@ bool PDOMySqlStatement::create(CStrRef sql, CArrRef options) {
     nsql = sql;
   }
 
-  if (!(m_stmt = mysql_stmt_init(m_server))) {
-    handleError(__FILE__, __LINE__);
-    return false;
+  if (RuntimeOption::MySQLStatementCacheSize > 0) {
+    m_stmt = m_conn->takeStatement(nsql);
   }
+  if (!m_stmt) {
+    if (!(m_stmt = mysql_stmt_init(m_server))) {
+      handleError(__FILE__, __LINE__);
+      return false;
+    }
 
-  if (mysql_stmt_prepare(m_stmt, nsql.data(), nsql.size())) {
-    /* TODO: might need to pull statement specific info here? */
-    /* if the query isn't supported by the protocol, fallback to emulation */
-    if (mysql_errno(m_server) == 1295) {
-      supports_placeholders = PDO_PLACEHOLDER_NONE;
-      return true;
+    if (mysql_stmt_prepare(m_stmt, nsql.data(), nsql.size())) {
+      /* TODO: might need to pull statement specific info here? */
+      /* if the query isn't supported by the protocol, fallback to emulation */
+      if (mysql_errno(m_server) == 1295) {
+        supports_placeholders = PDO_PLACEHOLDER_NONE;
+        return true;
+      }
+      handleError(__FILE__, __LINE__);
+      return false;
     }
-    handleError(__FILE__, __LINE__);
-    return false;
+  }
+  if (RuntimeOption::MySQLStatementCacheSize > 0) {
+    m_stmt_sql = nsql;
   }
 
   m_num_params = mysql_stmt_param_count(m_stmt);
@@ -925,7 +1008,7 @@ bool PDOMySqlStatement::executer() {
   if (row_count == (my_ulonglong)-1) {
     /* we either have a query that returned a result set or an error occured
        lets see if we have access to a result set */
-    if (!m_conn->buffered()) {
+    if (!buffered()) {
       m_result = mysql_use_result(m_server);
     } else {
       m_result = mysql_store_result(m_server);
@@ -1210,7 +1293,7 @@ bool PDOMySqlStatement::nextRowset() {
   }
 
   my_ulonglong row_count;
-  if (!m_conn->buffered()) {
+  if (!buffered()) {
     m_result = mysql_use_result(m_server);
     row_count = 0;
   } else {
@@ -108,6 +108,11 @@ inline Variant x_curl_multi_select(CObjRef mh, double timeout = 1.0) {
   return f_curl_multi_select(mh, timeout);
 }
 
+inline int64 x_curl_multi_await(CObjRef mh, double timeout = 1.0) {
+  FUNCTION_INJECTION_BUILTIN(curl_multi_await);
+  return f_curl_multi_await(mh, timeout);
+}
+
 inline Variant x_fb_curl_multi_fdset(CObjRef mh, VRefParam read_fd_set, VRefParam write_fd_set, VRefParam exc_fd_set, VRefParam max_fd = null_object) {
   FUNCTION_INJECTION_BUILTIN(fb_curl_multi_fdset);
   return f_fb_curl_multi_fdset(mh, read_fd_set, write_fd_set, exc_fd_set, max_fd);
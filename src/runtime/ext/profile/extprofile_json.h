@@ -31,6 +31,11 @@ inline String x_json_encode(CVarRef value, CVarRef options = 0) {
   return f_json_encode(value, options);
 }
 
+inline void x_json_encode_to_output(CVarRef value, CVarRef options = 0) {
+  FUNCTION_INJECTION_BUILTIN(json_encode_to_output);
+  f_json_encode_to_output(value, options);
+}
+
 inline Variant x_json_decode(CStrRef json, bool assoc = false, CVarRef options = 0) {
   FUNCTION_INJECTION_BUILTIN(json_decode);
   TAINT_OBSERVER(TAINT_BIT_MUTATED, TAINT_BIT_NONE);
@@ -56,6 +56,11 @@ inline Variant x_memcache_get(CObjRef memcache, CVarRef key, VRefParam flags = n
   return f_memcache_get(memcache, key, flags);
 }
 
+inline bool x_memcache_defer_get(CObjRef memcache, CVarRef key) {
+  FUNCTION_INJECTION_BUILTIN(memcache_defer_get);
+  return f_memcache_defer_get(memcache, key);
+}
+
 inline bool x_memcache_delete(CObjRef memcache, CStrRef key, int expire = 0) {
   FUNCTION_INJECTION_BUILTIN(memcache_delete);
   return f_memcache_delete(memcache, key, expire);
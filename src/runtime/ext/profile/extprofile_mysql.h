@@ -189,6 +189,21 @@ inline Variant x_mysql_unbuffered_query(CStrRef query, CVarRef link_identifier =
   return f_mysql_unbuffered_query(query, link_identifier);
 }
 
+inline bool x_mysql_async_query(CStrRef query, CVarRef link_identifier = null) {
+  FUNCTION_INJECTION_BUILTIN(mysql_async_query);
+  return f_mysql_async_query(query, link_identifier);
+}
+
+inline Variant x_mysql_async_wait(CArrRef links, int timeout_ms = -1) {
+  FUNCTION_INJECTION_BUILTIN(mysql_async_wait);
+  return f_mysql_async_wait(links, timeout_ms);
+}
+
+inline Variant x_mysql_async_result(CVarRef link_identifier = null, bool buffered = true) {
+  FUNCTION_INJECTION_BUILTIN(mysql_async_result);
+  return f_mysql_async_result(link_identifier, buffered);
+}
+
 inline Variant x_mysql_db_query(CStrRef database, CStrRef query, CVarRef link_identifier = null) {
   FUNCTION_INJECTION_BUILTIN(mysql_db_query);
   return f_mysql_db_query(database, query, link_identifier);
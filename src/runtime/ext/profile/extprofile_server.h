@@ -55,6 +55,16 @@ inline String x_pagelet_server_task_result(CObjRef task, VRefParam headers, VRef
   return f_pagelet_server_task_result(task, headers, code, timeout_ms);
 }
 
+inline Array x_pagelet_server_task_start_batch(CArrRef requests) {
+  FUNCTION_INJECTION_BUILTIN(pagelet_server_task_start_batch);
+  return f_pagelet_server_task_start_batch(requests);
+}
+
+inline Array x_pagelet_server_task_select(CArrRef tasks, int64 timeout_ms = 0) {
+  FUNCTION_INJECTION_BUILTIN(pagelet_server_task_select);
+  return f_pagelet_server_task_select(tasks, timeout_ms);
+}
+
 inline void x_pagelet_server_flush() {
   FUNCTION_INJECTION_BUILTIN(pagelet_server_flush);
   f_pagelet_server_flush();
@@ -16,6 +16,7 @@
 */
 
 #include <runtime/ext/thrift/transport.h>
+#include <runtime/ext/thrift/spec.h>
 #include <runtime/ext/ext_thrift.h>
 #include <runtime/ext/ext_class.h>
 #include <runtime/ext/ext_reflection.h>
@@ -40,9 +41,9 @@ const int8_t T_EXCEPTION = 3;
 const int INVALID_DATA = 1;
 const int BAD_VERSION = 4;
 
-void binary_deserialize_spec(CObjRef zthis, PHPInputTransport& transport, CArrRef spec);
-void binary_serialize_spec(CObjRef zthis, PHPOutputTransport& transport, CArrRef spec);
-void binary_serialize(int8_t thrift_typeID, PHPOutputTransport& transport, CVarRef value, CArrRef fieldspec);
+void binary_deserialize_spec(CObjRef zthis, PHPInputTransport& transport, StructSpec *spec);
+void binary_serialize_spec(CObjRef zthis, PHPOutputTransport& transport, StructSpec *spec);
+void binary_serialize(int8_t thrift_typeID, PHPOutputTransport& transport, CVarRef value, FieldSpec *fieldspec);
 void skip_element(long thrift_typeID, PHPInputTransport& transport);
 
 // Create a PHP object given a typename and call the ctor, optionally passing up to 2 arguments
@@ -68,36 +69,40 @@ void throw_tprotocolexception(CStrRef what, long errorcode) {
 }
 
 Variant binary_deserialize(int8_t thrift_typeID, PHPInputTransport& transport,
-                           CArrRef fieldspec) {
+                           FieldSpec *fieldspec) {
   Variant ret;
   switch (thrift_typeID) {
     case T_STOP:
     case T_VOID:
       return null;
     case T_STRUCT: {
-      Variant val;
-      if ((val = fieldspec.rvalAt(s_class)).isNull()) {
+      if (!fieldspec || fieldspec->className.isNull()) {
         throw_tprotocolexception("no class type in spec", INVALID_DATA);
         skip_element(T_STRUCT, transport);
         return null;
       }
-      String structType = val.toString();
-      ret = createObject(structType);
-      if (ret.isNull()) {
-        // unable to create class entry
-        skip_element(T_STRUCT, transport);
-        return null;
-      }
-      Variant spec = f_hphp_get_static_property(structType, "_TSPEC");
-      if (!spec.is(KindOfArray)) {
-        char errbuf[128];
-        snprintf(errbuf, 128, "spec for %s is wrong type: %d\n",
-                 structType.data(), ret.getType());
-        throw_tprotocolexception(String(errbuf, CopyString), INVALID_DATA);
-        return null;
+      StructSpec *spec = fieldspec->structSpec;
+      Object obj;
+      if (spec) {
+        obj = spec->newInstance();
+      } else {
+        obj = createObject(fieldspec->className);
+        if (obj.isNull()) {
+          // unable to create class entry
+          skip_element(T_STRUCT, transport);
+          return null;
+        }
+        spec = StructSpec::Get(fieldspec);
+        if (!spec) {
+          char errbuf[128];
+          snprintf(errbuf, 128, "spec for %s is wrong type\n",
+                   fieldspec->className.data());
+          throw_tprotocolexception(String(errbuf, CopyString), INVALID_DATA);
+          return null;
+        }
       }
-      binary_deserialize_spec(ret, transport, spec.toArray());
-      return ret;
+      binary_deserialize_spec(obj, transport, spec);
+      return obj;
     } break;
     case T_BOOL: {
       uint8_t c;
@@ -154,10 +159,8 @@ Variant binary_deserialize(int8_t thrift_typeID, PHPInputTransport& transport,
       transport.readBytes(types, 2);
       uint32_t size = transport.readU32();
 
-      Array keyspec = fieldspec.rvalAt(s_key,
-                                       AccessFlags::Error_Key).toArray();
-      Array valspec = fieldspec.rvalAt(s_val,
-                                       AccessFlags::Error_Key).toArray();
+      FieldSpec *keyspec = fieldspec ? fieldspec->key : NULL;
+      FieldSpec *valspec = fieldspec ? fieldspec->val : NULL;
       ret = Array::Create();
 
       for (uint32_t s = 0; s < size; ++s) {
@@ -170,8 +173,7 @@ Variant binary_deserialize(int8_t thrift_typeID, PHPInputTransport& transport,
     case T_LIST: { // array with autogenerated numeric keys
       int8_t type = transport.readI8();
       uint32_t size = transport.readU32();
-      Variant elemvar = fieldspec.rvalAt(s_elem, AccessFlags::Error_Key);
-      Array elemspec = elemvar.toArray();
+      FieldSpec *elemspec = fieldspec ? fieldspec->elem : NULL;
       ret = Array::Create();
 
       for (uint32_t s = 0; s < size; ++s) {
@@ -186,8 +188,7 @@ Variant binary_deserialize(int8_t thrift_typeID, PHPInputTransport& transport,
       transport.readBytes(&type, 1);
       transport.readBytes(&size, 4);
       size = ntohl(size);
-      Variant elemvar = fieldspec.rvalAt(s_elem, AccessFlags::Error_Key);
-      Array elemspec = elemvar.toArray();
+      FieldSpec *elemspec = fieldspec ? fieldspec->elem : NULL;
       ret = Array::Create();
 
       for (uint32_t s = 0; s < size; ++s) {
@@ -278,7 +279,7 @@ void binary_serialize_hashtable_key(int8_t keytype, PHPOutputTransport& transpor
   } else {
     key = key.toString();
   }
-  binary_serialize(keytype, transport, key, Array());
+  binary_serialize(keytype, transport, key, NULL);
 }
 
 inline bool ttype_is_int(int8_t t) {
@@ -292,27 +293,18 @@ inline bool ttypes_are_compatible(int8_t t1, int8_t t2) {
 }
 
 void binary_deserialize_spec(CObjRef zthis, PHPInputTransport& transport,
-                             CArrRef spec) {
+                             StructSpec *spec) {
   // SET and LIST have 'elem' => array('type', [optional] 'class')
   // MAP has 'val' => array('type', [optiona] 'class')
   while (true) {
-    Variant val;
-
     int8_t ttype = transport.readI8();
     if (ttype == T_STOP) return;
     int16_t fieldno = transport.readI16();
-    if (!(val = spec.rvalAt(fieldno)).isNull()) {
-      Array fieldspec = val.toArray();
-      // pull the field name
-      // zend hash tables use the null at the end in the length... so strlen(hash key) + 1.
-      String varname = fieldspec.rvalAt(s_var).toString();
-
-      // and the type
-      int8_t expected_ttype = fieldspec.rvalAt(s_type).toInt64();
-
-      if (ttypes_are_compatible(ttype, expected_ttype)) {
+    FieldSpec *fieldspec = spec ? spec->getField(fieldno) : NULL;
+    if (fieldspec) {
+      if (ttypes_are_compatible(ttype, fieldspec->type)) {
         Variant rv = binary_deserialize(ttype, transport, fieldspec);
-        zthis->o_set(varname, rv, zthis->o_getClassName());
+        spec->setProp(zthis, fieldspec, rv);
       } else {
         skip_element(ttype, transport);
       }
@@ -323,7 +315,7 @@ void binary_deserialize_spec(CObjRef zthis, PHPInputTransport& transport,
 }
 
 void binary_serialize(int8_t thrift_typeID, PHPOutputTransport& transport,
-                      CVarRef value, CArrRef fieldspec) {
+                      CVarRef value, FieldSpec *fieldspec) {
   // At this point the typeID (and field num, if applicable) should've already
   // been written to the output so all we need to do is write the payload.
   switch (thrift_typeID) {
@@ -336,9 +328,7 @@ void binary_serialize(int8_t thrift_typeID, PHPOutputTransport& transport,
                                  "type as a T_STRUCT", INVALID_DATA);
       }
       binary_serialize_spec(value, transport,
-                            f_hphp_get_static_property(toObject(value)->
-                                                       o_getClassName(),
-                                                       "_TSPEC").toArray());
+                            StructSpec::Get(value.toObject(), fieldspec));
     } return;
     case T_BOOL:
       transport.writeI8(value.toBoolean() ? 1 : 0);
@@ -373,15 +363,12 @@ void binary_serialize(int8_t thrift_typeID, PHPOutputTransport& transport,
     } return;
     case T_MAP: {
       Array ht = value.toArray();
-      uint8_t keytype = fieldspec.rvalAt(s_ktype,
-                                         AccessFlags::Error_Key).toByte();
+      uint8_t keytype = fieldspec ? fieldspec->ktype : T_STOP;
       transport.writeI8(keytype);
-      uint8_t valtype = fieldspec.rvalAt(s_vtype,
-                                         AccessFlags::Error_Key).toByte();
+      uint8_t valtype = fieldspec ? fieldspec->vtype : T_STOP;
       transport.writeI8(valtype);
 
-      Array valspec = fieldspec.rvalAt(s_val,
-                                       AccessFlags::Error_Key).toArray();
+      FieldSpec *valspec = fieldspec ? fieldspec->val : NULL;
 
       transport.writeI32(ht.size());
       for (ArrayIter key_ptr = ht.begin(); !key_ptr.end(); ++key_ptr) {
@@ -391,13 +378,10 @@ void binary_serialize(int8_t thrift_typeID, PHPOutputTransport& transport,
     } return;
     case T_LIST: {
       Array ht = value.toArray();
-      Variant val;
 
-      uint8_t valtype = fieldspec.rvalAt(s_etype,
-                                         AccessFlags::Error_Key).toInt64();
+      uint8_t valtype = fieldspec ? fieldspec->etype : T_STOP;
       transport.writeI8(valtype);
-      Array valspec = fieldspec.rvalAt(s_elem,
-                                       AccessFlags::Error_Key).toArray();
+      FieldSpec *valspec = fieldspec ? fieldspec->elem : NULL;
       transport.writeI32(ht.size());
       for (ArrayIter key_ptr = ht.begin(); !key_ptr.end(); ++key_ptr) {
         binary_serialize(valtype, transport, key_ptr.second(), valspec);
@@ -406,8 +390,7 @@ void binary_serialize(int8_t thrift_typeID, PHPOutputTransport& transport,
     case T_SET: {
       Array ht = value.toArray();
 
-      uint8_t keytype = fieldspec.rvalAt(s_etype,
-                                         AccessFlags::Error_Key).toByte();
+      uint8_t keytype = fieldspec ? fieldspec->etype : T_STOP;
       transport.writeI8(keytype);
 
       transport.writeI32(ht.size());
@@ -423,29 +406,20 @@ void binary_serialize(int8_t thrift_typeID, PHPOutputTransport& transport,
 
 
 void binary_serialize_spec(CObjRef zthis, PHPOutputTransport& transport,
-                           CArrRef spec) {
-  for (ArrayIter key_ptr = spec.begin(); !key_ptr.end(); ++key_ptr) {
-    Variant key = key_ptr.first();
-    if (!key.isInteger()) {
+                           StructSpec *spec) {
+  if (spec) {
+    if (spec->hasBadKey) {
       throw_tprotocolexception("Bad keytype in TSPEC (expected 'long')", INVALID_DATA);
       return;
     }
-    unsigned long fieldno = key.toInt64();
-    Array fieldspec = key_ptr.second().toArray();
-
-    // field name
-    String varname = fieldspec.rvalAt(s_var,
-                                      AccessFlags::Error_Key).toString();
-
-    // thrift type
-    int8_t ttype = fieldspec.rvalAt(s_type,
-                                    AccessFlags::Error_Key).toByte();
-
-    Variant prop = zthis->o_get(varname, true, zthis->o_getClassName());
-    if (!prop.isNull()) {
-      transport.writeI8(ttype);
-      transport.writeI16(fieldno);
-      binary_serialize(ttype, transport, prop, fieldspec);
+    for (unsigned int i = 0; i < spec->fields.size(); i++) {
+      FieldSpec *fieldspec = spec->fields[i];
+      Variant prop = spec->getProp(zthis, fieldspec);
+      if (!prop.isNull()) {
+        transport.writeI8(fieldspec->type);
+        transport.writeI16(fieldspec->fieldNum);
+        binary_serialize(fieldspec->type, transport, prop, fieldspec);
+      }
     }
   }
   transport.writeI8(T_STOP); // struct end
@@ -468,9 +442,8 @@ void f_thrift_protocol_write_binary(CObjRef transportobj, CStrRef method_name,
     transport.writeI32(seqid);
   }
 
-  Variant spec = f_hphp_get_static_property(request_struct->o_getClassName(),
-                                            "_TSPEC");
-  binary_serialize_spec(request_struct, transport, spec.toArray());
+  binary_serialize_spec(request_struct, transport,
+                        StructSpec::Get(request_struct));
 }
 
 Variant f_thrift_protocol_read_binary(CObjRef transportobj,
@@ -503,14 +476,13 @@ Variant f_thrift_protocol_read_binary(CObjRef transportobj,
 
   if (messageType == T_EXCEPTION) {
     Object ex = createObject("TApplicationException");
-    Variant spec = f_hphp_get_static_property("TApplicationException", "_TSPEC");
-    binary_deserialize_spec(ex, transport, spec.toArray());
+    binary_deserialize_spec(ex, transport,
+                            StructSpec::Get("TApplicationException"));
     throw ex;
   }
 
   Object ret_val = createObject(obj_typename);
-  Variant spec = f_hphp_get_static_property(obj_typename, "_TSPEC");
-  binary_deserialize_spec(ret_val, transport, spec.toArray());
+  binary_deserialize_spec(ret_val, transport, StructSpec::Get(obj_typename));
   return ret_val;
 }
 
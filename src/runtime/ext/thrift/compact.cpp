@@ -17,6 +17,7 @@
 
 #include <runtime/base/util/request_local.h>
 #include <runtime/ext/thrift/transport.h>
+#include <runtime/ext/thrift/spec.h>
 #include <runtime/ext/ext_reflection.h>
 #include <runtime/ext/ext_thrift.h>
 
@@ -188,7 +189,7 @@ class CompactWriter {
     }
 
     void write(CObjRef obj) {
-      writeStruct(obj);
+      writeStruct(obj, NULL);
     }
 
   private:
@@ -200,38 +201,32 @@ class CompactWriter {
     std::stack<std::pair<CState, uint16_t> > structHistory;
     std::stack<CState> containerHistory;
 
-    void writeStruct(CObjRef obj) {
+    void writeStruct(CObjRef obj, FieldSpec *structSpec) {
       // Save state
       structHistory.push(std::make_pair(state, lastFieldNum));
       state = STATE_FIELD_WRITE;
       lastFieldNum = 0;
 
       // Get field specification
-      CArrRef spec = f_hphp_get_static_property(obj->o_getClassName(), "_TSPEC")
-        .toArray();
+      StructSpec *spec = StructSpec::Get(obj, structSpec);
 
       // Write each member
-      for (ArrayIter specIter = spec.begin(); !specIter.end(); ++specIter) {
-        Variant key = specIter.first();
-        if (!key.isInteger()) {
+      if (spec) {
+        if (spec->hasBadKey) {
           thrift_error("Bad keytype in TSPEC (expected 'long')",
             ERR_INVALID_DATA);
         }
 
-        uint16_t fieldNo = key.toInt16();
-        Array fieldSpec = specIter.second().toArray();
+        for (unsigned int i = 0; i < spec->fields.size(); i++) {
+          FieldSpec *fieldSpec = spec->fields[i];
+          Variant fieldVal = spec->getProp(obj, fieldSpec);
 
-        String fieldName = fieldSpec
-          .rvalAt(s_var, AccessFlags::Error_Key).toString();
-        TType fieldType = (TType)fieldSpec
-          .rvalAt(s_type, AccessFlags::Error_Key).toByte();
-
-        Variant fieldVal = obj->o_get(fieldName, true, obj->o_getClassName());
-
-        if (!fieldVal.isNull()) {
-          writeFieldBegin(fieldNo, fieldType);
-          writeField(fieldVal, fieldSpec, fieldType);
-          writeFieldEnd();
+          if (!fieldVal.isNull()) {
+            TType fieldType = fieldSpec->type;
+            writeFieldBegin(fieldSpec->fieldNum, fieldType);
+            writeField(fieldVal, fieldSpec, fieldType);
+            writeFieldEnd();
+          }
         }
       }
 
@@ -274,7 +269,7 @@ class CompactWriter {
     }
 
     void writeField(CVarRef value,
-                    CArrRef valueSpec,
+                    FieldSpec *valueSpec,
                     TType type) {
       switch (type) {
         case T_STOP:
@@ -286,7 +281,7 @@ class CompactWriter {
             thrift_error("Attempt to send non-object type as T_STRUCT",
               ERR_INVALID_DATA);
           }
-          writeStruct(value);
+          writeStruct(value, valueSpec);
           break;
 
         case T_BOOL: {
@@ -359,14 +354,12 @@ class CompactWriter {
       }
     }
 
-    void writeMap(Array arr, CArrRef spec) {
-      TType keyType = (TType)spec
-        .rvalAt(s_ktype, AccessFlags::Error_Key).toByte();
-      TType valueType = (TType)spec
-        .rvalAt(s_vtype, AccessFlags::Error_Key).toByte();
+    void writeMap(Array arr, FieldSpec *spec) {
+      TType keyType = spec ? spec->ktype : T_STOP;
+      TType valueType = spec ? spec->vtype : T_STOP;
 
-      Array keySpec = spec.rvalAt(s_key, AccessFlags::Error_Key).toArray();
-      Array valueSpec = spec.rvalAt(s_val, AccessFlags::Error_Key).toArray();
+      FieldSpec *keySpec = spec ? spec->key : NULL;
+      FieldSpec *valueSpec = spec ? spec->val : NULL;
 
       writeMapBegin(keyType, valueType, arr.size());
 
@@ -378,11 +371,9 @@ class CompactWriter {
       writeCollectionEnd();
     }
 
-    void writeList(Array arr, CArrRef spec, CListType listType) {
-      TType valueType = (TType)spec
-        .rvalAt(s_etype, AccessFlags::Error_Key).toByte();
-      Array valueSpec = spec
-        .rvalAt(s_elem, AccessFlags::Error_Key).toArray();
+    void writeList(Array arr, FieldSpec *spec, CListType listType) {
+      TType valueType = spec ? spec->etype : T_STOP;
+      FieldSpec *valueSpec = spec ? spec->elem : NULL;
 
       writeListBegin(valueType, arr.size());
 
@@ -499,13 +490,11 @@ class CompactReader {
 
       if (type == T_REPLY) {
         Object ret = create_object(resultClassName, Array());
-        Variant spec = f_hphp_get_static_property(resultClassName, "_TSPEC");
-        readStruct(ret, spec);
+        readStruct(ret, StructSpec::Get(resultClassName));
         return ret;
       } else if (type == T_EXCEPTION) {
         Object exn = create_object("TApplicationException", Array());
-        Variant spec = f_hphp_get_static_property("TApplicationException", "_TSPEC");
-        readStruct(exn, spec);
+        readStruct(exn, StructSpec::Get("TApplicationException"));
         throw exn;
       } else {
         thrift_error("Invalid response type", ERR_INVALID_DATA);
@@ -521,7 +510,7 @@ class CompactReader {
     std::stack<std::pair<CState, uint16_t> > structHistory;
     std::stack<CState> containerHistory;
 
-    void readStruct(CObjRef dest, CArrRef spec) {
+    void readStruct(CObjRef dest, StructSpec *spec) {
       readStructBegin();
 
       while (true) {
@@ -535,17 +524,12 @@ class CompactReader {
 
         bool readComplete = false;
 
-        Variant fieldSpecVariant = spec.rvalAt(fieldNum);
-        if (!fieldSpecVariant.isNull()) {
-          Array fieldSpec = fieldSpecVariant.toArray();
-
-          String fieldName = fieldSpec.rvalAt(s_var).toString();
-          TType expectedType = (TType)fieldSpec.rvalAt(s_type).toInt64();
-
-          if (typesAreCompatible(fieldType, expectedType)) {
+        FieldSpec *fieldSpec = spec ? spec->getField(fieldNum) : NULL;
+        if (fieldSpec) {
+          if (typesAreCompatible(fieldType, fieldSpec->type)) {
             readComplete = true;
             Variant fieldValue = readField(fieldSpec, fieldType);
-            dest->o_set(fieldName, fieldValue, dest->o_getClassName());
+            spec->setProp(dest, fieldSpec, fieldValue);
           }
         }
 
@@ -606,29 +590,31 @@ class CompactReader {
       state = STATE_FIELD_READ;
     }
 
-    Variant readField(CArrRef spec, TType type) {
+    Variant readField(FieldSpec *spec, TType type) {
       switch (type) {
         case T_STOP:
         case T_VOID:
           return null;
 
         case T_STRUCT: {
-            Variant className = spec.rvalAt(s_class);
-            if (className.isNull()) {
+            if (!spec || spec->className.isNull()) {
               thrift_error("no class type in spec", ERR_INVALID_DATA);
             }
 
-            String classNameString = className.toString();
-            Variant newStruct = create_object(classNameString, Array());
-            if (newStruct.isNull()) {
-              thrift_error("invalid class type in spec", ERR_INVALID_DATA);
-            }
-
-            Variant newStructSpec =
-              f_hphp_get_static_property(classNameString, "_TSPEC");
+            StructSpec *newStructSpec = spec->structSpec;
+            Object newStruct;
+            if (newStructSpec) {
+              newStruct = newStructSpec->newInstance();
+            } else {
+              newStruct = create_object(spec->className, Array());
+              if (newStruct.isNull()) {
+                thrift_error("invalid class type in spec", ERR_INVALID_DATA);
+              }
 
-            if (!newStructSpec.is(KindOfArray)) {
-              thrift_error("invalid type of spec", ERR_INVALID_DATA);
+              newStructSpec = StructSpec::Get(spec);
+              if (!newStructSpec) {
+                thrift_error("invalid type of spec", ERR_INVALID_DATA);
+              }
             }
 
             readStruct(newStruct, newStructSpec);
@@ -778,13 +764,13 @@ class CompactReader {
       }
     }
 
-    Variant readMap(CArrRef spec) {
+    Variant readMap(FieldSpec *spec) {
       TType keyType, valueType;
       uint32_t size;
       readMapBegin(keyType, valueType, size);
 
-      Array keySpec = spec.rvalAt(s_key, AccessFlags::Error);
-      Array valueSpec = spec.rvalAt(s_val, AccessFlags::Error);
+      FieldSpec *keySpec = spec ? spec->key : NULL;
+      FieldSpec *valueSpec = spec ? spec->val : NULL;
       Variant ret = Array::Create();
 
       for (uint32_t i = 0; i < size; i++) {
@@ -797,12 +783,12 @@ class CompactReader {
       return ret;
     }
 
-    Variant readList(CArrRef spec, CListType listType) {
+    Variant readList(FieldSpec *spec, CListType listType) {
       TType valueType;
       uint32_t size;
       readListBegin(valueType, size);
 
-      Array valueSpec = spec.rvalAt(s_elem, AccessFlags::Error_Key);
+      FieldSpec *valueSpec = spec ? spec->elem : NULL;
       Variant ret = Array::Create();
 
       for (uint32_t i = 0; i < size; i++) {
@@ -0,0 +1,242 @@
+/*
+   +----------------------------------------------------------------------+
+   | HipHop for PHP                                                       |
+   +----------------------------------------------------------------------+
+   | Copyright (c) 2010- Facebook, Inc. (http://www.facebook.com)         |
+   +----------------------------------------------------------------------+
+   | This source file is subject to version 3.01 of the PHP license,      |
+   | that is bundled with this package in the file LICENSE, and is        |
+   | available through the world-wide-web at the following url:           |
+   | http://www.php.net/license/3_01.txt                                  |
+   | If you did not receive a copy of the PHP license and are unable to   |
+   | obtain it through the world-wide-web, please send a note to          |
+   | license@php.net so we can mail you a copy immediately.               |
+   +----------------------------------------------------------------------+
+*/
+
+#include <runtime/ext/thrift/spec.h>
+#include <runtime/ext/ext_class.h>
+#include <runtime/base/util/request_local.h>
+#include <runtime/base/tv_helpers.h>
+#include <runtime/vm/class.h>
+#include <runtime/vm/instance.h>
+#include <runtime/vm/runtime.h>
+#include <runtime/vm/unit.h>
+
+namespace HPHP {
+///////////////////////////////////////////////////////////////////////////////
+
+// largest spread of field numbers we index directly
+static const int MaxIndexedFields = 1024;
+
+FieldSpec::FieldSpec()
+  : fieldNum(0), type(T_STOP), ktype(T_STOP), vtype(T_STOP), etype(T_STOP),
+    key(NULL), val(NULL), elem(NULL), structSpec(NULL), slot(-1) {
+}
+
+class SpecCache : public RequestEventHandler {
+public:
+  virtual void requestInit() {
+    clear();
+  }
+
+  virtual void requestShutdown() {
+    clear();
+  }
+
+  StructSpec *get(CStrRef className) {
+    StringIMap<StructSpec*>::const_iterator iter = m_structs.find(className);
+    if (iter != m_structs.end()) {
+      return iter->second;
+    }
+    Variant spec = f_hphp_get_static_property(className, "_TSPEC");
+    if (!spec.is(KindOfArray)) {
+      // not cached: the constructor may not have set it yet
+      return NULL;
+    }
+    StructSpec *ret = compile(className, spec.toArray());
+    m_structs[className] = ret;
+    return ret;
+  }
+
+private:
+  StringIMap<StructSpec*> m_structs;
+  std::vector<FieldSpec*> m_fields;
+
+  void clear() {
+    for (StringIMap<StructSpec*>::const_iterator iter = m_structs.begin();
+         iter != m_structs.end(); ++iter) {
+      delete iter->second;
+    }
+    m_structs.clear();
+    for (unsigned int i = 0; i < m_fields.size(); i++) {
+      delete m_fields[i];
+    }
+    m_fields.clear();
+  }
+
+  StructSpec *compile(CStrRef className, CArrRef spec) {
+    StructSpec *ret = new StructSpec();
+    ret->className = className;
+    if (hhvm) {
+      ret->m_cls = VM::Unit::lookupClass(className.get());
+    }
+
+    int minFieldNum = 0;
+    int maxFieldNum = -1;
+    for (ArrayIter iter = spec.begin(); !iter.end(); ++iter) {
+      Variant key = iter.first();
+      if (!key.isInteger()) {
+        ret->hasBadKey = true;
+        continue;
+      }
+      FieldSpec *field = compileField(iter.second().toArray(), ret->m_cls);
+      field->fieldNum = key.toInt16();
+      ret->fields.push_back(field);
+      if (maxFieldNum < minFieldNum) {
+        minFieldNum = maxFieldNum = field->fieldNum;
+      } else {
+        minFieldNum = std::min(minFieldNum, (int)field->fieldNum);
+        maxFieldNum = std::max(maxFieldNum, (int)field->fieldNum);
+      }
+    }
+
+    if (maxFieldNum - minFieldNum < MaxIndexedFields) {
+      ret->m_minFieldNum = minFieldNum;
+      ret->m_index.resize(maxFieldNum - minFieldNum + 1, NULL);
+      for (unsigned int i = 0; i < ret->fields.size(); i++) {
+        FieldSpec *field = ret->fields[i];
+        // with duplicate keys in _TSPEC, the last one wins, as in rvalAt()
+        ret->m_index[field->fieldNum - minFieldNum] = field;
+      }
+    } else {
+      ret->m_sparse = true;
+    }
+    return ret;
+  }
+
+  FieldSpec *compileField(CArrRef fieldspec, VM::Class *cls) {
+    FieldSpec *field = new FieldSpec();
+    m_fields.push_back(field);
+
+    field->type = (TType)fieldspec.rvalAt(s_type).toByte();
+    field->ktype = (TType)fieldspec.rvalAt(s_ktype).toByte();
+    field->vtype = (TType)fieldspec.rvalAt(s_vtype).toByte();
+    field->etype = (TType)fieldspec.rvalAt(s_etype).toByte();
+    if (fieldspec.exists(s_var)) {
+      field->name = fieldspec.rvalAt(s_var).toString();
+      if (cls) {
+        field->slot = findSlot(cls, field->name);
+      }
+    }
+    if (fieldspec.exists(s_class)) {
+      field->className = fieldspec.rvalAt(s_class).toString();
+    }
+
+    Variant sub;
+    if ((sub = fieldspec.rvalAt(s_key)).is(KindOfArray)) {
+      field->key = compileField(sub.toArray(), NULL);
+    }
+    if ((sub = fieldspec.rvalAt(s_val)).is(KindOfArray)) {
+      field->val = compileField(sub.toArray(), NULL);
+    }
+    if ((sub = fieldspec.rvalAt(s_elem)).is(KindOfArray)) {
+      field->elem = compileField(sub.toArray(), NULL);
+    }
+    return field;
+  }
+
+  /**
+   * Slot of a declared property the class itself can access, which is
+   * what o_get()/o_set() with the class as context would find.
+   */
+  static int findSlot(VM::Class *cls, CStrRef name) {
+    VM::Slot slot = cls->lookupDeclProp(name.get());
+    if (slot == VM::kInvalidSlot) return -1;
+    const VM::Class::Prop &prop = cls->declProperties()[slot];
+    if ((prop.m_attrs & VM::AttrPrivate) && prop.m_class != cls) return -1;
+    return slot;
+  }
+};
+IMPLEMENT_STATIC_REQUEST_LOCAL(SpecCache, s_spec_cache);
+
+///////////////////////////////////////////////////////////////////////////////
+
+StructSpec *StructSpec::Get(CStrRef className) {
+  return s_spec_cache->get(className);
+}
+
+StructSpec *StructSpec::Get(FieldSpec *field) {
+  if (!field->structSpec && !field->className.empty()) {
+    field->structSpec = s_spec_cache->get(field->className);
+  }
+  return field->structSpec;
+}
+
+StructSpec *StructSpec::Get(CObjRef obj, FieldSpec *field /* = NULL */) {
+  if (field && field->structSpec && field->structSpec->isSpecFor(obj)) {
+    return field->structSpec;
+  }
+  StructSpec *ret = s_spec_cache->get(obj->o_getClassName());
+  if (ret && field && !field->structSpec && !field->className.empty() &&
+      ret->className->isame(field->className.get())) {
+    field->structSpec = ret;
+  }
+  return ret;
+}
+
+FieldSpec *StructSpec::findField(int16_t fieldNum) const {
+  FieldSpec *ret = NULL;
+  for (unsigned int i = 0; i < fields.size(); i++) {
+    if (fields[i]->fieldNum == fieldNum) ret = fields[i];
+  }
+  return ret;
+}
+
+Object StructSpec::newInstance() const {
+  if (hhvm && m_cls) {
+    Object obj(VM::newInstance(m_cls));
+    TypedValue ret;
+    g_vmContext->invokeFunc(&ret, m_cls->getCtor(), Array(), obj.get());
+    tvRefcountedDecRef(&ret);
+    return obj;
+  }
+  return create_object(className, Array());
+}
+
+bool StructSpec::isSpecFor(CObjRef obj) const {
+  if (hhvm && m_cls) {
+    return obj->getVMClass() == m_cls;
+  }
+  return obj->o_getClassName()->isame(className.get());
+}
+
+static inline TypedValue *prop_slot(ObjectData *obj, VM::Class *cls,
+                                    int slot) {
+  return (TypedValue*)((char*)obj + cls->declPropOffset(slot));
+}
+
+Variant StructSpec::getProp(CObjRef obj, const FieldSpec *field) const {
+  if (hhvm && field->slot >= 0 && obj->getVMClass() == m_cls) {
+    const TypedValue *tv = prop_slot(obj.get(), m_cls, field->slot);
+    if (tv->m_type != KindOfUninit) {
+      return tvAsCVarRef(tvToCell(tv));
+    }
+  }
+  return obj->o_get(field->name, true, obj->o_getClassName());
+}
+
+void StructSpec::setProp(CObjRef obj, const FieldSpec *field,
+                         CVarRef value) const {
+  if (hhvm && field->slot >= 0 && obj->getVMClass() == m_cls) {
+    TypedValue *tv = prop_slot(obj.get(), m_cls, field->slot);
+    if (tv->m_type != KindOfUninit) {
+      tvSet(tvToCell(value.asTypedValue()), tv);
+      return;
+    }
+  }
+  obj->o_set(field->name, value, obj->o_getClassName());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+}
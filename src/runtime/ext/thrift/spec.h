@@ -0,0 +1,125 @@
+/*
+   +----------------------------------------------------------------------+
+   | HipHop for PHP                                                       |
+   +----------------------------------------------------------------------+
+   | Copyright (c) 2010- Facebook, Inc. (http://www.facebook.com)         |
+   +----------------------------------------------------------------------+
+   | This source file is subject to version 3.01 of the PHP license,      |
+   | that is bundled with this package in the file LICENSE, and is        |
+   | available through the world-wide-web at the following url:           |
+   | http://www.php.net/license/3_01.txt                                  |
+   | If you did not receive a copy of the PHP license and are unable to   |
+   | obtain it through the world-wide-web, please send a note to          |
+   | license@php.net so we can mail you a copy immediately.               |
+   +----------------------------------------------------------------------+
+*/
+
+#ifndef __THRIFT_SPEC_H__
+#define __THRIFT_SPEC_H__
+
+#include <runtime/ext/thrift/transport.h>
+
+namespace HPHP {
+
+namespace VM {
+class Class;
+}
+
+class StructSpec;
+
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * One field of a _TSPEC array, or the 'key', 'val' or 'elem' spec of a
+ * container, with all the array lookups done up front.
+ */
+class FieldSpec {
+public:
+  FieldSpec();
+
+  int16_t fieldNum;
+  TType type;
+  String name;        // 'var', static so it can be resolved to a slot
+  String className;   // 'class', for T_STRUCT
+
+  // containers
+  TType ktype;
+  TType vtype;
+  TType etype;
+  FieldSpec *key;
+  FieldSpec *val;
+  FieldSpec *elem;
+
+  // T_STRUCT: spec of className, filled in on first use
+  StructSpec *structSpec;
+
+  // declared property slot in the owning StructSpec's class, or -1
+  int slot;
+};
+
+/**
+ * A compiled _TSPEC. Specs are cached per request, because both the
+ * classes and their static _TSPEC arrays only live that long. Encoding and
+ * decoding walk the field table instead of the PHP array, and under hhvm
+ * read and write declared properties directly by slot.
+ */
+class StructSpec {
+public:
+  /**
+   * Spec for a class, compiled on first use in this request. Returns NULL
+   * when the class has no usable _TSPEC. Thrift classes set _TSPEC in their
+   * constructors, so an instance has to exist before the first lookup.
+   */
+  static StructSpec *Get(CStrRef className);
+
+  /**
+   * Spec for a T_STRUCT field, remembered on the field after first use.
+   */
+  static StructSpec *Get(FieldSpec *field);
+
+  /**
+   * Spec for an object's own class. This is what writers use, since the
+   * object may be a subclass of what the field says. When field is given,
+   * its remembered spec is tried first.
+   */
+  static StructSpec *Get(CObjRef obj, FieldSpec *field = NULL);
+
+  String className;
+  std::vector<FieldSpec*> fields; // in _TSPEC order
+  bool hasBadKey; // _TSPEC had a non-integer key, which writers reject
+
+  FieldSpec *getField(int16_t fieldNum) const {
+    int index = fieldNum - m_minFieldNum;
+    if (index >= 0 && index < (int)m_index.size()) {
+      return m_index[index];
+    }
+    return m_sparse ? findField(fieldNum) : NULL;
+  }
+
+  /**
+   * Creates an instance and runs its constructor.
+   */
+  Object newInstance() const;
+
+  bool isSpecFor(CObjRef obj) const;
+
+  Variant getProp(CObjRef obj, const FieldSpec *field) const;
+  void setProp(CObjRef obj, const FieldSpec *field, CVarRef value) const;
+
+private:
+  friend class SpecCache;
+  StructSpec()
+    : hasBadKey(false), m_cls(NULL), m_minFieldNum(0), m_sparse(false) {}
+
+  FieldSpec *findField(int16_t fieldNum) const;
+
+  VM::Class *m_cls;
+  int16_t m_minFieldNum;
+  std::vector<FieldSpec*> m_index; // fieldNum - m_minFieldNum
+  bool m_sparse; // field numbers too spread out for m_index
+};
+
+///////////////////////////////////////////////////////////////////////////////
+}
+
+#endif // __THRIFT_SPEC_H__
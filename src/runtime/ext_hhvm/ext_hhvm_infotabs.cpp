@@ -212,6 +212,7 @@ TypedValue* fg_curl_multi_add_handle(VM::ActRec *ar);
 TypedValue* fg_curl_multi_remove_handle(VM::ActRec *ar);
 TypedValue* fg_curl_multi_exec(VM::ActRec *ar);
 TypedValue* fg_curl_multi_select(VM::ActRec *ar);
+TypedValue* fg_curl_multi_await(VM::ActRec *ar);
 TypedValue* fg_fb_curl_multi_fdset(VM::ActRec *ar);
 TypedValue* fg_curl_multi_getcontent(VM::ActRec *ar);
 TypedValue* fg_curl_multi_info_read(VM::ActRec *ar);
@@ -800,6 +801,7 @@ TypedValue* fg_hphp_recursivedirectoryiterator_getchildren(VM::ActRec *ar);
 TypedValue* fg_hphp_recursivedirectoryiterator_getsubpath(VM::ActRec *ar);
 TypedValue* fg_hphp_recursivedirectoryiterator_getsubpathname(VM::ActRec *ar);
 TypedValue* fg_json_encode(VM::ActRec *ar);
+TypedValue* fg_json_encode_to_output(VM::ActRec *ar);
 TypedValue* fg_json_decode(VM::ActRec *ar);
 TypedValue* fg_ldap_connect(VM::ActRec *ar);
 TypedValue* fg_ldap_explode_dn(VM::ActRec *ar);
@@ -1431,6 +1433,7 @@ TypedValue* fg_memcache_add(VM::ActRec *ar);
 TypedValue* fg_memcache_set(VM::ActRec *ar);
 TypedValue* fg_memcache_replace(VM::ActRec *ar);
 TypedValue* fg_memcache_get(VM::ActRec *ar);
+TypedValue* fg_memcache_defer_get(VM::ActRec *ar);
 TypedValue* fg_memcache_delete(VM::ActRec *ar);
 TypedValue* fg_memcache_increment(VM::ActRec *ar);
 TypedValue* fg_memcache_decrement(VM::ActRec *ar);
@@ -1506,6 +1509,9 @@ TypedValue* fg_mysql_next_result(VM::ActRec *ar);
 TypedValue* fg_mysql_more_results(VM::ActRec *ar);
 TypedValue* fg_mysql_fetch_result(VM::ActRec *ar);
 TypedValue* fg_mysql_unbuffered_query(VM::ActRec *ar);
+TypedValue* fg_mysql_async_query(VM::ActRec *ar);
+TypedValue* fg_mysql_async_wait(VM::ActRec *ar);
+TypedValue* fg_mysql_async_result(VM::ActRec *ar);
 TypedValue* fg_mysql_db_query(VM::ActRec *ar);
 TypedValue* fg_mysql_list_dbs(VM::ActRec *ar);
 TypedValue* fg_mysql_list_tables(VM::ActRec *ar);
@@ -1795,6 +1801,8 @@ TypedValue* fg_pagelet_server_is_enabled(VM::ActRec *ar);
 TypedValue* fg_pagelet_server_task_start(VM::ActRec *ar);
 TypedValue* fg_pagelet_server_task_status(VM::ActRec *ar);
 TypedValue* fg_pagelet_server_task_result(VM::ActRec *ar);
+TypedValue* fg_pagelet_server_task_start_batch(VM::ActRec *ar);
+TypedValue* fg_pagelet_server_task_select(VM::ActRec *ar);
 TypedValue* fg_pagelet_server_flush(VM::ActRec *ar);
 TypedValue* fg_xbox_send_message(VM::ActRec *ar);
 TypedValue* fg_xbox_post_message(VM::ActRec *ar);
@@ -2942,7 +2950,7 @@ TypedValue* tg_9XMLWriter_endDTD(VM::ActRec *ar);
 TypedValue* tg_9XMLWriter_flush(VM::ActRec *ar);
 TypedValue* tg_9XMLWriter_outputMemory(VM::ActRec *ar);
 
-const long long hhbc_ext_funcs_count = 2192;
+const long long hhbc_ext_funcs_count = 2200;
 const HhbcExtFuncInfo hhbc_ext_funcs[] = {
   { "apache_note", fg_apache_note, (void *)&fh_apache_note },
   { "apache_request_headers", fg_apache_request_headers, (void *)&fh_apache_request_headers },
@@ -3133,6 +3141,7 @@ const HhbcExtFuncInfo hhbc_ext_funcs[] = {
   { "curl_multi_remove_handle", fg_curl_multi_remove_handle, (void *)&fh_curl_multi_remove_handle },
   { "curl_multi_exec", fg_curl_multi_exec, (void *)&fh_curl_multi_exec },
   { "curl_multi_select", fg_curl_multi_select, (void *)&fh_curl_multi_select },
+  { "curl_multi_await", fg_curl_multi_await, (void *)&fh_curl_multi_await },
   { "fb_curl_multi_fdset", fg_fb_curl_multi_fdset, (void *)&fh_fb_curl_multi_fdset },
   { "curl_multi_getcontent", fg_curl_multi_getcontent, (void *)&fh_curl_multi_getcontent },
   { "curl_multi_info_read", fg_curl_multi_info_read, (void *)&fh_curl_multi_info_read },
@@ -3721,6 +3730,7 @@ const HhbcExtFuncInfo hhbc_ext_funcs[] = {
   { "hphp_recursivedirectoryiterator_getsubpath", fg_hphp_recursivedirectoryiterator_getsubpath, (void *)&fh_hphp_recursivedirectoryiterator_getsubpath },
   { "hphp_recursivedirectoryiterator_getsubpathname", fg_hphp_recursivedirectoryiterator_getsubpathname, (void *)&fh_hphp_recursivedirectoryiterator_getsubpathname },
   { "json_encode", fg_json_encode, (void *)&fh_json_encode },
+  { "json_encode_to_output", fg_json_encode_to_output, (void *)&fh_json_encode_to_output },
   { "json_decode", fg_json_decode, (void *)&fh_json_decode },
   { "ldap_connect", fg_ldap_connect, (void *)&fh_ldap_connect },
   { "ldap_explode_dn", fg_ldap_explode_dn, (void *)&fh_ldap_explode_dn },
@@ -4352,6 +4362,7 @@ const HhbcExtFuncInfo hhbc_ext_funcs[] = {
   { "memcache_set", fg_memcache_set, (void *)&fh_memcache_set },
   { "memcache_replace", fg_memcache_replace, (void *)&fh_memcache_replace },
   { "memcache_get", fg_memcache_get, (void *)&fh_memcache_get },
+  { "memcache_defer_get", fg_memcache_defer_get, (void *)&fh_memcache_defer_get },
   { "memcache_delete", fg_memcache_delete, (void *)&fh_memcache_delete },
   { "memcache_increment", fg_memcache_increment, (void *)&fh_memcache_increment },
   { "memcache_decrement", fg_memcache_decrement, (void *)&fh_memcache_decrement },
@@ -4427,6 +4438,9 @@ const HhbcExtFuncInfo hhbc_ext_funcs[] = {
   { "mysql_more_results", fg_mysql_more_results, (void *)&fh_mysql_more_results },
   { "mysql_fetch_result", fg_mysql_fetch_result, (void *)&fh_mysql_fetch_result },
   { "mysql_unbuffered_query", fg_mysql_unbuffered_query, (void *)&fh_mysql_unbuffered_query },
+  { "mysql_async_query", fg_mysql_async_query, (void *)&fh_mysql_async_query },
+  { "mysql_async_wait", fg_mysql_async_wait, (void *)&fh_mysql_async_wait },
+  { "mysql_async_result", fg_mysql_async_result, (void *)&fh_mysql_async_result },
   { "mysql_db_query", fg_mysql_db_query, (void *)&fh_mysql_db_query },
   { "mysql_list_dbs", fg_mysql_list_dbs, (void *)&fh_mysql_list_dbs },
   { "mysql_list_tables", fg_mysql_list_tables, (void *)&fh_mysql_list_tables },
@@ -4716,6 +4730,8 @@ const HhbcExtFuncInfo hhbc_ext_funcs[] = {
   { "pagelet_server_task_start", fg_pagelet_server_task_start, (void *)&fh_pagelet_server_task_start },
   { "pagelet_server_task_status", fg_pagelet_server_task_status, (void *)&fh_pagelet_server_task_status },
   { "pagelet_server_task_result", fg_pagelet_server_task_result, (void *)&fh_pagelet_server_task_result },
+  { "pagelet_server_task_start_batch", fg_pagelet_server_task_start_batch, (void *)&fh_pagelet_server_task_start_batch },
+  { "pagelet_server_task_select", fg_pagelet_server_task_select, (void *)&fh_pagelet_server_task_select },
   { "pagelet_server_flush", fg_pagelet_server_flush, (void *)&fh_pagelet_server_flush },
   { "xbox_send_message", fg_xbox_send_message, (void *)&fh_xbox_send_message },
   { "xbox_post_message", fg_xbox_post_message, (void *)&fh_xbox_post_message },
@@ -0,0 +1,161 @@
+/*
+   +----------------------------------------------------------------------+
+   | HipHop for PHP                                                       |
+   +----------------------------------------------------------------------+
+   | Copyright (c) 2010- Facebook, Inc. (http://www.facebook.com)         |
+   +----------------------------------------------------------------------+
+   | This source file is subject to version 3.01 of the PHP license,      |
+   | that is bundled with this package in the file LICENSE, and is        |
+   | available through the world-wide-web at the following url:           |
+   | http://www.php.net/license/3_01.txt                                  |
+   | If you did not receive a copy of the PHP license and are unable to   |
+   | obtain it through the world-wide-web, please send a note to          |
+   | license@php.net so we can mail you a copy immediately.               |
+   +----------------------------------------------------------------------+
+*/
+
+#include <tbb/concurrent_hash_map.h>
+
+#include "util/logger.h"
+#include "util/trace.h"
+#include "runtime/base/runtime_option.h"
+#include "runtime/base/server/source_root_info.h"
+#include "runtime/vm/autoload_index.h"
+
+namespace HPHP {
+namespace VM {
+
+static const Trace::Module TRACEMOD = Trace::hhbc;
+
+// Classes and functions are case insensitive, constants are not.  A NULL
+// path marks a name that more than one file defines.
+typedef tbb::concurrent_hash_map<const StringData*, const StringData*,
+                                 StringDataHashICompare> AutoloadIMap;
+typedef tbb::concurrent_hash_map<const StringData*, const StringData*,
+                                 StringDataHashCompare> AutoloadMap;
+
+struct AutoloadNames {
+  AutoloadIMap classes;
+  AutoloadIMap functions;
+  AutoloadMap constants;
+};
+
+// One index per source root, so sandboxes sharing a server each see their
+// own checkout.  A RepoAuthoritative server has the one root.  Indexes are
+// never freed; there is one per sandbox that has compiled something.
+typedef tbb::concurrent_hash_map<std::string, AutoloadNames*,
+                                 stringHashCompare> AutoloadRootMap;
+static AutoloadRootMap s_roots;
+
+bool AutoloadIndex::s_enabled = false;
+
+static const std::string& currentRoot() {
+  return RuntimeOption::RepoAuthoritative ? RuntimeOption::SourceRoot :
+    SourceRootInfo::GetCurrentSourceRoot();
+}
+
+static AutoloadNames* namesFor(const std::string& root, bool create) {
+  {
+    AutoloadRootMap::const_accessor acc;
+    if (s_roots.find(acc, root)) return acc->second;
+  }
+  if (!create) return NULL;
+  AutoloadRootMap::accessor acc;
+  if (s_roots.insert(acc, root)) {
+    acc->second = new AutoloadNames;
+  }
+  return acc->second;
+}
+
+template <class Map>
+static void insertName(Map& map, const StringData* name,
+                       const StringData* path, bool unique) {
+  typename Map::accessor acc;
+  if (map.insert(acc, name)) {
+    acc->second = path;
+  } else if (acc->second != path) {
+    acc->second = unique ? NULL : path;
+  }
+}
+
+template <class Map>
+static const StringData* lookupName(const Map& map, const StringData* name) {
+  typename Map::const_accessor acc;
+  if (!map.find(acc, name)) return NULL;
+  return acc->second;
+}
+
+void AutoloadIndex::insert(const std::string& root, Kind kind,
+                           const StringData* name, const StringData* path,
+                           bool unique) {
+  ASSERT(name->isStatic() && path->isStatic());
+  AutoloadNames* names = namesFor(root, true);
+  switch (kind) {
+    case Repo::AutoloadClass:
+      insertName(names->classes, name, path, unique);
+      break;
+    case Repo::AutoloadFunction:
+      insertName(names->functions, name, path, unique);
+      break;
+    case Repo::AutoloadConstant:
+      insertName(names->constants, name, path, unique);
+      break;
+  }
+}
+
+void AutoloadIndex::Init() {
+  if (!RuntimeOption::AutoloadIndex) return;
+  s_enabled = true;
+  if (!RuntimeOption::RepoAuthoritative) return;
+
+  std::vector<Repo::AutoloadEntry> entries;
+  Repo::get().enumerateAutoloadEntries(entries);
+  for (size_t i = 0; i < entries.size(); i++) {
+    const Repo::AutoloadEntry& e = entries[i];
+    std::string path = e.path;
+    if (path[0] != '/') {
+      path = RuntimeOption::SourceRoot + path;
+    }
+    insert(RuntimeOption::SourceRoot, e.kind,
+           StringData::GetStaticString(e.name),
+           StringData::GetStaticString(path), true);
+  }
+  AutoloadNames* names = namesFor(RuntimeOption::SourceRoot, true);
+  Logger::Info("Autoload index: %lu classes, %lu functions, %lu constants",
+               names->classes.size(), names->functions.size(),
+               names->constants.size());
+}
+
+void AutoloadIndex::Record(const Unit* unit) {
+  if (!s_enabled || RuntimeOption::RepoAuthoritative) return;
+  const StringData* path = unit->filepath();
+  if (path->empty() || path->data()[0] != '/') return;
+  path = StringData::GetStaticString(path);
+  const std::string& root = currentRoot();
+  TRACE(2, "AutoloadIndex: recording %s for %s\n", path->data(),
+        root.c_str());
+  for (Unit::PreClassRange r(unit->preclasses()); !r.empty(); ) {
+    const StringData* name = r.popFront()->name();
+    if (strchr(name->data(), '$')) continue;
+    insert(root, Repo::AutoloadClass, StringData::GetStaticString(name), path,
+           false);
+  }
+  for (Unit::MutableFuncRange r(unit->hoistableFuncs()); !r.empty(); ) {
+    insert(root, Repo::AutoloadFunction,
+           StringData::GetStaticString(r.popFront()->name()), path, false);
+  }
+}
+
+const StringData* AutoloadIndex::Lookup(Kind kind, const StringData* name) {
+  ASSERT(s_enabled);
+  AutoloadNames* names = namesFor(currentRoot(), false);
+  if (!names) return NULL;
+  switch (kind) {
+    case Repo::AutoloadClass:    return lookupName(names->classes, name);
+    case Repo::AutoloadFunction: return lookupName(names->functions, name);
+    case Repo::AutoloadConstant: return lookupName(names->constants, name);
+  }
+  not_reached();
+}
+
+} } // HPHP::VM
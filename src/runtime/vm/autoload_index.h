@@ -0,0 +1,67 @@
+/*
+   +----------------------------------------------------------------------+
+   | HipHop for PHP                                                       |
+   +----------------------------------------------------------------------+
+   | Copyright (c) 2010- Facebook, Inc. (http://www.facebook.com)         |
+   +----------------------------------------------------------------------+
+   | This source file is subject to version 3.01 of the PHP license,      |
+   | that is bundled with this package in the file LICENSE, and is        |
+   | available through the world-wide-web at the following url:           |
+   | http://www.php.net/license/3_01.txt                                  |
+   | If you did not receive a copy of the PHP license and are unable to   |
+   | obtain it through the world-wide-web, please send a note to          |
+   | license@php.net so we can mail you a copy immediately.               |
+   +----------------------------------------------------------------------+
+*/
+
+#ifndef incl_VM_AUTOLOAD_INDEX_H_
+#define incl_VM_AUTOLOAD_INDEX_H_
+
+#include "runtime/vm/repo.h"
+
+namespace HPHP {
+namespace VM {
+
+/*
+ * A process-wide map from class, interface, trait, function and constant
+ * names to the file that defines them, consulted by AutoloadHandler before
+ * fb_autoload_map and any user autoloader when Server.AutoloadIndex is on.
+ *
+ * In RepoAuthoritative mode the index is read from the repo once at
+ * startup, and a name defined in more than one file is left to the
+ * userland autoloaders.  Otherwise it learns from every file the server
+ * compiles; FileRepository recompiles a file when StatCache reports a
+ * change, so entries follow definitions as they move.  A stale entry
+ * costs one include of a file that is already loaded.  Names are kept per
+ * source root, so each sandbox only finds its own files.
+ */
+class AutoloadIndex {
+ public:
+  typedef Repo::AutoloadKind Kind;
+
+  static void Init();
+  static bool Enabled() { return s_enabled; }
+
+  /*
+   * Records the classes and hoistable functions `unit' defines under the
+   * current source root.
+   */
+  static void Record(const Unit* unit);
+
+  /*
+   * The absolute path of the file defining `name' under the current
+   * source root, or NULL.
+   */
+  static const StringData* Lookup(Kind kind, const StringData* name);
+
+ private:
+  static void insert(const std::string& root, Kind kind,
+                     const StringData* name, const StringData* path,
+                     bool unique);
+
+  static bool s_enabled;
+};
+
+} } // HPHP::VM
+
+#endif
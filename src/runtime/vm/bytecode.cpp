@@ -60,6 +60,7 @@
 #include <runtime/vm/stats.h>
 #include <runtime/vm/type-profile.h>
 #include <runtime/base/server/source_root_info.h>
+#include <runtime/base/server/request_trace.h>
 #include <runtime/base/util/extended_logger.h>
 
 #include <system/lib/systemlib.h>
@@ -2573,8 +2574,11 @@ HPHP::Eval::PhpFile* VMExecutionContext::lookupPhpFile(StringData* path,
     }
   }
   // This file hasn't been included yet, so we need to parse the file
-  efile = HPHP::Eval::FileRepository::checkoutFile(
-    hasRealpath ? rpath.get() : spath.get(), s);
+  {
+    TraceSpan span("include", spath.data());
+    efile = HPHP::Eval::FileRepository::checkoutFile(
+      hasRealpath ? rpath.get() : spath.get(), s);
+  }
   ASSERT(!efile || efile->getRef() > 0);
   if (efile && initial_opt) {
     // if initial_opt is not set, this shouldnt be recorded as a
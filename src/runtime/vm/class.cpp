@@ -392,6 +392,9 @@ template<class SerDe> void PreClassEmitter::serdeMetaData(SerDe& sd) {
     ;
 }
 
+template void PreClassEmitter::serdeMetaData<>(BlobEncoder&);
+template void PreClassEmitter::serdeMetaData<>(BlobDecoder&);
+
 //=============================================================================
 // PreClassRepoProxy.
 
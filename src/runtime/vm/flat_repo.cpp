@@ -0,0 +1,509 @@
+/*
+   +----------------------------------------------------------------------+
+   | HipHop for PHP                                                       |
+   +----------------------------------------------------------------------+
+   | Copyright (c) 2010- Facebook, Inc. (http://www.facebook.com)         |
+   +----------------------------------------------------------------------+
+   | This source file is subject to version 3.01 of the PHP license,      |
+   | that is bundled with this package in the file LICENSE, and is        |
+   | available through the world-wide-web at the following url:           |
+   | http://www.php.net/license/3_01.txt                                  |
+   | If you did not receive a copy of the PHP license and are unable to   |
+   | obtain it through the world-wide-web, please send a note to          |
+   | license@php.net so we can mail you a copy immediately.               |
+   +----------------------------------------------------------------------+
+*/
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <fstream>
+#include <algorithm>
+
+#include "util/logger.h"
+#include "util/trace.h"
+#include "util/hash.h"
+#include "util/util.h"
+#include "runtime/base/runtime_option.h"
+#include "runtime/ext/ext_variable.h"
+#include "runtime/vm/repo.h"
+#include "runtime/vm/flat_repo.h"
+
+namespace HPHP {
+namespace VM {
+
+static const Trace::Module TRACEMOD = Trace::hhbc;
+
+static const char kFlatMagic[8] = { 'H', 'H', 'B', 'C', 'F', 'L', 'A', 'T' };
+
+struct FlatRepo::Header {
+  char magic[8];
+  char schema[64];          // Repo::kSchemaId, NUL padded
+  uint32_t nBuckets;        // power of two; same for both tables
+  uint32_t nUnits;
+  uint64_t fileBucketOff;
+  uint64_t unitBucketOff;
+};
+
+// pathOff == 0 marks an empty bucket
+struct FlatRepo::FileBucket {
+  uint64_t pathOff;
+  uint32_t pathLen;
+  uint32_t unused;
+  uint64_t md5[2];
+};
+
+// off == 0 marks an empty bucket; bc, bc_meta and the blob follow each
+// other starting at off
+struct FlatRepo::UnitBucket {
+  uint64_t md5[2];
+  uint64_t off;
+  uint32_t bcLen;
+  uint32_t bcMetaLen;
+  uint32_t blobLen;
+  uint32_t unused;
+};
+
+FlatRepo* FlatRepo::s_flatRepo = NULL;
+
+FlatRepo::FlatRepo(const char* base, size_t size)
+  : m_base(base), m_size(size) {
+}
+
+FlatRepo::~FlatRepo() {
+  munmap((void*)m_base, m_size);
+}
+
+const FlatRepo::FileBucket* FlatRepo::fileBuckets() const {
+  return (const FileBucket*)(m_base + header()->fileBucketOff);
+}
+
+const FlatRepo::UnitBucket* FlatRepo::unitBuckets() const {
+  return (const UnitBucket*)(m_base + header()->unitBucketOff);
+}
+
+void FlatRepo::Init() {
+  ASSERT(!s_flatRepo);
+  if (!RuntimeOption::RepoAuthoritative ||
+      RuntimeOption::RepoFlatPath.empty()) {
+    return;
+  }
+  s_flatRepo = Open(RuntimeOption::RepoFlatPath.c_str());
+}
+
+FlatRepo* FlatRepo::Open(const char* path) {
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    Logger::Error("Unable to open flat repo %s: %s", path,
+                  Util::safe_strerror(errno).c_str());
+    return NULL;
+  }
+  struct stat st;
+  void* base = MAP_FAILED;
+  if (fstat(fd, &st) == 0 && size_t(st.st_size) >= sizeof(Header)) {
+    base = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  }
+  close(fd);
+  if (base == MAP_FAILED) {
+    Logger::Error("Unable to map flat repo %s", path);
+    return NULL;
+  }
+
+  FlatRepo* repo = new FlatRepo((const char*)base, st.st_size);
+  const Header* h = repo->header();
+  if (memcmp(h->magic, kFlatMagic, sizeof(kFlatMagic)) ||
+      strncmp(h->schema, Repo::kSchemaId, sizeof(h->schema))) {
+    Logger::Error("%s is not a flat repo for this build; using the SQLite "
+                  "repo instead", path);
+    delete repo;
+    return NULL;
+  }
+  if (!repo->checkBounds()) {
+    Logger::Error("%s is truncated or corrupt; using the SQLite repo instead",
+                  path);
+    delete repo;
+    return NULL;
+  }
+  TRACE(1, "Mapped flat repo %s: %u units\n", path, h->nUnits);
+  return repo;
+}
+
+static bool inBounds(uint64_t off, uint64_t len, uint64_t begin,
+                     uint64_t end) {
+  return off >= begin && off <= end && len <= end - off;
+}
+
+/*
+ * Every offset in the file is checked against the mapping once up front,
+ * so lookups can follow them without checking again.  Each table also
+ * needs an empty bucket, or a probe for a missing key would never end.
+ */
+bool FlatRepo::checkBounds() const {
+  const Header* h = header();
+  uint64_t size = m_size;
+  if (!h->nBuckets || (h->nBuckets & (h->nBuckets - 1)) ||
+      h->nUnits >= h->nBuckets) {
+    return false;
+  }
+  uint64_t fileTabLen = uint64_t(h->nBuckets) * sizeof(FileBucket);
+  uint64_t unitTabLen = uint64_t(h->nBuckets) * sizeof(UnitBucket);
+  if (!inBounds(h->fileBucketOff, fileTabLen, sizeof(Header), size) ||
+      !inBounds(h->unitBucketOff, unitTabLen, sizeof(Header), size) ||
+      h->fileBucketOff % sizeof(uint64_t) ||
+      h->unitBucketOff % sizeof(uint64_t)) {
+    return false;
+  }
+  uint64_t dataOff = std::max(h->fileBucketOff + fileTabLen,
+                              h->unitBucketOff + unitTabLen);
+
+  bool fileEmpty = false, unitEmpty = false;
+  const FileBucket* files = fileBuckets();
+  const UnitBucket* units = unitBuckets();
+  for (uint32_t i = 0; i < h->nBuckets; ++i) {
+    if (!files[i].pathOff) {
+      fileEmpty = true;
+    } else if (!inBounds(files[i].pathOff, files[i].pathLen, dataOff, size)) {
+      return false;
+    }
+    if (!units[i].off) {
+      unitEmpty = true;
+    } else if (!inBounds(units[i].off, uint64_t(units[i].bcLen) +
+                         units[i].bcMetaLen + units[i].blobLen,
+                         dataOff, size)) {
+      return false;
+    }
+  }
+  return fileEmpty && unitEmpty;
+}
+
+bool FlatRepo::findFile(const char* path, MD5& md5) const {
+  size_t len = strlen(path);
+  uint32_t mask = header()->nBuckets - 1;
+  const FileBucket* buckets = fileBuckets();
+  for (uint32_t i = hash_string_cs(path, len) & mask; ; i = (i + 1) & mask) {
+    const FileBucket& b = buckets[i];
+    if (!b.pathOff) return false;
+    if (b.pathLen == len && !memcmp(m_base + b.pathOff, path, len)) {
+      md5.q[0] = b.md5[0];
+      md5.q[1] = b.md5[1];
+      return true;
+    }
+  }
+}
+
+void FlatRepo::enumerateFiles(std::vector<std::string>& paths) const {
+  const FileBucket* buckets = fileBuckets();
+  for (uint32_t i = 0; i < header()->nBuckets; ++i) {
+    if (buckets[i].pathOff) {
+      paths.push_back(std::string(m_base + buckets[i].pathOff,
+                                  buckets[i].pathLen));
+    }
+  }
+}
+
+Unit* FlatRepo::loadUnit(const std::string& name, const MD5& md5) const {
+  uint32_t mask = header()->nBuckets - 1;
+  const UnitBucket* buckets = unitBuckets();
+  const UnitBucket* b;
+  for (uint32_t i = md5.q[0] & mask; ; i = (i + 1) & mask) {
+    b = &buckets[i];
+    if (!b->off) return NULL;
+    if (b->md5[0] == md5.q[0] && b->md5[1] == md5.q[1]) break;
+  }
+
+  TRACE(3, "Flat repo loaded '%s' (0x%016llx%016llx)\n",
+           name.c_str(), md5.q[0], md5.q[1]);
+  return createUnit(name, md5, m_base + b->off, b->bcLen, b->bcMetaLen,
+                    b->blobLen);
+}
+
+Unit* FlatRepo::createUnit(const std::string& name, const MD5& md5,
+                           const char* p, uint32_t bcLen, uint32_t bcMetaLen,
+                           uint32_t blobLen) {
+  UnitEmitter ue(md5);
+  ue.setFilepath(StringData::GetStaticString(name));
+  ue.setBc((const uchar*)p, bcLen);
+  ue.setBcMeta((const uchar*)p + bcLen, bcMetaLen);
+  BlobDecoder blob(p + bcLen + bcMetaLen, blobLen);
+  decodeUnit(blob, ue);
+  return ue.create();
+}
+
+Unit* FlatRepo::RoundTrip(UnitEmitter& ue) {
+  BlobEncoder blob;
+  encodeUnit(blob, ue);
+  std::string data((const char*)ue.m_bc, ue.m_bclen);
+  if (ue.m_bc_meta_len) {
+    data.append((const char*)ue.m_bc_meta, ue.m_bc_meta_len);
+  }
+  data.append((const char*)blob.data(), blob.size());
+  return createUnit(ue.getFilepath()->data(), ue.md5(), data.data(),
+                    ue.m_bclen, ue.m_bc_meta_len, blob.size());
+}
+
+static bool funcEmitterSnLess(const FuncEmitter* a, const FuncEmitter* b) {
+  return a->sn() < b->sn();
+}
+
+/*
+ * Mirrors what UnitEmitter::commit() spreads over the Unit* tables, and
+ * decodeUnit() mirrors UnitRepoProxy::load().
+ */
+void FlatRepo::encodeUnit(BlobEncoder& blob, UnitEmitter& ue) {
+  blob(ue.m_mainReturn)(bool(ue.m_mainReturn._count));
+
+  LineTable lines;
+  for (size_t i = 0; i < ue.m_sourceLocTab.size(); ++i) {
+    Offset endOff = i < ue.m_sourceLocTab.size() - 1
+                      ? ue.m_sourceLocTab[i + 1].first
+                      : ue.m_bclen;
+    lines.push_back(LineEntry(endOff, ue.m_sourceLocTab[i].second.line1));
+  }
+  blob(lines);
+
+  blob(ue.m_litstrs);
+  blob(uint32_t(ue.m_arrays.size()));
+  for (size_t i = 0; i < ue.m_arrays.size(); ++i) {
+    blob(ue.m_arrays[i].serialized);
+  }
+  blob(uint32_t(ue.m_preConsts.size()));
+  for (size_t i = 0; i < ue.m_preConsts.size(); ++i) {
+    blob(ue.m_preConsts[i].name)(ue.m_preConsts[i].value);
+  }
+
+  blob(uint32_t(ue.m_pceVec.size()));
+  for (size_t i = 0; i < ue.m_pceVec.size(); ++i) {
+    PreClassEmitter* pce = ue.m_pceVec[i];
+    blob(pce->name())(pce->hoistable());
+    pce->serdeMetaData(blob);
+  }
+
+  std::vector<int> mergeables;
+  for (int i = 0, n = ue.m_mergeableStmts.size(); i < n; i++) {
+    if (ue.m_mergeableStmts[i].first != UnitMergeKindClass) {
+      mergeables.push_back(i);
+    }
+  }
+  blob(uint32_t(mergeables.size()));
+  for (size_t i = 0; i < mergeables.size(); ++i) {
+    int ix = mergeables[i];
+    UnitMergeKind kind = ue.m_mergeableStmts[ix].first;
+    Id id = ue.m_mergeableStmts[ix].second;
+    blob(ix)(kind);
+    switch (kind) {
+      case UnitMergeKindReqMod:
+      case UnitMergeKindReqSrc:
+      case UnitMergeKindReqDoc:
+        blob(id);
+        break;
+      case UnitMergeKindDefine:
+      case UnitMergeKindGlobal:
+        blob(ue.m_mergeableValues[id].first)(ue.m_mergeableValues[id].second);
+        break;
+      default:
+        not_reached();
+    }
+  }
+
+  std::vector<FuncEmitter*> fes;
+  for (size_t i = 0; i < ue.m_feTab.size(); ++i) {
+    fes.push_back(const_cast<FuncEmitter*>(ue.m_feTab[i].second));
+  }
+  std::sort(fes.begin(), fes.end(), funcEmitterSnLess);
+  blob(uint32_t(fes.size()));
+  for (size_t i = 0; i < fes.size(); ++i) {
+    FuncEmitter* fe = fes[i];
+    Id preClassId = fe->pce() ? fe->pce()->id() : -1;
+    blob(preClassId)(fe->name())(fe->top());
+    fe->serdeMetaData(blob);
+  }
+}
+
+void FlatRepo::decodeUnit(BlobDecoder& blob, UnitEmitter& ue) {
+  TypedValue mainReturn;
+  bool mergeable;
+  blob(mainReturn)(mergeable);
+  mainReturn._count = mergeable;
+  ue.setMainReturn(&mainReturn);
+
+  LineTable lines;
+  blob(lines);
+  ue.setLines(lines);
+
+  std::vector<const StringData*> litstrs;
+  blob(litstrs);
+  for (size_t i = 0; i < litstrs.size(); ++i) {
+    Id id UNUSED = ue.mergeLitstr(litstrs[i]);
+    ASSERT(id == Id(i));
+  }
+
+  uint32_t n;
+  blob(n);
+  for (uint32_t i = 0; i < n; ++i) {
+    const StringData* array;
+    blob(array);
+    Variant v = f_unserialize(String(array));
+    Id id UNUSED = ue.mergeArray(v.asArrRef().get(), array);
+    ASSERT(id == Id(i));
+  }
+  blob(n);
+  for (uint32_t i = 0; i < n; ++i) {
+    const StringData* name;
+    TypedValue value;
+    blob(name)(value);
+    Id id UNUSED = ue.addPreConst(name, value);
+    ASSERT(id == Id(i));
+  }
+
+  blob(n);
+  for (uint32_t i = 0; i < n; ++i) {
+    const StringData* name;
+    PreClass::Hoistable hoistable;
+    blob(name)(hoistable);
+    PreClassEmitter* pce = ue.newPreClassEmitter(name, hoistable);
+    pce->serdeMetaData(blob);
+    ASSERT(pce->id() == Id(i));
+  }
+
+  blob(n);
+  for (uint32_t i = 0; i < n; ++i) {
+    int ix;
+    UnitMergeKind kind;
+    Id id;
+    blob(ix)(kind)(id);
+    switch (kind) {
+      case UnitMergeKindReqMod:
+      case UnitMergeKindReqSrc:
+      case UnitMergeKindReqDoc:
+        ue.insertMergeableInclude(ix, kind, id);
+        break;
+      case UnitMergeKindDefine:
+      case UnitMergeKindGlobal: {
+        TypedValue value;
+        blob(value);
+        ue.insertMergeableDef(ix, kind, id, value);
+        break;
+      }
+      default:
+        not_reached();
+    }
+  }
+
+  blob(n);
+  for (uint32_t i = 0; i < n; ++i) {
+    Id preClassId;
+    const StringData* name;
+    bool top;
+    blob(preClassId)(name)(top);
+    FuncEmitter* fe;
+    if (preClassId < 0) {
+      fe = ue.newFuncEmitter(name, top);
+    } else {
+      PreClassEmitter* pce = ue.pce(preClassId);
+      fe = ue.newMethodEmitter(name, pce);
+      bool added UNUSED = pce->addMethod(fe);
+      ASSERT(added);
+    }
+    fe->setTop(top);
+    fe->serdeMetaData(blob);
+    fe->finish(fe->past(), true);
+    ue.recordFunction(fe);
+  }
+}
+
+bool FlatRepo::Write(const std::string& path,
+                     const std::vector<std::pair<std::string, MD5> >& files) {
+  Repo& repo = Repo::get();
+
+  uint32_t nBuckets = 16;
+  while (nBuckets < files.size() * 2) nBuckets <<= 1;
+  uint32_t mask = nBuckets - 1;
+  std::vector<FileBucket> fileTab(nBuckets);
+  std::vector<UnitBucket> unitTab(nBuckets);
+  memset(&fileTab[0], 0, nBuckets * sizeof(FileBucket));
+  memset(&unitTab[0], 0, nBuckets * sizeof(UnitBucket));
+
+  Header h;
+  memset(&h, 0, sizeof(h));
+  memcpy(h.magic, kFlatMagic, sizeof(kFlatMagic));
+  strncpy(h.schema, Repo::kSchemaId, sizeof(h.schema));
+  h.nBuckets = nBuckets;
+  h.fileBucketOff = sizeof(Header);
+  h.unitBucketOff = h.fileBucketOff + nBuckets * sizeof(FileBucket);
+  const uint64_t dataOff = h.unitBucketOff + nBuckets * sizeof(UnitBucket);
+
+  std::string data;
+  for (size_t f = 0; f < files.size(); ++f) {
+    const std::string& name = files[f].first;
+    const MD5& md5 = files[f].second;
+
+    uint32_t fi = hash_string_cs(name.c_str(), name.size()) & mask;
+    for (; fileTab[fi].pathOff; fi = (fi + 1) & mask) {
+      if (fileTab[fi].pathLen == name.size() &&
+          !data.compare(fileTab[fi].pathOff - dataOff, name.size(), name)) {
+        break;
+      }
+    }
+    if (fileTab[fi].pathOff) continue;
+
+    uint32_t ui = md5.q[0] & mask;
+    for (; unitTab[ui].off; ui = (ui + 1) & mask) {
+      if (unitTab[ui].md5[0] == md5.q[0] && unitTab[ui].md5[1] == md5.q[1]) {
+        break;
+      }
+    }
+    if (!unitTab[ui].off) {
+      UnitEmitter ue(md5);
+      ue.setFilepath(StringData::GetStaticString(name));
+      if (!repo.urp().loadEmitter(ue, RepoIdLocal)) {
+        // files without a pseudo-main never get a unit; the SQLite repo
+        // doesn't find them either
+        TRACE(1, "flat repo: no unit for '%s'\n", name.c_str());
+        continue;
+      }
+      BlobEncoder blob;
+      encodeUnit(blob, ue);
+
+      UnitBucket& b = unitTab[ui];
+      b.md5[0] = md5.q[0];
+      b.md5[1] = md5.q[1];
+      b.off = dataOff + data.size();
+      b.bcLen = ue.m_bclen;
+      b.bcMetaLen = ue.m_bc_meta_len;
+      b.blobLen = blob.size();
+      data.append((const char*)ue.m_bc, ue.m_bclen);
+      if (ue.m_bc_meta_len) {
+        data.append((const char*)ue.m_bc_meta, ue.m_bc_meta_len);
+      }
+      data.append((const char*)blob.data(), blob.size());
+      h.nUnits++;
+    }
+
+    FileBucket& fb = fileTab[fi];
+    fb.pathOff = dataOff + data.size();
+    fb.pathLen = name.size();
+    fb.md5[0] = md5.q[0];
+    fb.md5[1] = md5.q[1];
+    data.append(name);
+  }
+
+  // written under a temporary name so a server mapping the old file at
+  // the same path never sees a partial one
+  std::string tmp = path + ".tmp";
+  std::ofstream out(tmp.c_str(), std::ios::binary | std::ios::trunc);
+  out.write((const char*)&h, sizeof(h));
+  out.write((const char*)&fileTab[0], nBuckets * sizeof(FileBucket));
+  out.write((const char*)&unitTab[0], nBuckets * sizeof(UnitBucket));
+  out.write(data.data(), data.size());
+  out.close();
+  if (!out || rename(tmp.c_str(), path.c_str())) {
+    Logger::Error("flat repo: unable to write %s", path.c_str());
+    unlink(tmp.c_str());
+    return false;
+  }
+  Logger::Info("flat repo: wrote %u units for %u files to %s",
+               h.nUnits, (unsigned)files.size(), path.c_str());
+  return true;
+}
+
+} } // HPHP::VM
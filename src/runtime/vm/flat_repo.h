@@ -0,0 +1,110 @@
+/*
+   +----------------------------------------------------------------------+
+   | HipHop for PHP                                                       |
+   +----------------------------------------------------------------------+
+   | Copyright (c) 2010- Facebook, Inc. (http://www.facebook.com)         |
+   +----------------------------------------------------------------------+
+   | This source file is subject to version 3.01 of the PHP license,      |
+   | that is bundled with this package in the file LICENSE, and is        |
+   | available through the world-wide-web at the following url:           |
+   | http://www.php.net/license/3_01.txt                                  |
+   | If you did not receive a copy of the PHP license and are unable to   |
+   | obtain it through the world-wide-web, please send a note to          |
+   | license@php.net so we can mail you a copy immediately.               |
+   +----------------------------------------------------------------------+
+*/
+
+#ifndef incl_VM_FLAT_REPO_H_
+#define incl_VM_FLAT_REPO_H_
+
+#include "runtime/vm/unit.h"
+#include "runtime/vm/blob_helper.h"
+
+namespace HPHP {
+namespace VM {
+
+/*
+ * An immutable, read-only alternative to the SQLite repo for
+ * RepoAuthoritative mode.  hphp writes it next to the hhbc repo (see
+ * Repo.GenerateFlat in doc/options.compiler) and the runtime maps it
+ * at startup when Repo.Flat.Path is set.
+ *
+ * The file is a header followed by two open-addressed hash tables and
+ * the unit data they point into:
+ *
+ *   Header      magic, schema id, table sizes and offsets
+ *   FileBucket  path -> md5, one per source file (what Repo::findFile needs)
+ *   UnitBucket  md5 -> bytecode, bytecode metadata and a BlobEncoder blob
+ *               holding everything else the Unit* tables store
+ *   data        per unit bc, bc_meta and blob, and each file's path
+ *
+ * Lookups are a hash probe over the mapping, so loading a unit takes no
+ * locks and touches only the pages that unit lives on.  Units loaded
+ * from here have no repo id, so getSourceLoc() and friends fail as they
+ * do for units that were never committed.
+ */
+class FlatRepo {
+ public:
+  /*
+   * Maps RuntimeOption::RepoFlatPath if RepoAuthoritative is on.  Must be
+   * called once, before any unit is loaded.
+   */
+  static void Init();
+
+  /*
+   * The mapped repo, or NULL if there is none.
+   */
+  static const FlatRepo* Get() { return s_flatRepo; }
+
+  /*
+   * Maps path and checks that every table and offset in it lies within
+   * the file.  Returns NULL, after logging why, if it can't be used.
+   */
+  static FlatRepo* Open(const char* path);
+  ~FlatRepo();
+
+  bool findFile(const char* path, MD5& md5) const;
+  void enumerateFiles(std::vector<std::string>& paths) const;
+  Unit* loadUnit(const std::string& name, const MD5& md5) const;
+
+  /*
+   * Writes the units for the given (path, md5) pairs, read back from the
+   * local repo, to `path'.  Returns false and logs on failure.
+   */
+  static bool Write(const std::string& path,
+                    const std::vector<std::pair<std::string, MD5> >& files);
+
+  /*
+   * Encodes ue the way Write() does and builds a unit from the result the
+   * way loadUnit() does, so tests can hold it up against ue.create().
+   */
+  static Unit* RoundTrip(UnitEmitter& ue);
+
+ private:
+  struct Header;
+  struct FileBucket;
+  struct UnitBucket;
+
+  FlatRepo(const char* base, size_t size);
+
+  bool checkBounds() const;
+
+  static void encodeUnit(BlobEncoder& blob, UnitEmitter& ue);
+  static void decodeUnit(BlobDecoder& blob, UnitEmitter& ue);
+  static Unit* createUnit(const std::string& name, const MD5& md5,
+                          const char* bc, uint32_t bcLen, uint32_t bcMetaLen,
+                          uint32_t blobLen);
+
+  const Header* header() const { return (const Header*)m_base; }
+  const FileBucket* fileBuckets() const;
+  const UnitBucket* unitBuckets() const;
+
+  static FlatRepo* s_flatRepo;
+
+  const char* m_base;
+  size_t m_size;
+};
+
+} } // HPHP::VM
+
+#endif
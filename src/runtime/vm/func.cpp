@@ -926,6 +926,9 @@ void FuncEmitter::serdeMetaData(SerDe& sd) {
     ;
 }
 
+template void FuncEmitter::serdeMetaData<>(BlobEncoder&);
+template void FuncEmitter::serdeMetaData<>(BlobDecoder&);
+
 //=============================================================================
 // FuncRepoProxy.
 
@@ -239,6 +239,11 @@ struct Func {
   Offset past() const { return shared()->m_past; }
   int line1() const { return shared()->m_line1; }
   int line2() const { return shared()->m_line2; }
+  /*
+   * For builtins, the type of the C++ return value.  For user functions
+   * compiled WholeProgram, the type every RetC in the body was inferred
+   * to return, or KindOfInvalid if that isn't known.
+   */
   DataType returnType() const { return shared()->m_returnType; }
   const SVInfoVec& staticVars() const { return shared()->m_staticVars; }
   const StringData* name() const {
@@ -268,6 +273,7 @@ struct Func {
     return offsetof(SharedData, m_base);
   }
   static void enableIntercept();
+  static bool interceptsEnabled() { return s_interceptsEnabled; }
   char &maybeIntercepted() const { return m_maybeIntercepted; }
   bool checkInterceptable() const {
     if (!m_maybeIntercepted) return false;
@@ -552,6 +558,9 @@ public:
   void setAttrs(Attr attrs) { m_attrs = attrs; }
   Attr attrs() const { return m_attrs; }
 
+  void setReturnType(DataType dt) { m_returnType = dt; }
+  DataType returnType() const { return m_returnType; }
+
   void setTop(bool top) { m_top = top; }
   bool top() { return m_top; }
 
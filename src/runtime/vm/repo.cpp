@@ -18,6 +18,7 @@
 #include "util/trace.h"
 #include "runtime/vm/repo.h"
 #include "runtime/vm/repo_schema.h"
+#include "runtime/vm/flat_repo.h"
 
 namespace HPHP {
 namespace VM {
@@ -112,6 +113,11 @@ void Repo::setCliFile(const std::string& cliFile) {
 }
 
 Unit* Repo::loadUnit(const std::string& name, const MD5& md5) {
+  if (const FlatRepo* flat = FlatRepo::Get()) {
+    if (Unit* u = flat->loadUnit(name, md5)) {
+      return u;
+    }
+  }
   if (m_dbc == NULL) {
     return NULL;
   }
@@ -159,7 +165,89 @@ bool Repo::GetFileHashStmt::get(const char *path, MD5& md5) {
   return false;
 }
 
+void Repo::GetFilePathsStmt::get(std::vector<std::string>& paths) {
+  try {
+    RepoTxn txn(m_repo);
+    if (!prepared()) {
+      std::stringstream ssSelect;
+      ssSelect << "SELECT DISTINCT f.path FROM "
+               << m_repo.table(m_repoId, "FileMd5")
+               << " AS f, " << m_repo.table(m_repoId, "Unit")
+               << " AS u WHERE f.md5 == u.md5;";
+      txn.prepare(*this, ssSelect.str());
+    }
+    RepoTxnQuery query(txn, *this);
+    do {
+      query.step();
+      if (query.row()) {
+        const char* path; /**/ query.getText(0, path);
+        paths.push_back(path);
+      }
+    } while (!query.done());
+    txn.commit();
+  } catch (RepoExc& re) {
+  }
+}
+
+void Repo::GetAutoloadEntriesStmt::get(std::vector<AutoloadEntry>& entries) {
+  try {
+    RepoTxn txn(m_repo);
+    if (!prepared()) {
+      // Classes (including interfaces and traits), top level functions and
+      // the constants hphp turned into Define mergeables, each with the file
+      // that defines it.  Closures and generator bodies have a '$' in their
+      // name and can never be autoloaded.
+      std::string files = m_repo.table(m_repoId, "FileMd5") + " AS f, " +
+                          m_repo.table(m_repoId, "Unit") + " AS u";
+      std::stringstream ssSelect;
+      ssSelect << "SELECT " << AutoloadClass << ", c.name, f.path FROM "
+               << files << ", " << m_repo.table(m_repoId, "PreClass")
+               << " AS c WHERE f.md5 == u.md5 AND c.unitSn == u.unitSn"
+                  " AND c.name NOT LIKE '%$%'"
+               << " UNION ALL SELECT " << AutoloadFunction
+               << ", fn.name, f.path FROM "
+               << files << ", " << m_repo.table(m_repoId, "Func")
+               << " AS fn WHERE f.md5 == u.md5 AND fn.unitSn == u.unitSn"
+                  " AND fn.preClassId < 0 AND fn.top != 0 AND fn.name != ''"
+                  " AND fn.name NOT LIKE '%$%'"
+               << " UNION ALL SELECT " << AutoloadConstant
+               << ", l.litstr, f.path FROM "
+               << files << ", " << m_repo.table(m_repoId, "UnitMergeables")
+               << " AS m, " << m_repo.table(m_repoId, "UnitLitstr")
+               << " AS l WHERE f.md5 == u.md5 AND m.unitSn == u.unitSn"
+                  " AND m.mergeableKind == " << UnitMergeKindDefine
+               << " AND l.unitSn == u.unitSn AND l.litstrId == m.mergeableId;";
+      txn.prepare(*this, ssSelect.str());
+    }
+    RepoTxnQuery query(txn, *this);
+    do {
+      query.step();
+      if (query.row()) {
+        int kind;         /**/ query.getInt(0, kind);
+        const char* name; /**/ query.getText(1, name);
+        const char* path; /**/ query.getText(2, path);
+        AutoloadEntry e;
+        e.kind = AutoloadKind(kind);
+        e.name = name;
+        e.path = path;
+        entries.push_back(e);
+      }
+    } while (!query.done());
+    txn.commit();
+  } catch (RepoExc& re) {
+  }
+}
+
 bool Repo::findFile(const char *path, const string &root, MD5& md5) {
+  if (const FlatRepo* flat = FlatRepo::Get()) {
+    // the flat repo holds every file hphp compiled, so a miss is final
+    if (*path == '/' && !root.empty() &&
+        !strncmp(root.c_str(), path, root.size()) &&
+        flat->findFile(path + root.size(), md5)) {
+      return true;
+    }
+    return flat->findFile(path, md5);
+  }
   if (m_dbc == NULL) {
     return false;
   }
@@ -182,6 +270,32 @@ bool Repo::findFile(const char *path, const string &root, MD5& md5) {
   return false;
 }
 
+void Repo::enumerateFiles(std::vector<std::string>& paths) {
+  if (const FlatRepo* flat = FlatRepo::Get()) {
+    flat->enumerateFiles(paths);
+    return;
+  }
+  if (m_dbc == NULL) {
+    return;
+  }
+  for (int repoId = RepoIdCount - 1; repoId >= 0; --repoId) {
+    getFilePaths(repoId).get(paths);
+  }
+  std::sort(paths.begin(), paths.end());
+  paths.erase(std::unique(paths.begin(), paths.end()), paths.end());
+}
+
+void Repo::enumerateAutoloadEntries(std::vector<AutoloadEntry>& entries) {
+  // A flat repo is always written next to the SQLite repo it was built
+  // from, so the names are read from there in both cases.
+  if (m_dbc == NULL) {
+    return;
+  }
+  for (int repoId = RepoIdCount - 1; repoId >= 0; --repoId) {
+    getAutoloadEntries(repoId).get(entries);
+  }
+}
+
 void Repo::commitMd5(UnitOrigin unitOrigin, UnitEmitter* ue) {
   const StringData* path = ue->getFilepath();
   const MD5& md5 = ue->md5();
@@ -77,13 +77,28 @@ class Repo : public RepoProxy {
 
   Unit* loadUnit(const std::string& name, const MD5& md5);
   bool findFile(const char* path, const std::string& root, MD5& md5);
+  void enumerateFiles(std::vector<std::string>& paths);
+
+  enum AutoloadKind {
+    AutoloadClass,
+    AutoloadFunction,
+    AutoloadConstant
+  };
+  struct AutoloadEntry {
+    AutoloadKind kind;
+    std::string name;
+    std::string path;
+  };
+  void enumerateAutoloadEntries(std::vector<AutoloadEntry>& entries);
   void commitMd5(UnitOrigin unitOrigin, UnitEmitter *ue);
 
 #define RP_IOP(o) RP_OP(Insert##o, insert##o)
 #define RP_GOP(o) RP_OP(Get##o, get##o)
 #define RP_OPS \
   RP_IOP(FileHash) \
-  RP_GOP(FileHash)
+  RP_GOP(FileHash) \
+  RP_GOP(FilePaths) \
+  RP_GOP(AutoloadEntries)
   class InsertFileHashStmt : public RepoProxy::Stmt {
     public:
       InsertFileHashStmt(Repo& repo, int repoId) : Stmt(repo, repoId) {}
@@ -94,6 +109,16 @@ class Repo : public RepoProxy {
       GetFileHashStmt(Repo& repo, int repoId) : Stmt(repo, repoId) {}
       bool get(const char* path, MD5& md5);
   };
+  class GetFilePathsStmt : public RepoProxy::Stmt {
+    public:
+      GetFilePathsStmt(Repo& repo, int repoId) : Stmt(repo, repoId) {}
+      void get(std::vector<std::string>& paths);
+  };
+  class GetAutoloadEntriesStmt : public RepoProxy::Stmt {
+    public:
+      GetAutoloadEntriesStmt(Repo& repo, int repoId) : Stmt(repo, repoId) {}
+      void get(std::vector<AutoloadEntry>& entries);
+  };
 #define RP_OP(c, o) \
  public: \
   c##Stmt& o(int repoId) { return *m_##o[repoId]; } \
@@ -114,6 +139,10 @@ class Repo : public RepoProxy {
  public:
   void rollback(); // nothrow
   void commit();
+  // A nested transaction that failed only marks the outermost one to roll
+  // back, and callers like commitUnit() swallow the error; this tells the
+  // owner of the outermost transaction that it will not commit.
+  bool rollbackPending() const { return m_rollback; }
   void commitUnit(UnitEmitter* ue, UnitOrigin unitOrigin); // nothrow
 
   // All database table names use the schema ID (md5 checksum based on the
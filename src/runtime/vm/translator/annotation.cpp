@@ -193,5 +193,18 @@ fcallToFuncName(const NormalizedInstruction* i) {
   return NULL;
 }
 
+/*
+ * The Func an already-annotated FCall is known to call, or NULL if its
+ * callee isn't bound.
+ */
+const Func*
+fcallToFunc(const SrcKey& fcall) {
+  CallRecord callRec;
+  if (mapGet(s_callDB, fcall, &callRec) && callRec.m_type == Function) {
+    return callRec.m_func;
+  }
+  return NULL;
+}
+
 } } }
 
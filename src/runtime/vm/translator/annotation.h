@@ -29,6 +29,7 @@ namespace Transl {
 void annotate(NormalizedInstruction* instr);
 const StringData* encodeCallAndArgs(const StringData *name, int numArgs);
 const StringData* fcallToFuncName(const NormalizedInstruction* fcall);
+const Func* fcallToFunc(const SrcKey& fcall);
 int getMaxEncodedArgs();
 
 } } }
@@ -58,6 +58,7 @@ typedef __sighandler_t *sighandler_t;
 #include "runtime/base/zend/zend_string.h"
 #include "runtime/base/runtime_option.h"
 #include "runtime/base/server/source_root_info.h"
+#include "runtime/base/server/request_trace.h"
 #include "runtime/ext/ext_continuation.h"
 #include "runtime/vm/debug/debug.h"
 #include "runtime/vm/translator/targetcache.h"
@@ -1354,7 +1355,7 @@ TranslatorX64::createTranslation(const SrcKey* sk, bool align,
   ASSERT(asize == 0);
   if (stubsize) {
     addTranslation(TransRec(*sk, curUnit()->md5(), TransAnchor,
-                            astart, asize, stubstart, stubsize));
+                            astart, asize, stubstart, stubsize), curFunc());
     ASSERT(getTransRec(stubstart)->kind == TransAnchor);
   }
 
@@ -1372,6 +1373,7 @@ TranslatorX64::lookupTranslation(const SrcKey& sk) const {
 TCA
 TranslatorX64::translate(const SrcKey *sk, bool align, bool useHHIR) {
   INC_TPC(translate);
+  TraceSpan span("jit");
   ASSERT(((uintptr_t)vmsp() & (sizeof(Cell) - 1)) == 0);
   ASSERT(((uintptr_t)vmfp() & (sizeof(Cell) - 1)) == 0);
 
@@ -2090,7 +2092,8 @@ TranslatorX64::funcPrologue(Func* func, int nPassed) {
 
   addTranslation(TransRec(skFuncBody, func->unit()->md5(),
                           TransProlog, aStart, a.code.frontier - aStart,
-                          stubStart, astubs.code.frontier - stubStart));
+                          stubStart, astubs.code.frontier - stubStart),
+                 func);
 
   recordGdbTranslation(skFuncBody, func->unit(),
                        a, aStart,
@@ -3563,7 +3566,7 @@ TranslatorX64::emitServiceReq(SRFlags flags, ServiceRequest req,
 TCA
 TranslatorX64::emitTransCounterInc(X64Assembler& a) {
   TCA start = a.code.frontier;
-  if (!isTransDBEnabled()) return start;
+  if (!isTransCounterEnabled()) return start;
 
   a.    movq (getTransCounterAddr(), rScratch);
   a.    lock ();
@@ -11333,7 +11336,8 @@ TranslatorX64::translateTracelet(const Tracelet& t) {
                           a.code.frontier - start, stubStart,
                           astubs.code.frontier - stubStart,
                           counterStart, counterLen,
-                          bcMapping));
+                          bcMapping),
+                 curFunc());
 
   recordGdbTranslation(sk, curUnit(), a, start,
                        false, false);
@@ -12061,6 +12065,11 @@ bool tc_dump(void) {
   return TranslatorX64::Get()->dumpTC();
 }
 
+// Returns true on success
+bool tc_dump_func_profile(void) {
+  return TranslatorX64::Get()->dumpFuncProfile();
+}
+
 // Returns true on success
 bool TranslatorX64::dumpTCData() {
   gzFile tcDataFile = gzopen("/tmp/tc_data.txt.gz", "w");
@@ -20,14 +20,18 @@
 #include <assert.h>
 #include <stdint.h>
 #include <stdarg.h>
+#include <unistd.h>
 
 #include <vector>
 #include <string>
+#include <fstream>
+#include <algorithm>
 
 #include <runtime/base/runtime_option.h>
 #include <runtime/base/types.h>
 #include <runtime/ext/ext_continuation.h>
 #include <util/trace.h>
+#include <util/logger.h>
 #include <util/biased_coin.h>
 #include <runtime/vm/hhbc.h>
 #include <runtime/vm/bytecode.h>
@@ -2170,6 +2174,23 @@ void Translator::getOutputs(/*inout*/ Tracelet& t,
           } else {
             t.m_arState.pushDynFunc();
           }
+        } else if (op == OpFPushObjMethodD &&
+                   ni->inputs[0]->valueType() == KindOfObject) {
+          // With a receiver class from the rtt (or from the emitter's
+          // MetaInfo::Class annotation), translateFPushObjMethodD binds
+          // the same immutable method we find here, so the FPass*
+          // instructions that follow can see its reffiness instead of
+          // ending the tracelet.
+          bool magicCall = false;
+          const Func* f =
+            lookupImmutableMethod(ni->inputs[0]->rtt.valueClass(),
+                                  ni->unit()->lookupLitstrId(ni->imm[1].u_SA),
+                                  magicCall, false /* staticLookup */);
+          if (f && !magicCall) {
+            t.m_arState.pushFuncD(f);
+          } else {
+            t.m_arState.pushDynFunc();
+          }
         } else {
           // Non-deterministic in some way
           t.m_arState.pushDynFunc();
@@ -2929,6 +2950,43 @@ static bool checkTaintFuncs(StringData* name) {
             name->isame(s_hphp_unpack_continuation);
 }
 
+/*
+ * If sk is the return point of an FCall whose callee the annotations
+ * bound, the type the emitter inferred for everything that callee
+ * returns (see Func::returnType); otherwise KindOfInvalid.
+ *
+ * An fb_intercept handler can return anything in place of the callee, and
+ * the unguarded translation would outlive the intercept, so nothing that
+ * can be intercepted is trusted: with JitEnableRenameFunction any function
+ * can be, and otherwise only AttrDynamicInvoke ones get intercept
+ * prologues.
+ */
+static DataType callReturnType(const SrcKey& sk) {
+  if (!RuntimeOption::RepoAuthoritative ||
+      RuntimeOption::EvalJitEnableRenameFunction ||
+      Func::interceptsEnabled()) {
+    return KindOfInvalid;
+  }
+  const Func* func = curFunc();
+  const Func::FPIEntVec& fpitab = func->fpitab();
+  for (unsigned i = 0; i < fpitab.size(); i++) {
+    Offset fcallOff = fpitab[i].m_fcallOff;
+    if (fcallOff + instrLen(func->unit()->at(fcallOff)) != sk.offset()) {
+      continue;
+    }
+    SrcKey fcall = sk;
+    fcall.m_offset = fcallOff;
+    const Func* callee = fcallToFunc(fcall);
+    if (!callee || callee->isBuiltin() ||
+        (callee->attrs() & AttrDynamicInvoke) ||
+        callee->maybeIntercepted()) {
+      return KindOfInvalid;
+    }
+    return callee->returnType();
+  }
+  return KindOfInvalid;
+}
+
 /*
  * analyze --
  *
@@ -2986,6 +3044,7 @@ void Translator::analyze(const SrcKey *csk, Tracelet& t) {
 
   SrcKey sk = *csk; // copy for local use
   const Unit *unit = curUnit();
+  DataType retType = callReturnType(sk);
   for (;; sk.advance(unit)) {
   head:
     NormalizedInstruction* ni = t.newNormalizedInstruction();
@@ -3025,6 +3084,26 @@ void Translator::analyze(const SrcKey *csk, Tracelet& t) {
       preInputApplyMetaData(metaHand, ni);
       InputInfos inputInfos;
       getInputs(t, ni, stackFrameOffset, inputInfos, tas);
+      if (retType != KindOfInvalid) {
+        // The first read of the top of the stack is the callee's return
+        // value; type it from the callee rather than guarding, unless
+        // what's actually there disagrees.
+        for (unsigned i = 0; i < inputInfos.size(); i++) {
+          InputInfo& ii = inputInfos[i];
+          if (!(ii.loc == Location(Location::Stack, -1))) continue;
+          RuntimeType live = liveType(ii.loc, *unit);
+          if (live.outerType() == retType ||
+              (live.isString() && retType == KindOfString)) {
+            SKTRACE(1, sk, "callee returns type %d; not guarding input %d\n",
+                    retType, i);
+            ii.dontGuard = true;
+            DynLocation* dl = tas.recordRead(ii, m_useHHIR, retType);
+            dl->rtt = RuntimeType(retType);
+          }
+          break;
+        }
+        retType = KindOfInvalid;
+      }
       bool noOp = applyInputMetaData(metaHand, ni, tas, inputInfos);
       if (noOp) {
         if (m_useHHIR) {
@@ -3347,9 +3426,9 @@ Translator::addDbgBLPC(PC pc) {
 }
 
 uint64* Translator::getTransCounterAddr() {
-  if (!isTransDBEnabled()) return NULL;
+  if (!isTransCounterEnabled()) return NULL;
 
-  TransID id = m_translations.size();
+  TransID id = getCurrentCounterID();
 
   // allocate a new chunk of counters if necessary
   if (id >= m_transCounters.size() * transCountersPerChunk) {
@@ -3365,8 +3444,8 @@ uint64* Translator::getTransCounterAddr() {
 
 
 uint64 Translator::getTransCounter(TransID transId) const {
-  if (!isTransDBEnabled()) return -1ul;
-  ASSERT(transId < m_translations.size());
+  if (!isTransCounterEnabled()) return -1ul;
+  ASSERT(transId < getCurrentCounterID());
 
   uint64 counter;
 
@@ -3380,13 +3459,80 @@ uint64 Translator::getTransCounter(TransID transId) const {
 }
 
 void Translator::setTransCounter(TransID transId, uint64 value) {
-  ASSERT(transId < m_translations.size());
+  ASSERT(transId < getCurrentCounterID());
   ASSERT(transId / transCountersPerChunk < m_transCounters.size());
 
   m_transCounters[transId / transCountersPerChunk]
                  [transId % transCountersPerChunk] = value;
 }
 
+void Translator::recordTransFunc(const Func* func) {
+  if (m_transFuncs.find(func->getFuncId()) != m_transFuncs.end()) return;
+  m_transFuncs[func->getFuncId()] =
+    std::make_pair(func->fullName(),
+                   StringData::GetStaticString(func->unit()->filepath()));
+}
+
+namespace {
+struct FuncProfileEntry {
+  uint64 calls;
+  uint64 work;
+  const StringData* name;
+  const StringData* file;
+
+  bool operator<(const FuncProfileEntry& o) const {
+    return work > o.work;
+  }
+};
+}
+
+bool Translator::dumpFuncProfile() {
+  const std::string& path = RuntimeOption::EvalJitFuncProfile;
+  if (path.empty() || !RuntimeOption::EvalJitTransCounters) return false;
+  if (!s_writeLease.acquire(true)) return false;
+
+  hphp_hash_map<Func::FuncId, FuncProfileEntry> funcs;
+  for (size_t t = 0; t < m_transFuncRecs.size(); t++) {
+    const TransFuncRec& rec = m_transFuncRecs[t];
+    uint64 count = getTransCounter(t);
+    if (!count) continue;
+    TransFuncMap::const_iterator it = m_transFuncs.find(rec.funcId);
+    if (it == m_transFuncs.end()) continue;
+    FuncProfileEntry& e = funcs[rec.funcId];
+    e.name = it->second.first;
+    e.file = it->second.second;
+    e.work += count;
+    if (rec.prolog) e.calls += count;
+  }
+  s_writeLease.drop();
+
+  std::vector<FuncProfileEntry> entries;
+  entries.reserve(funcs.size());
+  for (hphp_hash_map<Func::FuncId, FuncProfileEntry>::const_iterator it =
+         funcs.begin(); it != funcs.end(); ++it) {
+    entries.push_back(it->second);
+  }
+  std::sort(entries.begin(), entries.end());
+
+  std::string tmp = path + ".tmp";
+  std::ofstream out(tmp.c_str(), std::ios::trunc);
+  out << "# calls\twork\tfunction\tfile\n";
+  for (size_t i = 0; i < entries.size(); i++) {
+    const FuncProfileEntry& e = entries[i];
+    out << e.calls << '\t' << e.work << '\t' << e.name->data() << '\t'
+        << e.file->data() << '\n';
+  }
+  out.close();
+  if (!out || rename(tmp.c_str(), path.c_str())) {
+    Logger::Error("Unable to write the function profile to %s", path.c_str());
+    unlink(tmp.c_str());
+    return false;
+  }
+  Logger::Info("Wrote the profile of %lu functions to %s",
+               entries.size(), path.c_str());
+  return true;
+}
+
 static const char *transKindStr[] = {
   "Normal_Tx64",
   "Normal_HHIR",
@@ -3567,12 +3713,18 @@ const Func* lookupImmutableMethod(const Class* cls, const StringData* name,
       func = NULL;
     }
   } else if (!(func->attrs() & AttrPrivate)) {
+    // A final class has no subclasses, and a final method can't be
+    // redefined by one, so neither needs the WholeProgram-only
+    // AttrNoOverride to be bound here.
+    bool clsNoOverride =
+      cls->preClass()->attrs() & (AttrNoOverride | AttrFinal);
     if (magicCall || func->attrs() & AttrStatic) {
-      if (!(cls->preClass()->attrs() & AttrNoOverride)) {
+      if (!clsNoOverride) {
         func = NULL;
       }
-    } else if (!(func->attrs() & AttrNoOverride && !func->hasStaticLocals()) &&
-               !(cls->preClass()->attrs() & AttrNoOverride)) {
+    } else if (!(func->attrs() & (AttrNoOverride | AttrFinal) &&
+                 !func->hasStaticLocals()) &&
+               !clsNoOverride) {
       func = NULL;
     }
   }
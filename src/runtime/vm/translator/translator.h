@@ -847,6 +847,24 @@ protected:
   vector<TransRec>   m_translations;
   vector<uint64*>    m_transCounters;
 
+  // Full name and file of each function with translations, by FuncId, so
+  // dumpFuncProfile() can report counters without a live Func.
+  typedef hphp_hash_map<Func::FuncId,
+                        std::pair<const StringData*, const StringData*> >
+    TransFuncMap;
+  TransFuncMap       m_transFuncs;
+
+  // The function and kind of each translation, indexed like the counters.
+  // This is all dumpFuncProfile() needs, so JitFuncProfile does not have
+  // to keep the full TransRec database.
+  struct TransFuncRec {
+    Func::FuncId funcId;
+    bool         prolog;
+  };
+  vector<TransFuncRec> m_transFuncRecs;
+
+  void recordTransFunc(const Func* func);
+
   // For HHIR-based translation
   bool               m_useHHIR;
 
@@ -927,13 +945,19 @@ public:
     return m_translations.size();
   }
 
+  // Id of the next counter slot: translations are numbered by the TransRec
+  // database when it is on, and by m_transFuncRecs otherwise.
+  TransID getCurrentCounterID() const {
+    return isTransDBEnabled() ? m_translations.size() : m_transFuncRecs.size();
+  }
+
   uint64* getTransCounterAddr();
 
   uint64 getTransCounter(TransID transId) const;
 
   void setTransCounter(TransID transId, uint64 value);
 
-  uint32 addTranslation(const TransRec& transRec) {
+  uint32 addTranslation(const TransRec& transRec, const Func* func) {
     if (Trace::moduleEnabledRelease(Trace::trans, 1)) {
       // Log the translation's size, creation time, SrcKey, and size
       Trace::traceRelease("New translation: %lld %s %u %u %d\n",
@@ -942,6 +966,12 @@ public:
                           transRec.astubsLen, transRec.kind);
     }
 
+    if (isFuncProfileEnabled()) {
+      TransFuncRec rec = { func->getFuncId(), transRec.kind == TransProlog };
+      m_transFuncRecs.push_back(rec);
+      recordTransFunc(func);
+    }
+
     if (!isTransDBEnabled()) return -1u;
     uint32 id = getCurrentTransID();
     m_translations.push_back(transRec);
@@ -982,6 +1012,25 @@ public:
     return debug || RuntimeOption::EvalDumpTC;
   }
 
+  inline bool isFuncProfileEnabled() const {
+    return !RuntimeOption::EvalJitFuncProfile.empty();
+  }
+
+  inline bool isTransCounterEnabled() const {
+    return isTransDBEnabled() || isFuncProfileEnabled();
+  }
+
+  /*
+   * Writes the translation counters summed per function to
+   * Eval.JitFuncProfile, one line per function, hottest first:
+   *
+   *   calls <TAB> work <TAB> function <TAB> file
+   *
+   * calls counts prologue entries and work counts every translation of
+   * the function that ran.  hphp reads this with -v FuncProfile=<file>.
+   */
+  bool dumpFuncProfile();
+
   /*
    * If this returns true, we dont generate guards for any of the
    * inputs to this instruction (this is essentially to avoid
@@ -1087,6 +1136,7 @@ opcodeBreaksBB(const Opcode instr) {
 bool outputDependsOnInput(const Opcode instr);
 
 extern bool tc_dump();
+extern bool tc_dump_func_profile();
 const Func* lookupImmutableMethod(const Class* cls, const StringData* name,
                                   bool& magicCall, bool staticLookup);
 
@@ -702,6 +702,40 @@ void Unit::merge() {
   }
 }
 
+/*
+ * Startup preloading (Repo.Preload): does the process-wide part of
+ * merging without running any of the unit's pseudo-main effects.  Binds
+ * the persistent hoistable functions and defines the hoistable classes,
+ * which creates their Class objects and, for persistent ones, binds them
+ * for every request.  Returns false if some class couldn't be defined
+ * yet because a parent or interface isn't; calling again once more units
+ * are preloaded may succeed.
+ */
+bool Unit::preload() {
+  if (UNLIKELY(!(m_mergeState & UnitMergeStateMerged))) {
+    SimpleLock lock(unitInitLock);
+    initialMerge();
+  }
+
+  void* tcbase = TargetCache::handleToPtr(0);
+  UnitMergeInfo* mi = m_mergeInfo;
+  for (Func** it = mi->funcHoistableBegin(); it != mi->funcEnd(); ++it) {
+    Func* func = *it;
+    if (TargetCache::isPersistentHandle(func->getCachedOffset())) {
+      getDataRef<Func*>(tcbase, func->getCachedOffset()) = func;
+    }
+  }
+
+  bool done = true;
+  for (int ix = mi->m_firstHoistablePreClass;
+       ix < (int)mi->m_firstMergeablePreClass; ++ix) {
+    void* obj = mi->mergeableObj(ix);
+    if (uintptr_t(obj) & 1) continue; // already unique and defined
+    if (!defClass((PreClass*)obj, false)) done = false;
+  }
+  return done;
+}
+
 void* Unit::replaceUnit() const {
   if (m_mergeState & UnitMergeStateEmpty) return NULL;
   if (isMergeOnly() &&
@@ -1465,6 +1499,22 @@ Unit* UnitRepoProxy::load(const std::string& name, const MD5& md5) {
              name.c_str(), md5.q[0], md5.q[1]);
     return NULL;
   }
+  if (!loadRest(ue, repoId)) {
+    return NULL;
+  }
+  return ue.create();
+}
+
+bool UnitRepoProxy::loadEmitter(UnitEmitter& ue, int repoId) {
+  if (getUnit(repoId).get(ue, ue.md5())) {
+    return false;
+  }
+  return loadRest(ue, repoId);
+}
+
+bool UnitRepoProxy::loadRest(UnitEmitter& ue, int repoId) {
+  const char* name = ue.getFilepath()->data();
+  const MD5& md5 = ue.md5();
   try {
     getUnitLitstrs(repoId).get(ue);
     getUnitArrays(repoId).get(ue);
@@ -1474,13 +1524,13 @@ Unit* UnitRepoProxy::load(const std::string& name, const MD5& md5) {
     m_repo.frp().getFuncs(repoId).get(ue);
   } catch (RepoExc& re) {
     TRACE(0, "Repo error loading '%s' (0x%016llx%016llx) from '%s': %s\n",
-             name.c_str(), md5.q[0], md5.q[1], m_repo.repoName(repoId).c_str(),
+             name, md5.q[0], md5.q[1], m_repo.repoName(repoId).c_str(),
              re.msg().c_str());
-    return NULL;
+    return false;
   }
   TRACE(3, "Repo loaded '%s' (0x%016llx%016llx) from '%s'\n",
-           name.c_str(), md5.q[0], md5.q[1], m_repo.repoName(repoId).c_str());
-  return ue.create();
+           name, md5.q[0], md5.q[1], m_repo.repoName(repoId).c_str());
+  return true;
 }
 
 void UnitRepoProxy::InsertUnitStmt
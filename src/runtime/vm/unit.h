@@ -582,6 +582,7 @@ public:
   typedef Range<PreClassPtrVec> PreClassRange;
   void initialMerge();
   void merge();
+  bool preload();
   PreClassRange preclasses() const {
     return PreClassRange(m_preClasses);
   }
@@ -649,6 +650,7 @@ private:
 
 class UnitEmitter {
   friend class UnitRepoProxy;
+  friend class FlatRepo;
   friend class ::HPHP::Compiler::Peephole;
  public:
   UnitEmitter(const MD5& md5);
@@ -659,6 +661,7 @@ class UnitEmitter {
   int64 sn() const { return m_sn; }
   void setSn(int64 sn) { m_sn = sn; }
   Offset bcPos() const { return (Offset)m_bclen; }
+  const uchar* bc() const { return m_bc; }
   void setBc(const uchar* bc, size_t bclen);
   void setBcMeta(const uchar* bc_meta, size_t bc_meta_len);
   const StringData* getFilepath() { return m_filepath; }
@@ -822,6 +825,11 @@ class UnitRepoProxy : public RepoProxy {
   ~UnitRepoProxy();
   void createSchema(int repoId, RepoTxn& txn);
   Unit* load(const std::string& name, const MD5& md5);
+  /*
+   * Fill in ue, which must have its md5 and filepath set, from the unit
+   * with that md5 in repoId.  Returns false if there is no such unit.
+   */
+  bool loadEmitter(UnitEmitter& ue, int repoId);
 
 #define URP_IOP(o) URP_OP(Insert##o, insert##o)
 #define URP_GOP(o) URP_OP(Get##o, get##o)
@@ -940,6 +948,8 @@ class UnitRepoProxy : public RepoProxy {
   c##Stmt* m_##o[RepoIdCount];
   URP_OPS
 #undef URP_OP
+
+  bool loadRest(UnitEmitter& ue, int repoId);
 };
 
 /**
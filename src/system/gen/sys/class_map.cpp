@@ -9234,6 +9234,13 @@ const char* g_system_class_map[] = {
   NULL,
   NULL,
   NULL,
+  (const char *)0x10016040, "curl_multi_await", "", (const char *)0, (const char *)0,
+  "/**\n * ( HipHop specific )\n *\n * Runs the transfers of a cURL multi handle until at least one of them\n * finishes, sleeping on the connections' sockets in between instead of\n * polling. Unlike curl_multi_select(), there is no limit on how many\n * connections it can wait on. Read the finished transfers with\n * curl_multi_info_read().\n *\n * @mh         resource\n *                     A cURL multi handle returned by curl_multi_init().\n * @timeout    float   Time, in seconds, to wait for a transfer to finish.\n *\n * @return     int     The number of finished transfers\n *                     curl_multi_info_read() will return, 0 when the\n *                     timeout passed or nothing is running, or -1 on\n *                     failure.\n */",
+  (const char *)0xa, (const char *)0x2000, "mh", "", (const char *)0x40, "", "", NULL,
+  (const char *)0x2000, "timeout", "", (const char *)0xb, "d:1;", "1.0", NULL,
+  NULL,
+  NULL,
+  NULL,
   (const char *)0x10016040, "mysql_fetch_result", "", (const char *)0, (const char *)0,
   "/**\n * ( HipHop specific )\n *\n * Used with mysql_multi_query() to return a mysql result for the current\n * iterated query.\n *\n * @link_identifier\n *             mixed   The MySQL connection. If the link identifier is not\n *                     specified, the last link opened by mysql_connect()\n *                     is assumed. If no such link is found, it will try to\n *                     create one as if mysql_connect() was called with no\n *                     arguments. If no connection is found or established,\n *                     an E_WARNING level error is generated.\n *\n * @return     mixed   Returns a resource or a boolean.\n */",
   (const char *)0xffffffff, (const char *)0x2000, "link_identifier", "", (const char *)0xffffffff, "N;", "null", NULL,
@@ -9922,6 +9929,19 @@ const char* g_system_class_map[] = {
   NULL,
   NULL,
   NULL,
+  (const char *)0x10016040, "pagelet_server_task_start_batch", "", (const char *)0, (const char *)0,
+  "/**\n * ( HipHop specific )\n *\n * Processes a batch of pagelet server requests. Requests are grouped into\n * worker jobs of up to PageletServer.BatchSize requests each, so a page\n * that fans out into many small pagelets doesn't pay for a separate job\n * per pagelet.\n *\n * @requests   map     Each element is an array with \"url\", \"headers\",\n *                     \"post_data\" and \"files\" entries, with the same\n *                     meaning as the parameters of\n *                     pagelet_server_task_start().\n *\n * @return     map     Task handles keyed the same way as requests, each of\n *                     which can be used with pagelet_server_task_status(),\n *                     pagelet_server_task_result() or\n *                     pagelet_server_task_select(). An empty array is\n *                     returned if pagelet server is not enabled or its\n *                     queue is full.\n */",
+  (const char *)0x20, (const char *)0x2000, "requests", "", (const char *)0x20, "", "", NULL,
+  NULL,
+  NULL,
+  NULL,
+  (const char *)0x10016040, "pagelet_server_task_select", "", (const char *)0, (const char *)0,
+  "/**\n * ( HipHop specific )\n *\n * Block and wait until at least one of the pagelet tasks has (partial)\n * data available or is done, or until timeout.\n *\n * @tasks      map     Pagelet task handles returned from\n *                     pagelet_server_task_start() or\n *                     pagelet_server_task_start_batch().\n * @timeout_ms int     How many milliseconds to wait. A timeout of zero is\n *                     interpreted as an infinite timeout.\n *\n * @return     vector  Keys of the tasks that are ready to be read with\n *                     pagelet_server_task_result(). An empty array is\n *                     returned on timeout.\n */",
+  (const char *)0x20, (const char *)0x2000, "tasks", "", (const char *)0x20, "", "", NULL,
+  (const char *)0x2000, "timeout_ms", "", (const char *)0xa, "i:0;", "0", NULL,
+  NULL,
+  NULL,
+  NULL,
   (const char *)0x10106040, "strrpos", "", (const char *)0, (const char *)0,
   "/**\n * ( excerpt from http://php.net/manual/en/function.strrpos.php )\n *\n * Returns the numeric position of the last occurrence of needle in the\n * haystack string. Note that the needle in this case can only be a single\n * character in PHP 4. If a string is passed as the needle, then only the\n * first character of that string will be used.\n *\n * @haystack   string  The string to search in.\n * @needle     mixed   If needle is not a string, it is converted to an\n *                     integer and applied as the ordinal value of a\n *                     character.\n * @offset     int     May be specified to begin searching an arbitrary\n *                     number of characters into the string. Negative\n *                     values will stop searching at an arbitrary point\n *                     prior to the end of the string.\n *\n * @return     mixed   Returns the position where the needle exists.\n *                     Returns FALSE if the needle was not found.\n */",
   (const char *)0xffffffff, (const char *)0x2000, "haystack", "", (const char *)0x14, "", "", NULL,
@@ -12714,6 +12734,13 @@ const char* g_system_class_map[] = {
   NULL,
   NULL,
   NULL,
+  (const char *)0x10016040, "memcache_defer_get", "", (const char *)0, (const char *)0,
+  "/**\n * ( HipHop specific )\n *\n * Queues a key, or an array of keys, to be fetched later. Nothing is sent\n * until the next Memcache::get() on the same connection, which fetches its\n * own keys together with everything queued in one multiget, so a page can\n * declare the keys it needs as it goes and pay for one round trip. Values\n * fetched this way are kept for the rest of the request, or until a write\n * through the same connection touches them.\n *\n * @memcache   object  The Memcache connection.\n * @key        mixed   The key or array of keys to queue.\n *\n * @return     bool    TRUE if at least one key was queued, FALSE if all\n *                     keys were empty.\n */",
+  (const char *)0x9, (const char *)0x2000, "memcache", "", (const char *)0x40, "", "", NULL,
+  (const char *)0x2000, "key", "", (const char *)0xffffffff, "", "", NULL,
+  NULL,
+  NULL,
+  NULL,
   (const char *)0x10016040, "fb_const_fetch", "", (const char *)0, (const char *)0,
   "/**\n * ( HipHop specific )\n *\n * Fetches a constant string from a special store that's compiled into the\n * executable. This is faster than apc_fetch(), which needs locking between\n * different threads. This store is immutable and loaded once with strings\n * that are never changed. Therefore, no locking is needed when accessed by\n * different threads.\n *\n * @key        mixed   The key for locating the value.\n *\n * @return     mixed   The value that was stored.\n */",
   (const char *)0xffffffff, (const char *)0x2000, "key", "", (const char *)0xffffffff, "", "", NULL,
@@ -14605,6 +14632,13 @@ const char* g_system_class_map[] = {
   NULL,
   NULL,
   NULL,
+  (const char *)0x10016040, "json_encode_to_output", "", (const char *)0, (const char *)0,
+  "/**\n * ( HipHop specific )\n *\n * Writes the JSON representation of value to the output, like echo\n * json_encode(value) but without building the whole document in memory\n * first: it is written out in chunks as it is encoded. There is no size\n * limit, as if JSON_FB_UNLIMITED were given.\n *\n * @value      mixed   The value being encoded. Can be any type except a\n *                     resource.\n * @options    mixed   Same options as json_encode().\n *\n * @return     mixed\n */",
+  (const char *)-1, (const char *)0x2000, "value", "", (const char *)0xffffffff, "", "", NULL,
+  (const char *)0x2000, "options", "", (const char *)0xffffffff, "i:0;", "0", NULL,
+  NULL,
+  NULL,
+  NULL,
   (const char *)0x10006040, "gzread", "", (const char *)0, (const char *)0,
   "/**\n * ( excerpt from http://php.net/manual/en/function.gzread.php )\n *\n * gzread() reads up to length bytes from the given gz-file pointer.\n * Reading stops when length (uncompressed) bytes have been read or EOF is\n * reached, whichever comes first.\n *\n * @zp         resource\n *                     The gz-file pointer. It must be valid, and must\n *                     point to a file successfully opened by gzopen().\n * @length     int     The number of bytes to read.\n *\n * @return     mixed   The data that have been read.\n */",
   (const char *)0xffffffff, (const char *)0x2000, "zp", "", (const char *)0x40, "", "", NULL,
@@ -14965,6 +14999,27 @@ const char* g_system_class_map[] = {
   NULL,
   NULL,
   NULL,
+  (const char *)0x10016040, "mysql_async_query", "", (const char *)0, (const char *)0,
+  "/**\n * ( HipHop specific )\n *\n * Sends a query without waiting for its result, so that queries on several\n * connections can run at the same time. Only one query can be outstanding\n * per connection. Collect the result with mysql_async_result(), after\n * mysql_async_wait() reports the connection ready.\n *\n * @query      string  The SQL query to send.\n * @link_identifier\n *             mixed   The MySQL connection. If the link identifier is not\n *                     specified, the last link opened by mysql_connect()\n *                     is assumed.\n *\n * @return     bool    TRUE if the query was sent, FALSE otherwise.\n */",
+  (const char *)0x9, (const char *)0x2000, "query", "", (const char *)0x14, "", "", NULL,
+  (const char *)0x2000, "link_identifier", "", (const char *)0xffffffff, "N;", "null", NULL,
+  NULL,
+  NULL,
+  NULL,
+  (const char *)0x10016040, "mysql_async_wait", "", (const char *)0, (const char *)0,
+  "/**\n * ( HipHop specific )\n *\n * Waits until at least one of the given connections has the result of its\n * mysql_async_query() ready to read.\n *\n * @links      map     MySQL connections with a query outstanding.\n *                     Connections without one are ignored.\n * @timeout_ms int     How long to wait, in milliseconds. A negative value\n *                     waits for as long as the read timeout of\n *                     mysql_set_timeout().\n *\n * @return     mixed   Keys of the connections in links that are ready,\n *                     which is empty when the timeout expired, or FALSE on\n *                     error.\n */",
+  (const char *)0xffffffff, (const char *)0x2000, "links", "", (const char *)0x20, "", "", NULL,
+  (const char *)0x2000, "timeout_ms", "", (const char *)0xa, "i:-1;", "-1", NULL,
+  NULL,
+  NULL,
+  NULL,
+  (const char *)0x10016040, "mysql_async_result", "", (const char *)0, (const char *)0,
+  "/**\n * ( HipHop specific )\n *\n * Reads the result of the query sent by mysql_async_query() on a\n * connection. This blocks until the query completes, unless\n * mysql_async_wait() has reported the connection ready.\n *\n * @link_identifier\n *             mixed   The MySQL connection. If the link identifier is not\n *                     specified, the last link opened by mysql_connect()\n *                     is assumed.\n * @buffered   bool    Whether to read all rows now like mysql_query().\n *                     When FALSE, rows are read from the connection as\n *                     they are fetched, like mysql_unbuffered_query().\n *\n * @return     mixed   The same as mysql_query() or\n *                     mysql_unbuffered_query() would have returned for the\n *                     query.\n */",
+  (const char *)0xffffffff, (const char *)0x2000, "link_identifier", "", (const char *)0xffffffff, "N;", "null", NULL,
+  (const char *)0x2000, "buffered", "", (const char *)0x9, "b:1;", "true", NULL,
+  NULL,
+  NULL,
+  NULL,
   (const char *)0x10006040, "drawsetstrokepatternurl", "", (const char *)0, (const char *)0,
   "/**\n * ( excerpt from\n * http://php.net/manual/en/function.drawsetstrokepatternurl.php )\n *\n *\n * @drw_wnd    resource\n *\n * @stroke_url string\n *\n * @return     bool\n */",
   (const char *)0x9, (const char *)0x2000, "drw_wnd", "", (const char *)0x40, "", "", NULL,
@@ -13038,6 +13038,16 @@ Variant ifa_curl_multi_select(void *extra, int count, INVOKE_FEW_ARGS_IMPL_ARGS)
 Variant i_curl_multi_select(void *extra, CArrRef params) {
   return invoke_func_few_handler(extra, params, &ifa_curl_multi_select);
 }
+Variant ifa_curl_multi_await(void *extra, int count, INVOKE_FEW_ARGS_IMPL_ARGS) {
+  if (UNLIKELY(count < 1 || count > 2)) return throw_wrong_arguments("curl_multi_await", count, 1, 2, 1);
+  CVarRef arg0(a0);
+  if (count <= 1) return (x_curl_multi_await(arg0));
+  CVarRef arg1(a1);
+  return (x_curl_multi_await(arg0, arg1));
+}
+Variant i_curl_multi_await(void *extra, CArrRef params) {
+  return invoke_func_few_handler(extra, params, &ifa_curl_multi_await);
+}
 Variant ifa_mysql_fetch_result(void *extra, int count, INVOKE_FEW_ARGS_IMPL_ARGS) {
   if (UNLIKELY(count > 1)) return throw_toomany_arguments("mysql_fetch_result", 1, 1);
   if (count <= 0) return (x_mysql_fetch_result());
@@ -14022,6 +14032,24 @@ Variant ifa_pagelet_server_task_result(void *extra, int count, INVOKE_FEW_ARGS_I
 Variant i_pagelet_server_task_result(void *extra, CArrRef params) {
   return invoke_func_few_handler(extra, params, &ifa_pagelet_server_task_result);
 }
+Variant ifa_pagelet_server_task_start_batch(void *extra, int count, INVOKE_FEW_ARGS_IMPL_ARGS) {
+  if (UNLIKELY(count != 1)) return throw_wrong_arguments("pagelet_server_task_start_batch", count, 1, 1, 1);
+  CVarRef arg0(a0);
+  return (x_pagelet_server_task_start_batch(arg0));
+}
+Variant i_pagelet_server_task_start_batch(void *extra, CArrRef params) {
+  return invoke_func_few_handler(extra, params, &ifa_pagelet_server_task_start_batch);
+}
+Variant ifa_pagelet_server_task_select(void *extra, int count, INVOKE_FEW_ARGS_IMPL_ARGS) {
+  if (UNLIKELY(count < 1 || count > 2)) return throw_wrong_arguments("pagelet_server_task_select", count, 1, 2, 1);
+  CVarRef arg0(a0);
+  if (count <= 1) return (x_pagelet_server_task_select(arg0));
+  CVarRef arg1(a1);
+  return (x_pagelet_server_task_select(arg0, arg1));
+}
+Variant i_pagelet_server_task_select(void *extra, CArrRef params) {
+  return invoke_func_few_handler(extra, params, &ifa_pagelet_server_task_select);
+}
 Variant ifa_strrpos(void *extra, int count, INVOKE_FEW_ARGS_IMPL_ARGS) {
   if (UNLIKELY(count < 2 || count > 3)) return throw_wrong_arguments("strrpos", count, 2, 3, 1);
   CVarRef arg0(a0);
@@ -17982,6 +18010,15 @@ Variant ifa_memcache_get(void *extra, int count, INVOKE_FEW_ARGS_IMPL_ARGS) {
 Variant i_memcache_get(void *extra, CArrRef params) {
   return invoke_func_few_handler(extra, params, &ifa_memcache_get);
 }
+Variant ifa_memcache_defer_get(void *extra, int count, INVOKE_FEW_ARGS_IMPL_ARGS) {
+  if (UNLIKELY(count != 2)) return throw_wrong_arguments("memcache_defer_get", count, 2, 2, 1);
+  CVarRef arg0(a0);
+  CVarRef arg1(a1);
+  return (x_memcache_defer_get(arg0, arg1));
+}
+Variant i_memcache_defer_get(void *extra, CArrRef params) {
+  return invoke_func_few_handler(extra, params, &ifa_memcache_defer_get);
+}
 Variant ifa_fb_const_fetch(void *extra, int count, INVOKE_FEW_ARGS_IMPL_ARGS) {
   if (UNLIKELY(count != 1)) return throw_wrong_arguments("fb_const_fetch", count, 1, 1, 1);
   CVarRef arg0(a0);
@@ -20669,6 +20706,16 @@ Variant ifa_json_encode(void *extra, int count, INVOKE_FEW_ARGS_IMPL_ARGS) {
 Variant i_json_encode(void *extra, CArrRef params) {
   return invoke_func_few_handler(extra, params, &ifa_json_encode);
 }
+Variant ifa_json_encode_to_output(void *extra, int count, INVOKE_FEW_ARGS_IMPL_ARGS) {
+  if (UNLIKELY(count < 1 || count > 2)) return throw_wrong_arguments("json_encode_to_output", count, 1, 2, 1);
+  CVarRef arg0(a0);
+  if (count <= 1) return (x_json_encode_to_output(arg0), null);
+  CVarRef arg1(a1);
+  return (x_json_encode_to_output(arg0, arg1), null);
+}
+Variant i_json_encode_to_output(void *extra, CArrRef params) {
+  return invoke_func_few_handler(extra, params, &ifa_json_encode_to_output);
+}
 Variant ifa_gzread(void *extra, int count, INVOKE_FEW_ARGS_IMPL_ARGS) {
   if (UNLIKELY(count < 1 || count > 2)) return throw_wrong_arguments("gzread", count, 1, 2, 1);
   CVarRef arg0(a0);
@@ -21177,6 +21224,37 @@ Variant ifa_mysql_unbuffered_query(void *extra, int count, INVOKE_FEW_ARGS_IMPL_
 Variant i_mysql_unbuffered_query(void *extra, CArrRef params) {
   return invoke_func_few_handler(extra, params, &ifa_mysql_unbuffered_query);
 }
+Variant ifa_mysql_async_query(void *extra, int count, INVOKE_FEW_ARGS_IMPL_ARGS) {
+  if (UNLIKELY(count < 1 || count > 2)) return throw_wrong_arguments("mysql_async_query", count, 1, 2, 1);
+  CVarRef arg0(a0);
+  if (count <= 1) return (x_mysql_async_query(arg0));
+  CVarRef arg1(a1);
+  return (x_mysql_async_query(arg0, arg1));
+}
+Variant i_mysql_async_query(void *extra, CArrRef params) {
+  return invoke_func_few_handler(extra, params, &ifa_mysql_async_query);
+}
+Variant ifa_mysql_async_wait(void *extra, int count, INVOKE_FEW_ARGS_IMPL_ARGS) {
+  if (UNLIKELY(count < 1 || count > 2)) return throw_wrong_arguments("mysql_async_wait", count, 1, 2, 1);
+  CVarRef arg0(a0);
+  if (count <= 1) return (x_mysql_async_wait(arg0));
+  CVarRef arg1(a1);
+  return (x_mysql_async_wait(arg0, arg1));
+}
+Variant i_mysql_async_wait(void *extra, CArrRef params) {
+  return invoke_func_few_handler(extra, params, &ifa_mysql_async_wait);
+}
+Variant ifa_mysql_async_result(void *extra, int count, INVOKE_FEW_ARGS_IMPL_ARGS) {
+  if (UNLIKELY(count > 2)) return throw_toomany_arguments("mysql_async_result", 2, 1);
+  if (count <= 0) return (x_mysql_async_result());
+  CVarRef arg0(a0);
+  if (count <= 1) return (x_mysql_async_result(arg0));
+  CVarRef arg1(a1);
+  return (x_mysql_async_result(arg0, arg1));
+}
+Variant i_mysql_async_result(void *extra, CArrRef params) {
+  return invoke_func_few_handler(extra, params, &ifa_mysql_async_result);
+}
 Variant ifa_drawsetstrokepatternurl(void *extra, int count, INVOKE_FEW_ARGS_IMPL_ARGS) {
   if (UNLIKELY(count != 2)) return throw_wrong_arguments("drawsetstrokepatternurl", count, 2, 2, 1);
   CVarRef arg0(a0);
@@ -23137,6 +23215,7 @@ extern const CallInfo ci_hphp_splfileobject_rewind = {(void*)&i_hphp_splfileobje
 extern const CallInfo ci_drawgetstrokeantialias = {(void*)&i_drawgetstrokeantialias, (void*)&ifa_drawgetstrokeantialias, 1, 0, 0x0000000000000000LL};
 extern const CallInfo ci_mysql_data_seek = {(void*)&i_mysql_data_seek, (void*)&ifa_mysql_data_seek, 2, 0, 0x0000000000000000LL};
 extern const CallInfo ci_curl_multi_select = {(void*)&i_curl_multi_select, (void*)&ifa_curl_multi_select, 2, 0, 0x0000000000000000LL};
+extern const CallInfo ci_curl_multi_await = {(void*)&i_curl_multi_await, (void*)&ifa_curl_multi_await, 2, 0, 0x0000000000000000LL};
 extern const CallInfo ci_mysql_fetch_result = {(void*)&i_mysql_fetch_result, (void*)&ifa_mysql_fetch_result, 1, 0, 0x0000000000000000LL};
 extern const CallInfo ci_posix_getrlimit = {(void*)&i_posix_getrlimit, (void*)&ifa_posix_getrlimit, 0, 0, 0x0000000000000000LL};
 extern const CallInfo ci_magickgetresourcelimit = {(void*)&i_magickgetresourcelimit, (void*)&ifa_magickgetresourcelimit, 1, 0, 0x0000000000000000LL};
@@ -23232,6 +23311,8 @@ extern const CallInfo ci_mb_decode_mimeheader = {(void*)&i_mb_decode_mimeheader,
 extern const CallInfo ci_memcache_close = {(void*)&i_memcache_close, (void*)&ifa_memcache_close, 1, 0, 0x0000000000000000LL};
 extern const CallInfo ci_magickposterizeimage = {(void*)&i_magickposterizeimage, (void*)&ifa_magickposterizeimage, 3, 0, 0x0000000000000000LL};
 extern const CallInfo ci_pagelet_server_task_result = {(void*)&i_pagelet_server_task_result, (void*)&ifa_pagelet_server_task_result, 4, 0, 0x0000000000000006LL};
+extern const CallInfo ci_pagelet_server_task_start_batch = {(void*)&i_pagelet_server_task_start_batch, (void*)&ifa_pagelet_server_task_start_batch, 1, 0, 0x0000000000000000LL};
+extern const CallInfo ci_pagelet_server_task_select = {(void*)&i_pagelet_server_task_select, (void*)&ifa_pagelet_server_task_select, 2, 0, 0x0000000000000000LL};
 extern const CallInfo ci_strrpos = {(void*)&i_strrpos, (void*)&ifa_strrpos, 3, 0, 0x0000000000000000LL};
 extern const CallInfo ci_imap_deletemailbox = {(void*)&i_imap_deletemailbox, (void*)&ifa_imap_deletemailbox, 2, 0, 0x0000000000000000LL};
 extern const CallInfo ci_dom_characterdata_substring_data = {(void*)&i_dom_characterdata_substring_data, (void*)&ifa_dom_characterdata_substring_data, 3, 0, 0x0000000000000000LL};
@@ -23626,6 +23707,7 @@ extern const CallInfo ci_token_name = {(void*)&i_token_name, (void*)&ifa_token_n
 extern const CallInfo ci_setrawcookie = {(void*)&i_setrawcookie, (void*)&ifa_setrawcookie, 7, 0, 0x0000000000000000LL};
 extern const CallInfo ci_imap_expunge = {(void*)&i_imap_expunge, (void*)&ifa_imap_expunge, 1, 0, 0x0000000000000000LL};
 extern const CallInfo ci_memcache_get = {(void*)&i_memcache_get, (void*)&ifa_memcache_get, 3, 0, 0x0000000000000004LL};
+extern const CallInfo ci_memcache_defer_get = {(void*)&i_memcache_defer_get, (void*)&ifa_memcache_defer_get, 2, 0, 0x0000000000000000LL};
 extern const CallInfo ci_fb_const_fetch = {(void*)&i_fb_const_fetch, (void*)&ifa_fb_const_fetch, 1, 0, 0x0000000000000000LL};
 extern const CallInfo ci_scandir = {(void*)&i_scandir, (void*)&ifa_scandir, 3, 0, 0x0000000000000000LL};
 extern const CallInfo ci_dom_element_get_attribute_ns = {(void*)&i_dom_element_get_attribute_ns, (void*)&ifa_dom_element_get_attribute_ns, 3, 0, 0x0000000000000000LL};
@@ -23896,6 +23978,7 @@ extern const CallInfo ci_drawpathmovetoabsolute = {(void*)&i_drawpathmovetoabsol
 extern const CallInfo ci_magickscaleimage = {(void*)&i_magickscaleimage, (void*)&ifa_magickscaleimage, 3, 0, 0x0000000000000000LL};
 extern const CallInfo ci_hphp_splfileobject_eof = {(void*)&i_hphp_splfileobject_eof, (void*)&ifa_hphp_splfileobject_eof, 1, 0, 0x0000000000000000LL};
 extern const CallInfo ci_json_encode = {(void*)&i_json_encode, (void*)&ifa_json_encode, 2, 0, 0x0000000000000000LL};
+extern const CallInfo ci_json_encode_to_output = {(void*)&i_json_encode_to_output, (void*)&ifa_json_encode_to_output, 2, 0, 0x0000000000000000LL};
 extern const CallInfo ci_gzread = {(void*)&i_gzread, (void*)&ifa_gzread, 2, 0, 0x0000000000000000LL};
 extern const CallInfo ci_getprotobynumber = {(void*)&i_getprotobynumber, (void*)&ifa_getprotobynumber, 1, 0, 0x0000000000000000LL};
 extern const CallInfo ci_printf = {(void*)&i_printf, (void*)&ifa_printf, 1, 1, 0x0000000000000000LL};
@@ -23949,6 +24032,9 @@ extern const CallInfo ci_mb_stripos = {(void*)&i_mb_stripos, (void*)&ifa_mb_stri
 extern const CallInfo ci_ftok = {(void*)&i_ftok, (void*)&ifa_ftok, 2, 0, 0x0000000000000000LL};
 extern const CallInfo ci_checkdate = {(void*)&i_checkdate, (void*)&ifa_checkdate, 3, 0, 0x0000000000000000LL};
 extern const CallInfo ci_mysql_unbuffered_query = {(void*)&i_mysql_unbuffered_query, (void*)&ifa_mysql_unbuffered_query, 2, 0, 0x0000000000000000LL};
+extern const CallInfo ci_mysql_async_query = {(void*)&i_mysql_async_query, (void*)&ifa_mysql_async_query, 2, 0, 0x0000000000000000LL};
+extern const CallInfo ci_mysql_async_wait = {(void*)&i_mysql_async_wait, (void*)&ifa_mysql_async_wait, 2, 0, 0x0000000000000000LL};
+extern const CallInfo ci_mysql_async_result = {(void*)&i_mysql_async_result, (void*)&ifa_mysql_async_result, 2, 0, 0x0000000000000000LL};
 extern const CallInfo ci_drawsetstrokepatternurl = {(void*)&i_drawsetstrokepatternurl, (void*)&ifa_drawsetstrokepatternurl, 2, 0, 0x0000000000000000LL};
 extern const CallInfo ci_gettype = {(void*)&i_gettype, (void*)&ifa_gettype, 1, 0, 0x0000000000000000LL};
 extern const CallInfo ci_mb_ereg_search_getregs = {(void*)&i_mb_ereg_search_getregs, (void*)&ifa_mb_ereg_search_getregs, 0, 0, 0x0000000000000000LL};
@@ -24098,6 +24184,7 @@ static const hashNodeFunc funcBuckets[] = {
  {0x70A8E0C7,0,1,"image2wbmp",&ci_image2wbmp},
  {0x5EE9C0CD,0,0,"array_udiff",&ci_array_udiff},
  {0x4F45C0CD,0,1,"magickcolorizeimage",&ci_magickcolorizeimage},
+ {0x139C80CF,0,1,"mysql_async_query",&ci_mysql_async_query},
  {0x14B140D6,0,1,"mysql_get_proto_info",&ci_mysql_get_proto_info},
  {0x77A5C0DA,0,1,"dom_element_set_attribute_ns",&ci_dom_element_set_attribute_ns},
  {0x0747A0E1,0,1,"magickaddimage",&ci_magickaddimage},
@@ -24107,7 +24194,8 @@ static const hashNodeFunc funcBuckets[] = {
  {0x4C89A0ED,0,1,"get_html_translation_table",&ci_get_html_translation_table},
  {0x44DB80EF,0,1,"magickmorphimages",&ci_magickmorphimages},
  {0x537340F4,0,1,"xml_parse",&ci_xml_parse},
- {0x36A060FE,0,1,"collator_get_attribute",&ci_collator_get_attribute},
+ {0x36A060FE,0,0,"collator_get_attribute",&ci_collator_get_attribute},
+ {0x1B22A0FE,0,1,"memcache_defer_get",&ci_memcache_defer_get},
  {0x72A360FF,0,1,"get_object_vars",&ci_get_object_vars},
  {0x312EE101,0,0,"pixelsetopacityquantum",&ci_pixelsetopacityquantum},
  {0x6A7C2101,0,1,"filesize",&ci_filesize},
@@ -24195,6 +24283,7 @@ static const hashNodeFunc funcBuckets[] = {
  {0x0F7D822F,0,1,"magickblurimage",&ci_magickblurimage},
  {0x2ACFA230,0,1,"imap_setflag_full",&ci_imap_setflag_full},
  {0x73EE023D,0,1,"openssl_private_encrypt",&ci_openssl_private_encrypt},
+ {0x0B2C0240,0,1,"mysql_async_wait",&ci_mysql_async_wait},
  {0x538E6242,0,1,"imap_check",&ci_imap_check},
  {0x7D19E24C,0,1,"pcntl_waitpid",&ci_pcntl_waitpid},
  {0x2CFA624D,0,1,"pixelgetcolorasstring",&ci_pixelgetcolorasstring},
@@ -24832,7 +24921,8 @@ static const hashNodeFunc funcBuckets[] = {
  {0x7947CB84,0,1,"session_unset",&ci_session_unset},
  {0x56222B87,0,1,"magickgetformat",&ci_magickgetformat},
  {0x0F334B8D,0,0,"destroydrawingwand",&ci_destroydrawingwand},
- {0x75888B8D,0,1,"mt_rand",&ci_mt_rand},
+ {0x75888B8D,0,0,"mt_rand",&ci_mt_rand},
+ {0x6C540B8D,0,1,"curl_multi_await",&ci_curl_multi_await},
  {0x4D562B97,0,1,"magicksetimageredprimary",&ci_magicksetimageredprimary},
  {0x42DDAB9D,0,1,"apc_bin_loadfile",&ci_apc_bin_loadfile},
  {0x39048BA3,0,1,"bcscale",&ci_bcscale},
@@ -25021,7 +25111,8 @@ static const hashNodeFunc funcBuckets[] = {
  {0x4AD90E8E,0,1,"array_flip",&ci_array_flip},
  {0x46FD4E96,0,1,"openssl_pkcs12_export",&ci_openssl_pkcs12_export},
  {0x51C26EA7,0,1,"getrusage",&ci_getrusage},
- {0x6F7B8EA9,0,1,"mailparse_msg_get_part_data",&ci_mailparse_msg_get_part_data},
+ {0x6F7B8EA9,0,0,"mailparse_msg_get_part_data",&ci_mailparse_msg_get_part_data},
+ {0x38918EA9,0,1,"pagelet_server_task_start_batch",&ci_pagelet_server_task_start_batch},
  {0x6C602EB3,0,1,"vfprintf",&ci_vfprintf},
  {0x45CBCEB5,0,0,"drawsettextencoding",&ci_drawsettextencoding},
  {0x6110EEB5,0,1,"xml_parser_create_ns",&ci_xml_parser_create_ns},
@@ -25533,6 +25624,7 @@ static const hashNodeFunc funcBuckets[] = {
  {0x0433163E,0,1,"imagecolortransparent",&ci_imagecolortransparent},
  {0x5515F641,0,1,"krsort",&ci_krsort},
  {0x5D37D642,0,1,"hphp_splfileobject_getmaxlinelen",&ci_hphp_splfileobject_getmaxlinelen},
+ {0x403F3646,0,1,"json_encode_to_output",&ci_json_encode_to_output},
  {0x22BE7649,0,1,"iconv_mime_decode_headers",&ci_iconv_mime_decode_headers},
  {0x1D1D764A,0,0,"date",&ci_date},
  {0x1F64D64A,0,1,"mysql_errno",&ci_mysql_errno},
@@ -25598,6 +25690,7 @@ static const hashNodeFunc funcBuckets[] = {
  {0x4050D706,0,1,"mail",&ci_mail},
  {0x7F4FD709,0,1,"magickgetimageblob",&ci_magickgetimageblob},
  {0x3A21970A,0,1,"user_error",&ci_user_error},
+ {0x76AE570B,0,1,"pagelet_server_task_select",&ci_pagelet_server_task_select},
  {0x7937D70D,0,1,"shm_put_var",&ci_shm_put_var},
  {0x0AD73714,0,1,"dom_document_schema_validate_file",&ci_dom_document_schema_validate_file},
  {0x2BA59716,0,1,"openssl_pkcs7_encrypt",&ci_openssl_pkcs7_encrypt},
@@ -25770,7 +25863,8 @@ static const hashNodeFunc funcBuckets[] = {
  {0x1C691968,0,1,"imagefill",&ci_imagefill},
  {0x6657D96C,0,1,"log1p",&ci_log1p},
  {0x3564796E,0,1,"evhttp_async_get",&ci_evhttp_async_get},
- {0x5806B96F,0,1,"array_pad",&ci_array_pad},
+ {0x5806B96F,0,0,"array_pad",&ci_array_pad},
+ {0x711E396F,0,1,"mysql_async_result",&ci_mysql_async_result},
  {0x1BB11970,0,1,"curl_setopt_array",&ci_curl_setopt_array},
  {0x31E3F971,0,1,"ldap_free_result",&ci_ldap_free_result},
  {0x72033973,0,0,"fnmatch",&ci_fnmatch},
@@ -26245,1005 +26339,1005 @@ static const hashNodeFunc *funcMapTable[] = {
   0,0,0,0,funcBuckets+62,funcBuckets+63,0,0,
   0,0,0,funcBuckets+64,0,0,funcBuckets+65,0,
   funcBuckets+66,0,0,funcBuckets+67,funcBuckets+68,0,0,funcBuckets+69,
-  0,0,0,0,0,funcBuckets+70,0,0,
-  0,0,0,0,0,0,funcBuckets+72,0,
-  0,0,funcBuckets+73,0,0,0,0,0,
-  0,funcBuckets+74,0,0,0,0,funcBuckets+75,funcBuckets+76,
-  0,0,funcBuckets+77,0,0,funcBuckets+78,0,funcBuckets+79,
-  0,0,0,0,funcBuckets+80,0,0,0,
-  0,0,0,0,0,0,funcBuckets+81,funcBuckets+82,
-  0,funcBuckets+83,0,0,0,funcBuckets+85,0,0,
-  0,0,0,funcBuckets+86,0,0,0,0,
-  0,funcBuckets+87,0,0,0,0,funcBuckets+88,0,
-  0,funcBuckets+89,0,funcBuckets+90,0,0,0,0,
-  funcBuckets+91,0,0,0,0,0,funcBuckets+92,funcBuckets+93,
-  0,funcBuckets+94,0,0,0,0,0,0,
+  0,0,0,0,0,funcBuckets+70,0,funcBuckets+72,
+  0,0,0,0,0,0,funcBuckets+73,0,
+  0,0,funcBuckets+74,0,0,0,0,0,
+  0,funcBuckets+75,0,0,0,0,funcBuckets+76,funcBuckets+77,
+  0,0,funcBuckets+78,0,0,funcBuckets+79,0,funcBuckets+80,
+  0,0,0,0,funcBuckets+81,0,0,0,
+  0,0,0,0,0,0,funcBuckets+82,funcBuckets+84,
+  0,funcBuckets+85,0,0,0,funcBuckets+87,0,0,
+  0,0,0,funcBuckets+88,0,0,0,0,
+  0,funcBuckets+89,0,0,0,0,funcBuckets+90,0,
+  0,funcBuckets+91,0,funcBuckets+92,0,0,0,0,
+  funcBuckets+93,0,0,0,0,0,funcBuckets+94,funcBuckets+95,
+  0,funcBuckets+96,0,0,0,0,0,0,
   0,0,0,0,0,0,0,0,
-  0,0,0,0,funcBuckets+95,0,0,0,
-  0,funcBuckets+96,0,0,0,0,funcBuckets+97,0,
-  funcBuckets+99,0,0,0,0,0,0,0,
-  0,0,0,0,0,funcBuckets+100,0,funcBuckets+101,
-  0,funcBuckets+102,funcBuckets+103,0,0,0,funcBuckets+104,funcBuckets+105,
-  0,0,0,funcBuckets+106,0,0,0,0,
-  0,0,funcBuckets+107,0,0,0,0,0,
-  0,0,0,0,funcBuckets+108,funcBuckets+109,0,0,
-  0,0,0,0,0,0,0,funcBuckets+110,
-  funcBuckets+111,0,funcBuckets+113,0,0,0,funcBuckets+114,funcBuckets+115,
-  0,0,funcBuckets+116,0,funcBuckets+117,0,funcBuckets+119,0,
-  funcBuckets+120,0,funcBuckets+122,0,0,0,0,0,
-  0,funcBuckets+123,0,0,funcBuckets+124,funcBuckets+125,0,0,
-  0,0,funcBuckets+126,0,0,0,0,0,
-  0,0,funcBuckets+127,funcBuckets+129,funcBuckets+130,0,funcBuckets+131,funcBuckets+133,
+  0,0,0,0,funcBuckets+97,0,0,0,
+  0,funcBuckets+98,0,0,0,0,funcBuckets+99,0,
+  funcBuckets+101,0,0,0,0,0,0,0,
+  0,0,0,0,0,funcBuckets+102,0,funcBuckets+103,
+  0,funcBuckets+104,funcBuckets+105,0,0,0,funcBuckets+106,funcBuckets+107,
+  0,0,0,funcBuckets+108,0,0,0,0,
+  0,0,funcBuckets+109,0,0,0,0,0,
+  0,0,0,0,funcBuckets+110,funcBuckets+111,0,0,
+  0,0,0,0,0,0,0,funcBuckets+112,
+  funcBuckets+113,0,funcBuckets+115,0,0,0,funcBuckets+116,funcBuckets+117,
+  0,0,funcBuckets+118,0,funcBuckets+119,0,funcBuckets+121,0,
+  funcBuckets+122,0,funcBuckets+124,0,0,0,0,0,
+  0,funcBuckets+125,0,0,funcBuckets+126,funcBuckets+127,0,0,
+  0,0,funcBuckets+128,0,0,0,0,0,
+  0,0,funcBuckets+129,funcBuckets+131,funcBuckets+132,0,funcBuckets+133,funcBuckets+135,
   0,0,0,0,0,0,0,0,
   0,0,0,0,0,0,0,0,
-  0,0,0,0,0,funcBuckets+134,funcBuckets+135,0,
-  0,0,funcBuckets+136,0,0,0,0,0,
-  funcBuckets+137,0,0,0,0,0,0,0,
+  0,0,0,0,0,funcBuckets+136,funcBuckets+137,0,
+  0,0,funcBuckets+138,0,0,0,0,0,
+  funcBuckets+139,0,0,0,0,0,0,0,
   0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,funcBuckets+138,
-  0,0,0,0,funcBuckets+140,0,funcBuckets+141,funcBuckets+142,
+  0,0,0,0,0,0,0,funcBuckets+140,
+  0,0,0,0,funcBuckets+142,0,funcBuckets+143,funcBuckets+144,
   0,0,0,0,0,0,0,0,
-  0,funcBuckets+143,funcBuckets+144,0,0,0,0,0,
-  funcBuckets+145,funcBuckets+146,0,funcBuckets+147,funcBuckets+148,funcBuckets+149,funcBuckets+150,0,
-  0,0,funcBuckets+152,0,0,funcBuckets+153,0,funcBuckets+154,
-  0,0,0,0,0,0,funcBuckets+156,funcBuckets+157,
-  0,0,0,funcBuckets+159,0,0,0,0,
-  funcBuckets+161,funcBuckets+162,0,0,0,funcBuckets+163,0,0,
-  0,0,0,funcBuckets+164,0,0,0,funcBuckets+166,
-  funcBuckets+167,0,0,0,0,0,0,0,
-  0,0,0,0,0,funcBuckets+168,0,0,
-  0,0,funcBuckets+169,0,0,0,0,0,
-  0,0,0,0,funcBuckets+170,funcBuckets+171,0,funcBuckets+172,
-  0,funcBuckets+173,0,0,0,0,0,0,
-  0,funcBuckets+174,0,0,0,0,0,0,
+  0,funcBuckets+145,funcBuckets+146,0,0,0,0,0,
+  funcBuckets+147,funcBuckets+148,0,funcBuckets+149,funcBuckets+150,funcBuckets+151,funcBuckets+152,0,
+  0,0,funcBuckets+154,0,0,funcBuckets+155,0,funcBuckets+156,
+  0,0,0,0,0,0,funcBuckets+158,funcBuckets+159,
+  0,0,0,funcBuckets+161,0,0,0,0,
+  funcBuckets+163,funcBuckets+164,0,0,0,funcBuckets+165,0,0,
+  0,0,0,funcBuckets+166,0,0,0,funcBuckets+168,
+  funcBuckets+169,0,0,0,0,0,0,0,
+  0,0,0,0,0,funcBuckets+170,0,0,
+  funcBuckets+171,0,funcBuckets+172,0,0,0,0,0,
+  0,0,0,0,funcBuckets+173,funcBuckets+174,0,funcBuckets+175,
+  0,funcBuckets+176,0,0,0,0,0,0,
+  0,funcBuckets+177,0,0,0,0,0,0,
   0,0,0,0,0,0,0,0,
   0,0,0,0,0,0,0,0,
-  0,0,0,0,funcBuckets+175,0,0,0,
+  0,0,0,0,funcBuckets+178,0,0,0,
   0,0,0,0,0,0,0,0,
-  0,0,funcBuckets+176,funcBuckets+177,0,0,funcBuckets+178,0,
-  funcBuckets+179,0,funcBuckets+180,0,0,funcBuckets+181,0,funcBuckets+182,
-  0,funcBuckets+183,0,funcBuckets+184,0,0,0,0,
-  0,funcBuckets+185,0,0,0,0,0,0,
-  0,0,funcBuckets+186,funcBuckets+187,0,0,0,0,
-  funcBuckets+188,funcBuckets+189,funcBuckets+191,0,funcBuckets+192,0,0,0,
-  0,0,0,0,0,0,funcBuckets+193,0,
-  0,0,0,0,0,0,funcBuckets+194,0,
+  0,0,funcBuckets+179,funcBuckets+180,0,0,funcBuckets+181,0,
+  funcBuckets+182,0,funcBuckets+183,0,0,funcBuckets+184,0,funcBuckets+185,
+  0,funcBuckets+186,0,funcBuckets+187,0,0,0,0,
+  0,funcBuckets+188,0,0,0,0,0,0,
+  0,0,funcBuckets+189,funcBuckets+190,0,0,0,0,
+  funcBuckets+191,funcBuckets+192,funcBuckets+194,0,funcBuckets+195,0,0,0,
+  0,0,0,0,0,0,funcBuckets+196,0,
+  0,0,0,0,0,0,funcBuckets+197,0,
   0,0,0,0,0,0,0,0,
-  0,0,funcBuckets+195,0,0,0,0,0,
-  0,0,0,0,funcBuckets+196,0,0,funcBuckets+197,
-  0,funcBuckets+198,0,0,funcBuckets+199,0,0,0,
-  0,funcBuckets+200,0,0,0,0,0,0,
-  funcBuckets+201,0,0,0,0,0,0,0,
-  0,0,0,funcBuckets+202,0,funcBuckets+203,funcBuckets+204,0,
-  funcBuckets+205,funcBuckets+206,0,0,0,funcBuckets+207,0,0,
-  funcBuckets+208,0,funcBuckets+209,0,0,0,0,0,
-  0,0,0,funcBuckets+210,0,funcBuckets+211,funcBuckets+212,0,
-  0,0,0,0,0,0,funcBuckets+213,0,
-  0,funcBuckets+214,funcBuckets+215,funcBuckets+217,0,0,funcBuckets+218,0,
+  0,0,funcBuckets+198,0,0,0,0,0,
+  0,0,0,0,funcBuckets+199,0,0,funcBuckets+200,
+  0,funcBuckets+201,0,0,funcBuckets+202,0,0,0,
+  0,funcBuckets+203,0,0,0,0,0,0,
+  funcBuckets+204,0,0,0,0,0,0,0,
+  0,0,0,funcBuckets+205,0,funcBuckets+206,funcBuckets+207,0,
+  funcBuckets+208,funcBuckets+209,0,0,0,funcBuckets+210,0,0,
+  funcBuckets+211,0,funcBuckets+212,0,0,0,0,0,
+  0,0,0,funcBuckets+213,0,funcBuckets+214,funcBuckets+215,0,
+  0,0,0,0,0,0,funcBuckets+216,0,
+  0,funcBuckets+217,funcBuckets+218,funcBuckets+220,0,0,funcBuckets+221,0,
   0,0,0,0,0,0,0,0,
-  funcBuckets+220,0,0,0,funcBuckets+221,0,funcBuckets+222,0,
-  0,0,funcBuckets+223,funcBuckets+224,0,0,0,0,
-  funcBuckets+225,funcBuckets+226,funcBuckets+227,funcBuckets+228,funcBuckets+229,funcBuckets+230,0,0,
-  0,0,0,0,funcBuckets+231,0,0,funcBuckets+232,
-  0,0,funcBuckets+233,funcBuckets+234,funcBuckets+235,funcBuckets+236,0,0,
+  funcBuckets+223,0,0,0,funcBuckets+224,0,funcBuckets+225,0,
+  0,0,funcBuckets+226,funcBuckets+227,0,0,0,0,
+  funcBuckets+228,funcBuckets+229,funcBuckets+230,funcBuckets+231,funcBuckets+232,funcBuckets+233,0,0,
+  0,0,0,0,funcBuckets+234,0,0,funcBuckets+235,
+  0,0,funcBuckets+236,funcBuckets+237,funcBuckets+238,funcBuckets+239,0,0,
   0,0,0,0,0,0,0,0,
-  0,0,funcBuckets+237,0,0,funcBuckets+238,0,0,
-  0,0,0,funcBuckets+239,funcBuckets+240,0,0,0,
-  0,0,0,0,funcBuckets+241,0,0,0,
-  0,funcBuckets+242,0,funcBuckets+243,0,funcBuckets+244,0,0,
-  0,0,0,0,0,0,0,funcBuckets+245,
-  0,0,funcBuckets+246,0,0,funcBuckets+247,funcBuckets+248,0,
-  funcBuckets+249,0,funcBuckets+251,0,0,0,0,0,
-  funcBuckets+252,0,0,0,0,0,0,0,
-  funcBuckets+253,0,0,0,0,0,0,0,
+  0,0,funcBuckets+240,0,0,funcBuckets+241,0,0,
+  0,0,0,funcBuckets+242,funcBuckets+243,0,0,0,
+  0,0,0,0,funcBuckets+244,0,0,0,
+  0,funcBuckets+245,0,funcBuckets+246,0,funcBuckets+247,0,0,
+  0,0,0,0,0,0,0,funcBuckets+248,
+  0,0,funcBuckets+249,0,0,funcBuckets+250,funcBuckets+251,0,
+  funcBuckets+252,0,funcBuckets+254,0,0,0,0,0,
+  funcBuckets+255,0,0,0,0,0,0,0,
+  funcBuckets+256,0,0,0,0,0,0,0,
   0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,funcBuckets+254,
+  0,0,0,0,0,0,0,funcBuckets+257,
   0,0,0,0,0,0,0,0,
-  funcBuckets+255,0,funcBuckets+256,funcBuckets+257,funcBuckets+258,0,funcBuckets+260,funcBuckets+261,
-  0,0,0,funcBuckets+262,0,0,0,0,
-  funcBuckets+263,funcBuckets+264,0,0,0,0,0,0,
-  0,funcBuckets+265,0,funcBuckets+266,0,0,funcBuckets+267,0,
-  0,0,funcBuckets+268,0,0,0,0,0,
-  0,0,0,funcBuckets+269,0,0,0,funcBuckets+270,
-  funcBuckets+271,0,funcBuckets+272,funcBuckets+273,0,0,funcBuckets+275,0,
-  0,0,funcBuckets+276,0,0,0,0,0,
-  0,funcBuckets+277,funcBuckets+278,0,funcBuckets+280,0,0,0,
-  funcBuckets+281,0,0,0,funcBuckets+282,0,0,0,
-  0,0,funcBuckets+283,0,0,funcBuckets+284,0,0,
-  0,0,0,funcBuckets+285,0,funcBuckets+286,0,0,
-  0,0,0,0,0,funcBuckets+287,0,0,
-  0,funcBuckets+289,0,0,0,0,funcBuckets+291,0,
-  0,0,0,funcBuckets+292,0,0,0,0,
-  0,0,funcBuckets+293,funcBuckets+294,funcBuckets+295,0,0,funcBuckets+296,
-  0,0,funcBuckets+297,0,0,0,0,funcBuckets+298,
-  funcBuckets+299,0,0,0,0,0,funcBuckets+300,0,
-  0,0,0,0,0,0,0,funcBuckets+301,
-  0,0,0,funcBuckets+302,0,funcBuckets+304,funcBuckets+306,0,
+  funcBuckets+258,0,funcBuckets+259,funcBuckets+260,funcBuckets+261,0,funcBuckets+263,funcBuckets+264,
+  0,0,0,funcBuckets+265,0,0,0,0,
+  funcBuckets+266,funcBuckets+267,0,0,0,0,0,0,
+  0,funcBuckets+268,0,funcBuckets+269,0,0,funcBuckets+270,0,
+  0,0,funcBuckets+271,0,0,0,0,0,
+  0,0,0,funcBuckets+272,0,0,0,funcBuckets+273,
+  funcBuckets+274,0,funcBuckets+275,funcBuckets+276,0,0,funcBuckets+278,0,
+  0,0,funcBuckets+279,0,0,0,0,0,
+  0,funcBuckets+280,funcBuckets+281,0,funcBuckets+283,0,0,0,
+  funcBuckets+284,0,0,0,funcBuckets+285,0,0,0,
+  0,0,funcBuckets+286,0,0,funcBuckets+287,0,0,
+  0,0,0,funcBuckets+288,0,funcBuckets+289,0,0,
+  0,0,0,0,0,funcBuckets+290,0,0,
+  0,funcBuckets+292,0,0,0,0,funcBuckets+294,0,
+  0,0,0,funcBuckets+295,0,0,0,0,
+  0,0,funcBuckets+296,funcBuckets+297,funcBuckets+298,0,0,funcBuckets+299,
+  0,0,funcBuckets+300,0,0,0,0,funcBuckets+301,
+  funcBuckets+302,0,0,0,0,0,funcBuckets+303,0,
+  0,0,0,0,0,0,0,funcBuckets+304,
+  0,0,0,funcBuckets+305,0,funcBuckets+307,funcBuckets+309,0,
   0,0,0,0,0,0,0,0,
-  funcBuckets+307,funcBuckets+308,0,funcBuckets+309,funcBuckets+310,0,0,0,
+  funcBuckets+310,funcBuckets+311,0,funcBuckets+312,funcBuckets+313,0,0,0,
   0,0,0,0,0,0,0,0,
-  0,0,0,0,0,funcBuckets+312,0,0,
-  funcBuckets+313,0,funcBuckets+314,0,0,0,0,0,
+  0,0,0,0,0,funcBuckets+315,0,0,
+  funcBuckets+316,0,funcBuckets+317,0,0,0,0,0,
   0,0,0,0,0,0,0,0,
-  0,funcBuckets+315,0,0,funcBuckets+316,0,0,funcBuckets+317,
-  funcBuckets+318,funcBuckets+319,0,0,funcBuckets+320,0,0,0,
-  0,0,0,funcBuckets+321,0,funcBuckets+322,0,0,
-  0,0,funcBuckets+323,0,funcBuckets+324,0,0,0,
-  0,0,0,funcBuckets+325,0,0,0,0,
-  funcBuckets+326,0,0,0,0,0,funcBuckets+327,0,
-  0,0,0,0,0,0,0,funcBuckets+328,
-  funcBuckets+329,0,0,funcBuckets+330,0,0,0,funcBuckets+331,
-  funcBuckets+332,0,0,0,0,0,0,0,
-  funcBuckets+333,0,funcBuckets+334,0,0,funcBuckets+335,0,0,
-  0,0,0,funcBuckets+336,funcBuckets+337,0,0,0,
-  funcBuckets+339,funcBuckets+340,funcBuckets+341,0,0,0,0,0,
-  0,0,0,0,0,funcBuckets+342,0,funcBuckets+343,
-  0,funcBuckets+344,0,0,0,0,0,funcBuckets+345,
-  funcBuckets+346,0,funcBuckets+347,0,funcBuckets+348,funcBuckets+349,0,0,
+  0,funcBuckets+318,0,0,funcBuckets+319,0,0,funcBuckets+320,
+  funcBuckets+321,funcBuckets+322,0,0,funcBuckets+323,0,0,0,
+  0,0,0,funcBuckets+324,0,funcBuckets+325,0,0,
+  0,0,funcBuckets+326,0,funcBuckets+327,0,0,0,
+  0,0,0,funcBuckets+328,0,0,0,0,
+  funcBuckets+329,0,0,0,0,0,funcBuckets+330,0,
+  0,0,0,0,0,0,0,funcBuckets+331,
+  funcBuckets+332,0,0,funcBuckets+333,0,0,0,funcBuckets+334,
+  funcBuckets+335,0,0,0,0,0,0,0,
+  funcBuckets+336,0,funcBuckets+337,0,0,funcBuckets+338,0,0,
+  0,0,0,funcBuckets+339,funcBuckets+340,0,0,0,
+  funcBuckets+342,funcBuckets+343,funcBuckets+344,0,0,0,0,0,
+  0,0,0,0,0,funcBuckets+345,0,funcBuckets+346,
+  0,funcBuckets+347,0,0,0,0,0,funcBuckets+348,
+  funcBuckets+349,0,funcBuckets+350,0,funcBuckets+351,funcBuckets+352,0,0,
   0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,funcBuckets+350,funcBuckets+351,
-  funcBuckets+352,funcBuckets+353,0,funcBuckets+354,0,funcBuckets+355,0,funcBuckets+357,
-  0,0,0,0,0,0,funcBuckets+358,funcBuckets+359,
-  0,0,funcBuckets+360,0,0,0,0,0,
-  0,0,0,0,funcBuckets+361,0,0,0,
-  0,0,funcBuckets+362,0,funcBuckets+363,0,0,0,
-  funcBuckets+364,0,0,0,0,0,0,funcBuckets+366,
-  0,funcBuckets+367,0,0,0,funcBuckets+368,0,0,
-  0,0,0,0,0,0,funcBuckets+370,0,
-  0,funcBuckets+371,0,funcBuckets+372,funcBuckets+373,0,funcBuckets+374,funcBuckets+375,
-  0,0,0,0,funcBuckets+376,0,0,funcBuckets+377,
-  0,0,0,0,0,funcBuckets+378,0,0,
+  0,0,0,0,0,0,funcBuckets+353,funcBuckets+354,
+  funcBuckets+355,funcBuckets+356,0,funcBuckets+357,0,funcBuckets+358,0,funcBuckets+360,
+  0,0,0,0,0,0,funcBuckets+361,funcBuckets+362,
+  0,0,funcBuckets+363,0,0,0,0,0,
+  0,0,0,0,funcBuckets+364,0,0,0,
+  0,0,funcBuckets+365,0,funcBuckets+366,0,0,0,
+  funcBuckets+367,0,0,0,0,0,0,funcBuckets+369,
+  0,funcBuckets+370,0,0,0,funcBuckets+371,0,0,
+  0,0,0,0,0,0,funcBuckets+373,0,
+  0,funcBuckets+374,0,funcBuckets+375,funcBuckets+376,0,funcBuckets+377,funcBuckets+378,
+  0,0,0,0,funcBuckets+379,0,0,funcBuckets+380,
+  0,0,0,0,0,funcBuckets+381,0,0,
   0,0,0,0,0,0,0,0,
-  funcBuckets+379,0,funcBuckets+380,0,funcBuckets+381,0,0,0,
-  funcBuckets+383,funcBuckets+384,0,0,0,0,0,0,
-  0,funcBuckets+386,0,funcBuckets+387,0,0,0,0,
+  funcBuckets+382,0,funcBuckets+383,0,funcBuckets+384,0,0,0,
+  funcBuckets+386,funcBuckets+387,0,0,0,0,0,0,
+  0,funcBuckets+389,0,funcBuckets+390,0,0,0,0,
   0,0,0,0,0,0,0,0,
-  0,0,0,funcBuckets+388,0,0,0,0,
-  0,0,0,funcBuckets+389,0,0,0,0,
-  funcBuckets+391,0,funcBuckets+392,0,0,0,0,0,
-  0,0,0,funcBuckets+393,0,0,0,0,
-  funcBuckets+394,0,0,0,funcBuckets+396,funcBuckets+397,0,0,
-  0,0,0,0,funcBuckets+400,0,funcBuckets+401,funcBuckets+402,
+  0,0,0,funcBuckets+391,0,0,0,0,
+  0,0,0,funcBuckets+392,0,0,0,0,
+  funcBuckets+394,0,funcBuckets+395,0,0,0,0,0,
+  0,0,0,funcBuckets+396,0,0,0,0,
+  funcBuckets+397,0,0,0,funcBuckets+399,funcBuckets+400,0,0,
+  0,0,0,0,funcBuckets+403,0,funcBuckets+404,funcBuckets+405,
   0,0,0,0,0,0,0,0,
-  0,funcBuckets+403,0,funcBuckets+404,funcBuckets+405,0,0,0,
-  0,0,0,0,funcBuckets+406,0,funcBuckets+407,0,
-  funcBuckets+408,0,0,0,0,0,0,0,
-  0,0,0,0,0,funcBuckets+409,0,funcBuckets+410,
-  0,0,0,0,0,0,funcBuckets+412,funcBuckets+413,
-  funcBuckets+414,0,0,funcBuckets+415,0,funcBuckets+416,0,funcBuckets+417,
-  funcBuckets+418,0,funcBuckets+419,0,0,0,funcBuckets+420,0,
-  0,funcBuckets+421,0,0,funcBuckets+422,0,0,0,
-  0,0,funcBuckets+423,0,0,0,funcBuckets+424,0,
-  0,0,funcBuckets+425,0,0,funcBuckets+426,0,0,
-  funcBuckets+427,0,0,funcBuckets+428,0,0,0,0,
-  funcBuckets+429,funcBuckets+430,0,0,0,0,0,0,
-  0,0,0,0,funcBuckets+431,0,funcBuckets+432,0,
-  0,0,0,0,funcBuckets+433,0,0,funcBuckets+434,
-  0,0,0,0,0,0,0,funcBuckets+435,
+  0,funcBuckets+406,0,funcBuckets+407,funcBuckets+408,0,0,0,
+  0,0,0,0,funcBuckets+409,0,funcBuckets+410,0,
+  funcBuckets+411,0,0,0,0,0,0,0,
+  0,0,0,0,0,funcBuckets+412,0,funcBuckets+413,
+  0,0,0,0,0,0,funcBuckets+415,funcBuckets+416,
+  funcBuckets+417,0,0,funcBuckets+418,0,funcBuckets+419,0,funcBuckets+420,
+  funcBuckets+421,0,funcBuckets+422,0,0,0,funcBuckets+423,0,
+  0,funcBuckets+424,0,0,funcBuckets+425,0,0,0,
+  0,0,funcBuckets+426,0,0,0,funcBuckets+427,0,
+  0,0,funcBuckets+428,0,0,funcBuckets+429,0,0,
+  funcBuckets+430,0,0,funcBuckets+431,0,0,0,0,
+  funcBuckets+432,funcBuckets+433,0,0,0,0,0,0,
+  0,0,0,0,funcBuckets+434,0,funcBuckets+435,0,
+  0,0,0,0,funcBuckets+436,0,0,funcBuckets+437,
+  0,0,0,0,0,0,0,funcBuckets+438,
   0,0,0,0,0,0,0,0,
   0,0,0,0,0,0,0,0,
-  funcBuckets+437,0,0,0,0,0,0,0,
-  0,funcBuckets+438,0,0,0,funcBuckets+439,0,0,
-  0,funcBuckets+440,0,funcBuckets+441,0,0,0,funcBuckets+442,
-  funcBuckets+443,0,0,0,0,0,0,0,
-  0,0,0,0,0,funcBuckets+444,0,funcBuckets+445,
-  0,0,0,funcBuckets+446,0,0,0,funcBuckets+447,
-  funcBuckets+448,0,0,0,0,funcBuckets+449,0,0,
-  0,funcBuckets+450,0,0,0,0,0,funcBuckets+451,
-  funcBuckets+453,0,funcBuckets+454,0,0,0,0,0,
-  0,0,0,funcBuckets+455,0,funcBuckets+456,0,0,
+  funcBuckets+440,0,0,0,0,0,0,0,
+  0,funcBuckets+441,0,0,0,funcBuckets+442,0,0,
+  0,funcBuckets+443,0,funcBuckets+444,0,0,0,funcBuckets+445,
+  funcBuckets+446,0,0,0,0,0,0,0,
+  0,0,0,0,0,funcBuckets+447,0,funcBuckets+448,
+  0,0,0,funcBuckets+449,0,0,0,funcBuckets+450,
+  funcBuckets+451,0,0,0,0,funcBuckets+452,0,0,
+  0,funcBuckets+453,0,0,0,0,0,funcBuckets+454,
+  funcBuckets+456,0,funcBuckets+457,0,0,0,0,0,
+  0,0,0,funcBuckets+458,0,funcBuckets+459,0,0,
   0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,funcBuckets+457,
-  0,funcBuckets+458,0,0,0,0,funcBuckets+460,funcBuckets+461,
+  0,0,0,0,0,0,0,funcBuckets+460,
+  0,funcBuckets+461,0,0,0,0,funcBuckets+463,funcBuckets+464,
   0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,funcBuckets+462,
+  0,0,0,0,0,0,0,funcBuckets+465,
   0,0,0,0,0,0,0,0,
-  funcBuckets+463,funcBuckets+464,0,0,0,0,0,funcBuckets+465,
-  funcBuckets+466,0,0,0,0,funcBuckets+467,funcBuckets+468,funcBuckets+469,
-  0,0,funcBuckets+470,funcBuckets+471,funcBuckets+472,0,0,0,
-  0,0,0,0,0,0,funcBuckets+473,0,
-  0,funcBuckets+474,funcBuckets+475,0,0,0,0,0,
-  0,funcBuckets+476,0,0,0,0,0,0,
-  funcBuckets+478,0,0,0,0,0,0,0,
+  funcBuckets+466,funcBuckets+467,0,0,0,0,0,funcBuckets+468,
+  funcBuckets+469,0,0,0,0,funcBuckets+470,funcBuckets+471,funcBuckets+472,
+  0,0,funcBuckets+473,funcBuckets+474,funcBuckets+475,0,0,0,
+  0,0,0,0,0,0,funcBuckets+476,0,
+  0,funcBuckets+477,funcBuckets+478,0,0,0,0,0,
   0,funcBuckets+479,0,0,0,0,0,0,
+  funcBuckets+481,0,0,0,0,0,0,0,
+  0,funcBuckets+482,0,0,0,0,0,0,
   0,0,0,0,0,0,0,0,
-  funcBuckets+480,0,0,0,funcBuckets+481,0,0,0,
-  funcBuckets+482,0,0,0,funcBuckets+483,0,0,0,
-  0,funcBuckets+484,0,0,0,0,0,funcBuckets+485,
-  funcBuckets+486,0,0,0,0,0,funcBuckets+487,0,
-  0,0,0,0,0,funcBuckets+488,0,0,
-  0,0,funcBuckets+489,0,0,funcBuckets+490,funcBuckets+492,0,
-  0,0,0,funcBuckets+493,0,0,0,funcBuckets+495,
-  0,0,0,0,0,0,0,funcBuckets+496,
-  0,0,0,funcBuckets+497,0,0,0,0,
-  funcBuckets+498,0,funcBuckets+499,funcBuckets+501,0,funcBuckets+502,0,0,
-  0,0,0,0,0,0,funcBuckets+503,0,
-  funcBuckets+504,0,0,0,0,0,0,0,
-  funcBuckets+505,0,0,0,0,funcBuckets+506,0,0,
-  0,0,funcBuckets+507,0,funcBuckets+508,0,0,0,
-  0,0,0,0,funcBuckets+509,0,0,0,
-  0,0,funcBuckets+510,0,0,0,funcBuckets+511,0,
-  0,0,0,0,0,funcBuckets+512,0,0,
-  0,funcBuckets+513,0,funcBuckets+514,funcBuckets+515,0,0,0,
-  funcBuckets+517,0,0,0,0,funcBuckets+518,0,0,
-  funcBuckets+519,funcBuckets+520,0,0,funcBuckets+521,funcBuckets+522,0,0,
-  0,0,0,funcBuckets+523,funcBuckets+524,0,0,0,
-  0,funcBuckets+526,0,funcBuckets+527,0,funcBuckets+528,funcBuckets+530,0,
+  funcBuckets+483,0,0,0,funcBuckets+484,0,0,0,
+  funcBuckets+485,0,0,0,funcBuckets+486,0,0,0,
+  0,funcBuckets+487,0,0,0,0,0,funcBuckets+488,
+  funcBuckets+489,0,0,0,0,0,funcBuckets+490,0,
+  0,0,0,0,0,funcBuckets+491,0,0,
+  0,0,funcBuckets+492,0,0,funcBuckets+493,funcBuckets+495,0,
+  0,0,0,funcBuckets+496,0,0,0,funcBuckets+498,
+  0,0,0,0,0,0,0,funcBuckets+499,
+  0,0,0,funcBuckets+500,0,0,0,0,
+  funcBuckets+501,0,funcBuckets+502,funcBuckets+504,0,funcBuckets+505,0,0,
+  0,0,0,0,0,0,funcBuckets+506,0,
+  funcBuckets+507,0,0,0,0,0,0,0,
+  funcBuckets+508,0,0,0,0,funcBuckets+509,0,0,
+  0,0,funcBuckets+510,0,funcBuckets+511,0,0,0,
+  0,0,0,0,funcBuckets+512,0,0,0,
+  0,0,funcBuckets+513,0,0,0,funcBuckets+514,0,
+  0,0,0,0,0,funcBuckets+515,0,0,
+  0,funcBuckets+516,0,funcBuckets+517,funcBuckets+518,0,0,0,
+  funcBuckets+520,0,0,0,0,funcBuckets+521,0,0,
+  funcBuckets+522,funcBuckets+523,0,0,funcBuckets+524,funcBuckets+525,0,0,
+  0,0,0,funcBuckets+526,funcBuckets+527,0,0,0,
+  0,funcBuckets+529,0,funcBuckets+530,0,funcBuckets+531,funcBuckets+533,0,
   0,0,0,0,0,0,0,0,
   0,0,0,0,0,0,0,0,
-  0,funcBuckets+531,0,0,funcBuckets+532,funcBuckets+533,0,0,
-  0,funcBuckets+535,funcBuckets+536,0,0,0,0,funcBuckets+537,
-  0,funcBuckets+538,0,funcBuckets+539,0,funcBuckets+540,0,0,
-  0,0,funcBuckets+542,funcBuckets+543,funcBuckets+544,0,0,funcBuckets+545,
+  0,funcBuckets+534,0,0,funcBuckets+535,funcBuckets+536,0,0,
+  0,funcBuckets+538,funcBuckets+539,0,0,0,0,funcBuckets+540,
+  0,funcBuckets+541,0,funcBuckets+542,0,funcBuckets+543,0,0,
+  0,0,funcBuckets+545,funcBuckets+546,funcBuckets+547,0,0,funcBuckets+548,
   0,0,0,0,0,0,0,0,
-  0,0,0,0,0,funcBuckets+546,0,0,
-  0,funcBuckets+548,0,0,0,0,0,funcBuckets+549,
-  0,0,0,funcBuckets+550,0,0,0,0,
-  0,0,0,0,0,0,0,funcBuckets+552,
-  0,funcBuckets+553,funcBuckets+554,0,0,0,0,funcBuckets+555,
-  0,0,0,0,funcBuckets+556,0,0,0,
-  0,funcBuckets+557,0,0,0,0,0,0,
-  0,0,0,0,0,funcBuckets+558,0,funcBuckets+559,
-  0,funcBuckets+560,0,0,funcBuckets+561,0,0,0,
-  0,funcBuckets+562,0,0,0,0,0,0,
-  0,0,0,0,0,funcBuckets+564,0,funcBuckets+565,
-  funcBuckets+566,0,funcBuckets+567,0,funcBuckets+568,0,0,0,
-  funcBuckets+569,0,funcBuckets+570,0,funcBuckets+571,0,funcBuckets+572,funcBuckets+573,
-  0,0,funcBuckets+574,funcBuckets+575,0,0,0,0,
-  0,0,funcBuckets+576,funcBuckets+577,funcBuckets+579,0,0,0,
-  0,funcBuckets+580,0,0,funcBuckets+581,0,0,0,
-  funcBuckets+582,0,funcBuckets+583,funcBuckets+585,0,0,0,funcBuckets+586,
-  0,0,0,funcBuckets+587,0,0,0,0,
-  0,0,funcBuckets+588,0,funcBuckets+589,funcBuckets+590,0,0,
-  0,0,funcBuckets+591,0,0,0,0,0,
-  0,funcBuckets+592,0,0,0,funcBuckets+593,0,0,
-  funcBuckets+595,funcBuckets+596,0,funcBuckets+597,0,0,funcBuckets+598,0,
-  0,funcBuckets+599,funcBuckets+600,0,0,0,0,0,
-  funcBuckets+601,0,0,funcBuckets+602,0,0,funcBuckets+603,0,
-  funcBuckets+604,0,0,0,funcBuckets+606,0,0,0,
+  0,0,0,0,0,funcBuckets+549,0,0,
+  0,funcBuckets+551,0,0,0,0,0,funcBuckets+552,
+  0,0,0,funcBuckets+553,0,0,0,0,
+  0,0,0,0,0,0,0,funcBuckets+555,
+  0,funcBuckets+556,funcBuckets+557,0,0,0,0,funcBuckets+558,
+  0,0,0,0,funcBuckets+559,0,0,0,
+  0,funcBuckets+560,0,0,0,0,0,0,
+  0,0,0,0,0,funcBuckets+561,0,funcBuckets+562,
+  0,funcBuckets+563,0,0,funcBuckets+564,0,0,0,
+  0,funcBuckets+565,0,0,0,0,0,0,
+  0,0,0,0,0,funcBuckets+567,0,funcBuckets+568,
+  funcBuckets+569,0,funcBuckets+570,0,funcBuckets+571,0,0,0,
+  funcBuckets+572,0,funcBuckets+573,0,funcBuckets+574,0,funcBuckets+575,funcBuckets+576,
+  0,0,funcBuckets+577,funcBuckets+578,0,0,0,0,
+  0,0,funcBuckets+579,funcBuckets+580,funcBuckets+582,0,0,0,
+  0,funcBuckets+583,0,0,funcBuckets+584,0,0,0,
+  funcBuckets+585,0,funcBuckets+586,funcBuckets+588,0,0,0,funcBuckets+589,
+  0,0,0,funcBuckets+590,0,0,0,0,
+  0,0,funcBuckets+591,0,funcBuckets+592,funcBuckets+593,0,0,
+  0,0,funcBuckets+594,0,0,0,0,0,
+  0,funcBuckets+595,0,0,0,funcBuckets+596,0,0,
+  funcBuckets+598,funcBuckets+599,0,funcBuckets+600,0,0,funcBuckets+601,0,
+  0,funcBuckets+602,funcBuckets+603,0,0,0,0,0,
+  funcBuckets+604,0,0,funcBuckets+605,0,0,funcBuckets+606,0,
+  funcBuckets+607,0,0,0,funcBuckets+609,0,0,0,
   0,0,0,0,0,0,0,0,
-  0,0,0,0,0,funcBuckets+607,0,0,
-  0,funcBuckets+608,0,0,0,0,0,0,
-  0,0,0,0,0,0,funcBuckets+609,0,
-  0,funcBuckets+610,funcBuckets+611,0,0,0,0,0,
-  funcBuckets+612,0,funcBuckets+613,funcBuckets+615,0,0,0,funcBuckets+616,
-  0,funcBuckets+617,0,funcBuckets+618,0,0,funcBuckets+619,0,
-  0,0,0,funcBuckets+620,0,funcBuckets+621,0,funcBuckets+622,
-  0,funcBuckets+623,0,0,0,0,0,0,
-  0,0,funcBuckets+624,0,0,0,0,funcBuckets+625,
-  0,0,funcBuckets+626,funcBuckets+627,0,0,0,0,
-  0,0,funcBuckets+628,funcBuckets+629,funcBuckets+630,0,0,0,
-  funcBuckets+631,0,funcBuckets+632,0,0,0,0,0,
-  funcBuckets+633,0,funcBuckets+635,0,0,funcBuckets+636,0,funcBuckets+637,
+  0,0,0,0,0,funcBuckets+610,0,0,
+  0,funcBuckets+611,0,0,0,0,0,0,
+  0,0,0,0,0,0,funcBuckets+612,0,
+  0,funcBuckets+613,funcBuckets+614,0,0,0,0,0,
+  funcBuckets+615,0,funcBuckets+616,funcBuckets+618,0,0,0,funcBuckets+619,
+  0,funcBuckets+620,0,funcBuckets+621,0,0,funcBuckets+622,0,
+  0,0,0,funcBuckets+623,0,funcBuckets+624,0,funcBuckets+625,
+  0,funcBuckets+626,0,0,0,0,0,0,
+  0,0,funcBuckets+627,0,0,0,0,funcBuckets+628,
+  0,0,funcBuckets+629,funcBuckets+630,0,0,0,0,
+  0,0,funcBuckets+631,funcBuckets+632,funcBuckets+633,0,0,0,
+  funcBuckets+634,0,funcBuckets+635,0,0,0,0,0,
+  funcBuckets+636,0,funcBuckets+638,0,0,funcBuckets+639,0,funcBuckets+640,
   0,0,0,0,0,0,0,0,
-  0,0,0,funcBuckets+638,funcBuckets+639,0,0,funcBuckets+640,
+  0,0,0,funcBuckets+641,funcBuckets+642,0,0,funcBuckets+643,
   0,0,0,0,0,0,0,0,
-  0,funcBuckets+642,0,funcBuckets+644,funcBuckets+645,0,0,funcBuckets+646,
-  0,0,funcBuckets+647,0,0,0,0,0,
-  0,0,funcBuckets+649,0,0,0,0,funcBuckets+651,
+  0,funcBuckets+645,0,funcBuckets+647,funcBuckets+648,0,0,funcBuckets+649,
+  0,0,funcBuckets+650,0,0,0,0,0,
+  0,0,funcBuckets+652,0,0,0,0,funcBuckets+654,
   0,0,0,0,0,0,0,0,
-  0,0,0,0,funcBuckets+652,0,0,funcBuckets+653,
-  0,0,0,0,funcBuckets+654,funcBuckets+655,funcBuckets+656,0,
-  funcBuckets+657,0,funcBuckets+658,0,0,0,funcBuckets+660,funcBuckets+661,
-  0,funcBuckets+662,0,0,0,0,0,funcBuckets+663,
-  0,funcBuckets+664,0,0,0,0,0,0,
-  funcBuckets+666,0,funcBuckets+667,0,0,0,0,0,
-  0,0,0,funcBuckets+668,0,0,0,0,
-  0,0,0,funcBuckets+669,0,funcBuckets+670,0,0,
-  funcBuckets+671,0,0,0,0,0,0,0,
+  0,0,0,0,funcBuckets+655,0,0,funcBuckets+656,
+  0,0,0,0,funcBuckets+657,funcBuckets+658,funcBuckets+659,0,
+  funcBuckets+660,0,funcBuckets+661,0,0,0,funcBuckets+663,funcBuckets+664,
+  0,funcBuckets+665,0,0,0,0,0,funcBuckets+666,
+  0,funcBuckets+667,0,0,0,0,0,0,
+  funcBuckets+669,0,funcBuckets+670,0,0,0,0,0,
+  0,0,0,funcBuckets+671,0,0,0,0,
+  0,0,0,funcBuckets+672,0,funcBuckets+673,0,0,
+  funcBuckets+674,0,0,0,0,0,0,0,
   0,0,0,0,0,0,0,0,
-  0,0,funcBuckets+672,funcBuckets+673,funcBuckets+674,0,0,0,
+  0,0,funcBuckets+675,funcBuckets+676,funcBuckets+677,0,0,0,
   0,0,0,0,0,0,0,0,
-  funcBuckets+675,0,0,funcBuckets+676,funcBuckets+677,funcBuckets+678,funcBuckets+679,0,
-  0,funcBuckets+680,0,0,0,funcBuckets+681,funcBuckets+682,0,
-  0,0,0,0,0,funcBuckets+683,0,0,
-  funcBuckets+684,0,0,0,0,0,0,0,
-  0,0,funcBuckets+685,funcBuckets+686,0,0,0,0,
+  funcBuckets+678,0,0,funcBuckets+679,funcBuckets+680,funcBuckets+681,funcBuckets+682,0,
+  0,funcBuckets+683,0,0,0,funcBuckets+684,funcBuckets+685,0,
+  0,0,0,0,0,funcBuckets+686,0,0,
+  funcBuckets+687,0,0,0,0,0,0,0,
+  0,0,funcBuckets+688,funcBuckets+689,0,0,0,0,
   0,0,0,0,0,0,0,0,
-  funcBuckets+687,0,0,0,funcBuckets+688,funcBuckets+689,0,0,
-  funcBuckets+690,0,0,0,0,0,0,0,
-  0,0,funcBuckets+691,0,funcBuckets+692,funcBuckets+694,0,funcBuckets+695,
-  0,funcBuckets+696,0,0,0,0,funcBuckets+697,0,
-  0,funcBuckets+699,0,0,0,0,0,0,
-  funcBuckets+701,funcBuckets+703,0,0,funcBuckets+704,0,funcBuckets+705,0,
-  0,0,0,0,0,funcBuckets+706,0,0,
-  0,0,funcBuckets+707,0,0,0,funcBuckets+709,0,
-  0,0,0,funcBuckets+710,0,0,funcBuckets+711,0,
+  funcBuckets+690,0,0,0,funcBuckets+691,funcBuckets+692,0,0,
+  funcBuckets+693,0,0,0,0,0,0,0,
+  0,0,funcBuckets+694,0,funcBuckets+695,funcBuckets+697,0,funcBuckets+698,
+  0,funcBuckets+699,0,0,0,0,funcBuckets+700,0,
+  0,funcBuckets+702,0,0,0,0,0,0,
+  funcBuckets+704,funcBuckets+706,0,0,funcBuckets+707,0,funcBuckets+708,0,
+  0,0,0,0,0,funcBuckets+709,0,0,
+  0,0,funcBuckets+710,0,0,0,funcBuckets+712,0,
+  0,0,0,funcBuckets+713,0,0,funcBuckets+714,0,
   0,0,0,0,0,0,0,0,
-  0,0,0,funcBuckets+712,0,0,0,0,
-  0,funcBuckets+713,funcBuckets+714,0,0,funcBuckets+715,0,0,
+  0,0,0,funcBuckets+715,0,0,0,0,
+  0,funcBuckets+716,funcBuckets+717,0,0,funcBuckets+718,0,0,
   0,0,0,0,0,0,0,0,
-  funcBuckets+716,funcBuckets+717,0,0,funcBuckets+718,0,0,funcBuckets+719,
+  funcBuckets+719,funcBuckets+720,0,0,funcBuckets+721,0,0,funcBuckets+722,
   0,0,0,0,0,0,0,0,
-  funcBuckets+720,0,0,0,0,0,0,0,
-  0,funcBuckets+721,0,0,0,0,0,0,
-  funcBuckets+722,funcBuckets+723,funcBuckets+724,0,0,funcBuckets+725,0,funcBuckets+726,
-  0,funcBuckets+727,0,0,0,funcBuckets+728,funcBuckets+729,0,
-  0,0,funcBuckets+731,0,0,0,0,0,
-  0,0,funcBuckets+732,0,0,funcBuckets+733,0,0,
-  funcBuckets+734,funcBuckets+735,0,funcBuckets+737,0,0,0,0,
-  0,0,0,0,funcBuckets+738,0,0,funcBuckets+739,
-  funcBuckets+741,funcBuckets+742,0,0,0,0,funcBuckets+744,0,
-  0,0,funcBuckets+745,0,0,0,0,funcBuckets+746,
-  0,0,0,0,0,0,0,funcBuckets+749,
-  funcBuckets+750,funcBuckets+751,funcBuckets+753,0,funcBuckets+754,0,funcBuckets+755,0,
-  0,funcBuckets+756,0,0,0,funcBuckets+757,0,0,
-  0,0,0,0,funcBuckets+758,0,0,funcBuckets+759,
-  0,0,funcBuckets+761,0,0,0,0,funcBuckets+762,
-  0,funcBuckets+763,0,funcBuckets+764,funcBuckets+765,0,0,0,
-  0,0,0,0,0,0,funcBuckets+766,0,
-  0,0,0,0,funcBuckets+767,0,0,0,
-  funcBuckets+768,0,0,funcBuckets+769,funcBuckets+770,0,0,funcBuckets+771,
-  0,0,funcBuckets+772,0,funcBuckets+773,0,0,0,
-  0,0,funcBuckets+775,funcBuckets+776,0,0,0,funcBuckets+778,
-  0,0,0,0,funcBuckets+779,0,0,0,
-  0,0,0,0,funcBuckets+780,0,0,0,
-  0,0,0,0,0,0,funcBuckets+781,0,
-  0,funcBuckets+782,0,0,0,funcBuckets+784,0,funcBuckets+785,
-  0,0,0,0,funcBuckets+786,0,0,funcBuckets+787,
-  funcBuckets+788,0,0,0,0,0,0,0,
-  funcBuckets+789,0,0,0,0,0,0,0,
-  0,0,funcBuckets+791,0,funcBuckets+792,funcBuckets+793,0,0,
-  0,0,0,0,funcBuckets+794,0,0,0,
-  0,funcBuckets+795,0,0,0,0,0,0,
-  0,0,funcBuckets+796,funcBuckets+797,0,funcBuckets+798,0,0,
-  0,0,funcBuckets+799,0,funcBuckets+800,0,0,0,
-  0,0,funcBuckets+801,0,funcBuckets+803,0,0,funcBuckets+804,
-  0,0,0,0,0,funcBuckets+805,0,0,
-  0,0,0,0,0,0,0,funcBuckets+807,
+  funcBuckets+723,0,0,0,0,0,0,0,
+  0,funcBuckets+724,0,0,0,0,0,0,
+  funcBuckets+725,funcBuckets+726,funcBuckets+727,0,0,funcBuckets+728,0,funcBuckets+729,
+  0,funcBuckets+730,0,0,0,funcBuckets+731,funcBuckets+732,0,
+  0,0,funcBuckets+734,0,0,0,0,0,
+  0,0,funcBuckets+735,0,0,funcBuckets+736,0,0,
+  funcBuckets+737,funcBuckets+738,0,funcBuckets+740,0,0,0,0,
+  0,0,0,0,funcBuckets+741,0,0,funcBuckets+742,
+  funcBuckets+744,funcBuckets+745,0,0,0,0,funcBuckets+747,0,
+  0,0,funcBuckets+748,0,0,0,0,funcBuckets+749,
+  0,0,0,0,0,0,0,funcBuckets+752,
+  funcBuckets+753,funcBuckets+754,funcBuckets+756,0,funcBuckets+757,0,funcBuckets+758,0,
+  0,funcBuckets+759,0,0,0,funcBuckets+760,0,0,
+  0,0,0,0,funcBuckets+761,0,0,funcBuckets+762,
+  0,0,funcBuckets+764,0,0,0,0,funcBuckets+765,
+  0,funcBuckets+766,0,funcBuckets+767,funcBuckets+768,0,0,0,
+  0,0,0,0,0,0,funcBuckets+769,0,
+  0,0,0,0,funcBuckets+770,0,0,0,
+  funcBuckets+771,0,0,funcBuckets+772,funcBuckets+773,0,0,funcBuckets+774,
+  0,0,funcBuckets+775,0,funcBuckets+776,0,0,0,
+  0,0,funcBuckets+778,funcBuckets+779,0,0,0,funcBuckets+781,
+  0,0,0,0,funcBuckets+782,0,0,0,
+  0,0,0,0,funcBuckets+783,0,0,0,
+  0,0,0,0,0,0,funcBuckets+784,0,
+  0,funcBuckets+785,0,0,0,funcBuckets+787,0,funcBuckets+788,
+  0,0,0,0,funcBuckets+789,0,0,funcBuckets+790,
+  funcBuckets+791,0,0,0,0,0,0,0,
+  funcBuckets+792,0,0,0,0,0,0,0,
+  0,0,funcBuckets+794,0,funcBuckets+795,funcBuckets+796,0,0,
+  0,0,0,0,funcBuckets+797,0,0,0,
+  0,funcBuckets+798,0,0,0,0,0,0,
+  0,0,funcBuckets+799,funcBuckets+800,0,funcBuckets+801,0,0,
+  0,0,funcBuckets+802,0,funcBuckets+803,0,0,0,
+  0,0,funcBuckets+804,0,funcBuckets+806,0,0,funcBuckets+807,
   0,0,0,0,0,funcBuckets+808,0,0,
-  0,0,0,funcBuckets+809,0,0,0,funcBuckets+810,
-  0,funcBuckets+811,0,0,0,0,0,0,
-  funcBuckets+812,funcBuckets+813,0,0,0,0,0,0,
-  funcBuckets+814,0,0,0,0,0,0,0,
-  funcBuckets+815,0,0,0,funcBuckets+817,0,0,funcBuckets+818,
-  0,0,0,0,0,funcBuckets+819,funcBuckets+820,0,
-  0,0,funcBuckets+822,0,funcBuckets+824,0,0,0,
+  0,0,0,0,0,0,0,funcBuckets+811,
+  0,0,0,0,0,funcBuckets+812,0,0,
+  0,0,0,funcBuckets+813,0,0,0,funcBuckets+814,
+  0,funcBuckets+815,0,0,0,0,0,0,
+  funcBuckets+816,funcBuckets+817,0,0,0,0,0,0,
+  funcBuckets+818,0,0,0,0,0,0,0,
+  funcBuckets+819,0,0,0,funcBuckets+821,0,0,funcBuckets+822,
+  0,0,0,0,0,funcBuckets+823,funcBuckets+824,0,
+  0,0,funcBuckets+826,0,funcBuckets+828,0,0,0,
   0,0,0,0,0,0,0,0,
   0,0,0,0,0,0,0,0,
-  0,0,0,0,funcBuckets+825,funcBuckets+826,0,0,
-  funcBuckets+827,0,0,funcBuckets+828,0,0,0,funcBuckets+829,
-  0,funcBuckets+830,funcBuckets+831,0,0,0,0,0,
-  0,0,funcBuckets+832,0,0,0,0,0,
-  0,funcBuckets+833,0,funcBuckets+834,0,0,funcBuckets+835,0,
-  0,0,funcBuckets+836,0,0,0,funcBuckets+837,0,
-  funcBuckets+838,funcBuckets+839,0,0,funcBuckets+840,0,0,funcBuckets+841,
-  funcBuckets+842,0,0,0,0,0,0,funcBuckets+843,
-  0,funcBuckets+844,0,0,0,0,0,0,
+  0,0,0,0,funcBuckets+829,funcBuckets+830,0,0,
+  funcBuckets+831,0,0,funcBuckets+832,0,0,0,funcBuckets+833,
+  0,funcBuckets+834,funcBuckets+835,0,0,0,0,0,
+  0,0,funcBuckets+836,0,0,0,0,0,
+  0,funcBuckets+837,0,funcBuckets+838,0,0,funcBuckets+839,0,
+  0,0,funcBuckets+840,0,0,0,funcBuckets+841,0,
+  funcBuckets+842,funcBuckets+843,0,0,funcBuckets+844,0,0,funcBuckets+845,
+  funcBuckets+846,0,0,0,0,0,0,funcBuckets+847,
+  0,funcBuckets+848,0,0,0,0,0,0,
   0,0,0,0,0,0,0,0,
-  0,0,0,0,funcBuckets+846,0,0,0,
-  0,funcBuckets+847,0,0,0,0,funcBuckets+848,0,
-  0,0,0,funcBuckets+849,0,0,funcBuckets+850,funcBuckets+851,
-  0,0,0,funcBuckets+852,0,funcBuckets+853,0,funcBuckets+854,
-  0,0,0,0,0,0,funcBuckets+855,0,
-  0,0,0,funcBuckets+856,0,0,0,0,
-  0,0,0,funcBuckets+857,0,funcBuckets+858,funcBuckets+859,0,
-  0,0,0,0,0,0,0,funcBuckets+860,
-  0,0,0,0,0,funcBuckets+861,0,0,
+  0,0,0,0,funcBuckets+850,0,0,0,
+  0,funcBuckets+851,0,0,0,0,funcBuckets+852,0,
+  0,0,0,funcBuckets+853,0,0,funcBuckets+854,funcBuckets+855,
+  0,0,0,funcBuckets+856,0,funcBuckets+857,0,funcBuckets+858,
+  0,0,0,0,0,0,funcBuckets+859,0,
+  0,0,0,funcBuckets+860,0,0,0,0,
+  0,0,0,funcBuckets+861,0,funcBuckets+862,funcBuckets+863,0,
+  0,0,0,0,0,0,0,funcBuckets+864,
+  0,0,0,0,0,funcBuckets+865,0,0,
   0,0,0,0,0,0,0,0,
-  funcBuckets+862,0,0,0,0,0,funcBuckets+863,0,
-  0,funcBuckets+864,0,funcBuckets+865,0,0,0,funcBuckets+866,
+  funcBuckets+866,0,0,0,0,0,funcBuckets+867,0,
+  0,funcBuckets+868,0,funcBuckets+869,0,0,0,funcBuckets+870,
   0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,funcBuckets+867,0,
-  funcBuckets+868,0,funcBuckets+869,0,0,0,0,0,
-  funcBuckets+870,0,0,0,0,0,funcBuckets+871,funcBuckets+873,
-  0,funcBuckets+874,funcBuckets+875,0,0,0,0,0,
-  0,0,funcBuckets+876,0,0,0,0,0,
-  0,0,0,funcBuckets+877,funcBuckets+879,0,0,0,
-  funcBuckets+880,0,0,funcBuckets+881,0,funcBuckets+882,0,0,
-  0,funcBuckets+883,0,0,funcBuckets+884,funcBuckets+885,0,0,
-  0,0,0,0,0,0,funcBuckets+887,0,
-  0,0,0,funcBuckets+888,0,funcBuckets+890,0,0,
-  0,funcBuckets+891,funcBuckets+892,0,0,0,0,0,
-  0,0,0,0,0,0,funcBuckets+893,0,
-  0,funcBuckets+894,0,0,0,funcBuckets+895,0,0,
-  0,0,0,0,0,funcBuckets+896,0,funcBuckets+897,
-  funcBuckets+898,0,0,0,0,0,funcBuckets+899,0,
-  0,0,0,funcBuckets+900,0,0,0,0,
-  0,funcBuckets+901,funcBuckets+903,0,funcBuckets+904,0,0,0,
+  0,0,0,0,0,0,funcBuckets+871,0,
+  funcBuckets+872,0,funcBuckets+873,0,0,0,0,0,
+  funcBuckets+874,0,0,0,0,0,funcBuckets+875,funcBuckets+877,
+  0,funcBuckets+878,funcBuckets+879,0,0,0,0,0,
+  0,0,funcBuckets+880,0,0,0,0,0,
+  0,0,0,funcBuckets+881,funcBuckets+883,0,0,0,
+  funcBuckets+884,0,0,funcBuckets+885,0,funcBuckets+886,0,0,
+  0,funcBuckets+887,0,0,funcBuckets+888,funcBuckets+889,0,0,
+  0,0,0,0,0,0,funcBuckets+891,0,
+  0,0,0,funcBuckets+892,0,funcBuckets+894,0,0,
+  0,funcBuckets+895,funcBuckets+896,0,0,0,0,0,
+  0,0,0,0,0,0,funcBuckets+897,0,
+  0,funcBuckets+898,0,0,0,funcBuckets+899,0,0,
+  0,0,0,0,0,funcBuckets+900,0,funcBuckets+901,
+  funcBuckets+902,0,0,0,0,0,funcBuckets+903,0,
+  0,0,0,funcBuckets+904,0,0,0,0,
+  0,funcBuckets+905,funcBuckets+907,0,funcBuckets+908,0,0,0,
   0,0,0,0,0,0,0,0,
-  0,0,0,0,funcBuckets+905,0,0,funcBuckets+906,
+  0,0,0,0,funcBuckets+909,0,0,funcBuckets+910,
   0,0,0,0,0,0,0,0,
-  0,0,0,0,0,funcBuckets+907,0,funcBuckets+908,
-  0,0,0,0,funcBuckets+909,0,0,0,
-  funcBuckets+910,0,funcBuckets+911,0,0,0,funcBuckets+912,0,
-  0,0,0,funcBuckets+913,0,funcBuckets+914,0,0,
-  0,0,funcBuckets+915,0,0,0,0,0,
-  0,0,0,funcBuckets+916,funcBuckets+917,0,funcBuckets+918,funcBuckets+919,
-  0,0,funcBuckets+920,0,0,0,0,0,
-  0,0,funcBuckets+921,funcBuckets+922,0,0,0,funcBuckets+923,
-  funcBuckets+924,funcBuckets+925,0,0,0,0,0,0,
-  funcBuckets+926,funcBuckets+927,0,0,0,0,funcBuckets+928,0,
-  0,0,0,0,0,0,funcBuckets+929,funcBuckets+930,
-  0,0,0,0,0,0,funcBuckets+931,0,
-  0,0,0,funcBuckets+932,0,0,0,0,
-  0,funcBuckets+933,0,0,funcBuckets+934,0,0,funcBuckets+935,
-  0,funcBuckets+936,0,funcBuckets+937,0,0,0,0,
-  0,0,funcBuckets+938,0,0,0,0,0,
+  0,0,0,0,0,funcBuckets+911,0,funcBuckets+912,
+  0,0,0,0,funcBuckets+913,0,0,0,
+  funcBuckets+914,0,funcBuckets+915,0,0,0,funcBuckets+916,0,
+  0,0,0,funcBuckets+917,0,funcBuckets+918,0,0,
+  0,0,funcBuckets+919,0,0,0,0,0,
+  0,0,0,funcBuckets+920,funcBuckets+921,0,funcBuckets+922,funcBuckets+923,
+  0,0,funcBuckets+924,0,0,0,0,0,
+  0,0,funcBuckets+925,funcBuckets+926,0,0,0,funcBuckets+927,
+  funcBuckets+928,funcBuckets+929,0,0,0,0,0,0,
+  funcBuckets+930,funcBuckets+931,0,0,0,0,funcBuckets+932,0,
+  0,0,0,0,0,0,funcBuckets+933,funcBuckets+934,
+  0,0,0,0,0,0,funcBuckets+935,0,
+  0,0,0,funcBuckets+936,0,0,0,0,
+  0,funcBuckets+937,0,0,funcBuckets+938,0,0,funcBuckets+939,
+  0,funcBuckets+940,0,funcBuckets+941,0,0,0,0,
+  0,0,funcBuckets+942,0,0,0,0,0,
   0,0,0,0,0,0,0,0,
   0,0,0,0,0,0,0,0,
-  funcBuckets+939,0,0,0,funcBuckets+940,0,funcBuckets+941,0,
-  0,funcBuckets+942,0,0,0,0,funcBuckets+943,0,
-  0,0,funcBuckets+945,funcBuckets+946,0,0,0,0,
-  0,0,0,funcBuckets+947,0,0,0,0,
-  0,0,funcBuckets+948,0,0,funcBuckets+949,0,0,
-  0,funcBuckets+951,0,funcBuckets+952,0,0,funcBuckets+953,0,
-  funcBuckets+954,0,0,funcBuckets+955,funcBuckets+956,funcBuckets+957,0,0,
-  0,0,0,funcBuckets+959,funcBuckets+960,0,0,funcBuckets+961,
-  0,0,0,0,0,0,0,funcBuckets+962,
+  funcBuckets+943,0,0,0,funcBuckets+944,0,funcBuckets+945,0,
+  0,funcBuckets+946,0,0,0,0,funcBuckets+947,0,
+  0,0,funcBuckets+949,funcBuckets+950,0,0,0,0,
+  0,0,0,funcBuckets+951,0,0,0,0,
+  0,0,funcBuckets+952,0,0,funcBuckets+953,0,0,
+  0,funcBuckets+955,0,funcBuckets+956,0,0,funcBuckets+957,0,
+  funcBuckets+958,0,0,funcBuckets+959,funcBuckets+960,funcBuckets+961,0,0,
+  0,0,0,funcBuckets+963,funcBuckets+964,0,0,funcBuckets+965,
+  0,0,0,0,0,0,0,funcBuckets+966,
   0,0,0,0,0,0,0,0,
-  0,0,funcBuckets+963,0,0,0,funcBuckets+964,0,
+  0,0,funcBuckets+967,0,0,0,funcBuckets+968,0,
   0,0,0,0,0,0,0,0,
-  0,0,0,funcBuckets+965,0,0,0,0,
-  0,0,0,funcBuckets+966,0,funcBuckets+968,0,0,
-  0,funcBuckets+969,funcBuckets+971,0,0,funcBuckets+972,0,funcBuckets+973,
-  0,0,0,0,funcBuckets+974,0,0,funcBuckets+975,
-  0,0,0,0,0,funcBuckets+976,0,funcBuckets+977,
+  0,0,0,funcBuckets+969,0,0,0,0,
+  0,0,0,funcBuckets+970,0,funcBuckets+972,0,0,
+  0,funcBuckets+973,funcBuckets+975,0,0,funcBuckets+976,0,funcBuckets+977,
+  0,0,0,0,funcBuckets+978,0,0,funcBuckets+979,
+  0,0,0,0,0,funcBuckets+980,0,funcBuckets+981,
   0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,funcBuckets+978,0,
-  0,0,0,0,funcBuckets+981,0,0,funcBuckets+982,
-  0,0,funcBuckets+983,funcBuckets+984,0,0,0,0,
-  0,0,funcBuckets+985,0,0,0,0,funcBuckets+987,
-  0,0,0,0,0,0,0,funcBuckets+988,
-  0,funcBuckets+989,0,funcBuckets+990,funcBuckets+991,0,funcBuckets+992,0,
-  0,0,0,0,0,0,funcBuckets+993,0,
+  0,0,0,0,0,0,funcBuckets+982,0,
+  0,0,0,0,funcBuckets+985,0,0,funcBuckets+986,
+  0,0,funcBuckets+987,funcBuckets+988,0,0,0,0,
+  0,0,funcBuckets+989,0,0,0,0,funcBuckets+991,
+  0,0,0,0,0,0,0,funcBuckets+992,
+  0,funcBuckets+993,0,funcBuckets+994,funcBuckets+995,0,funcBuckets+996,0,
+  0,0,0,0,0,0,funcBuckets+997,0,
   0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,funcBuckets+994,
-  0,funcBuckets+995,0,0,0,0,0,0,
-  0,0,0,funcBuckets+996,0,funcBuckets+997,funcBuckets+999,0,
-  funcBuckets+1000,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,funcBuckets+998,
+  0,funcBuckets+999,0,0,0,0,0,0,
+  0,0,0,funcBuckets+1001,0,funcBuckets+1002,funcBuckets+1004,0,
+  funcBuckets+1005,0,0,0,0,0,0,0,
   0,0,0,0,0,0,0,0,
-  0,0,funcBuckets+1001,0,0,funcBuckets+1002,funcBuckets+1003,0,
+  0,0,funcBuckets+1006,0,0,funcBuckets+1007,funcBuckets+1008,0,
   0,0,0,0,0,0,0,0,
-  0,0,funcBuckets+1004,0,0,0,funcBuckets+1005,funcBuckets+1006,
-  0,0,funcBuckets+1007,0,0,funcBuckets+1008,0,funcBuckets+1009,
+  0,0,funcBuckets+1009,0,0,0,funcBuckets+1010,funcBuckets+1011,
+  0,0,funcBuckets+1012,0,0,funcBuckets+1013,0,funcBuckets+1014,
   0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,funcBuckets+1011,
-  0,0,funcBuckets+1012,0,0,0,0,0,
-  funcBuckets+1013,0,0,funcBuckets+1014,funcBuckets+1015,0,0,funcBuckets+1017,
-  0,0,0,0,funcBuckets+1018,0,0,0,
-  0,0,funcBuckets+1019,0,0,0,0,funcBuckets+1020,
-  0,0,0,funcBuckets+1021,0,0,0,0,
-  0,0,funcBuckets+1022,funcBuckets+1023,funcBuckets+1024,0,0,0,
-  funcBuckets+1025,0,0,0,0,funcBuckets+1026,0,0,
-  0,0,0,funcBuckets+1027,0,0,funcBuckets+1029,0,
-  funcBuckets+1030,0,funcBuckets+1031,funcBuckets+1032,0,0,0,0,
-  0,funcBuckets+1033,0,funcBuckets+1034,funcBuckets+1035,0,0,0,
-  funcBuckets+1036,0,0,0,0,0,funcBuckets+1037,funcBuckets+1038,
-  0,0,funcBuckets+1040,0,0,0,funcBuckets+1041,0,
-  funcBuckets+1042,0,funcBuckets+1043,0,funcBuckets+1044,0,0,0,
-  0,0,0,0,funcBuckets+1045,0,0,funcBuckets+1046,
-  0,0,funcBuckets+1048,funcBuckets+1049,0,0,0,funcBuckets+1050,
+  0,0,0,0,0,0,0,funcBuckets+1016,
+  0,0,funcBuckets+1017,0,0,0,0,0,
+  funcBuckets+1018,0,0,funcBuckets+1019,funcBuckets+1020,0,0,funcBuckets+1022,
+  0,0,0,0,funcBuckets+1023,0,0,0,
+  0,0,funcBuckets+1024,0,0,0,0,funcBuckets+1025,
+  0,0,0,funcBuckets+1026,0,0,0,0,
+  0,0,funcBuckets+1027,funcBuckets+1028,funcBuckets+1029,0,0,0,
+  funcBuckets+1030,0,0,0,0,funcBuckets+1031,0,0,
+  0,0,0,funcBuckets+1032,0,0,funcBuckets+1034,0,
+  funcBuckets+1035,0,funcBuckets+1036,funcBuckets+1037,0,0,0,0,
+  0,funcBuckets+1038,0,funcBuckets+1039,funcBuckets+1040,0,0,0,
+  funcBuckets+1041,0,0,0,0,0,funcBuckets+1042,funcBuckets+1043,
+  0,0,funcBuckets+1045,0,0,0,funcBuckets+1046,0,
+  funcBuckets+1047,0,funcBuckets+1048,0,funcBuckets+1049,0,0,0,
+  0,0,0,0,funcBuckets+1050,0,0,funcBuckets+1051,
+  0,0,funcBuckets+1053,funcBuckets+1054,0,0,0,funcBuckets+1055,
   0,0,0,0,0,0,0,0,
-  0,0,funcBuckets+1051,0,0,0,0,0,
-  0,0,0,funcBuckets+1052,funcBuckets+1053,0,0,funcBuckets+1054,
-  funcBuckets+1055,0,0,funcBuckets+1056,0,funcBuckets+1058,funcBuckets+1059,funcBuckets+1060,
-  funcBuckets+1061,0,funcBuckets+1062,0,0,0,0,0,
+  0,0,funcBuckets+1056,0,0,0,0,0,
+  0,0,0,funcBuckets+1057,funcBuckets+1058,0,0,funcBuckets+1059,
+  funcBuckets+1060,0,0,funcBuckets+1061,0,funcBuckets+1063,funcBuckets+1064,funcBuckets+1065,
+  funcBuckets+1066,0,funcBuckets+1067,0,0,0,0,0,
   0,0,0,0,0,0,0,0,
-  0,funcBuckets+1063,0,0,0,0,0,0,
-  funcBuckets+1065,funcBuckets+1066,0,0,funcBuckets+1068,0,0,0,
-  0,0,0,0,0,funcBuckets+1069,0,0,
-  0,0,0,funcBuckets+1071,0,funcBuckets+1072,0,0,
-  funcBuckets+1073,funcBuckets+1074,0,funcBuckets+1075,0,0,funcBuckets+1076,0,
-  0,0,0,0,0,funcBuckets+1077,0,funcBuckets+1078,
-  0,funcBuckets+1079,0,0,0,funcBuckets+1080,0,0,
+  0,funcBuckets+1068,0,0,0,0,0,0,
+  funcBuckets+1070,funcBuckets+1071,0,0,funcBuckets+1073,0,0,0,
+  0,0,0,0,0,funcBuckets+1074,0,0,
+  0,0,0,funcBuckets+1076,0,funcBuckets+1077,0,0,
+  funcBuckets+1078,funcBuckets+1079,0,funcBuckets+1080,0,0,funcBuckets+1081,0,
+  0,0,0,0,0,funcBuckets+1082,0,funcBuckets+1083,
+  0,funcBuckets+1084,0,0,0,funcBuckets+1085,0,0,
   0,0,0,0,0,0,0,0,
-  0,0,0,0,0,funcBuckets+1081,0,0,
-  funcBuckets+1082,0,0,0,0,0,0,funcBuckets+1084,
-  0,0,0,0,0,funcBuckets+1085,0,0,
-  0,0,0,0,0,0,0,0,
-  funcBuckets+1087,0,0,funcBuckets+1088,0,0,funcBuckets+1089,0,
+  0,0,0,0,0,funcBuckets+1086,0,0,
+  funcBuckets+1087,0,0,0,0,0,0,funcBuckets+1089,
   0,0,0,0,0,funcBuckets+1090,0,0,
-  0,0,0,0,0,0,0,funcBuckets+1091,
-  funcBuckets+1093,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,funcBuckets+1094,0,
-  0,0,funcBuckets+1095,0,0,funcBuckets+1096,0,funcBuckets+1097,
-  funcBuckets+1098,0,funcBuckets+1099,0,0,0,0,0,
-  0,0,0,0,funcBuckets+1100,0,0,0,
-  0,0,0,funcBuckets+1101,0,0,0,0,
-  0,0,0,funcBuckets+1103,0,0,0,0,
   0,0,0,0,0,0,0,0,
-  0,0,0,0,0,funcBuckets+1104,funcBuckets+1105,0,
-  0,0,0,funcBuckets+1106,funcBuckets+1107,0,0,funcBuckets+1108,
-  0,0,funcBuckets+1109,0,funcBuckets+1110,0,0,0,
-  0,funcBuckets+1111,0,0,0,0,0,0,
-  funcBuckets+1112,0,0,0,funcBuckets+1113,0,funcBuckets+1114,0,
-  0,0,0,0,funcBuckets+1115,0,funcBuckets+1116,0,
-  0,0,0,0,0,0,0,funcBuckets+1117,
-  funcBuckets+1118,0,0,funcBuckets+1120,0,funcBuckets+1121,0,0,
-  0,0,0,funcBuckets+1123,0,0,0,0,
-  0,0,0,0,funcBuckets+1124,0,0,0,
-  0,0,0,0,0,0,funcBuckets+1125,funcBuckets+1126,
-  0,0,funcBuckets+1127,0,funcBuckets+1128,funcBuckets+1129,0,0,
-  0,0,funcBuckets+1130,0,funcBuckets+1131,0,0,0,
-  funcBuckets+1132,funcBuckets+1133,funcBuckets+1134,0,0,funcBuckets+1135,0,0,
-  0,0,0,0,funcBuckets+1136,0,0,0,
-  0,0,funcBuckets+1137,funcBuckets+1138,0,funcBuckets+1139,funcBuckets+1140,0,
-  funcBuckets+1142,funcBuckets+1143,0,0,0,0,0,0,
-  0,0,0,0,0,funcBuckets+1145,0,0,
-  0,funcBuckets+1146,0,funcBuckets+1147,funcBuckets+1148,0,0,0,
-  0,0,0,funcBuckets+1149,0,0,0,0,
-  0,funcBuckets+1150,0,0,0,funcBuckets+1151,0,0,
-  0,0,funcBuckets+1152,funcBuckets+1153,0,0,funcBuckets+1154,0,
-  0,0,0,funcBuckets+1155,0,funcBuckets+1156,funcBuckets+1157,funcBuckets+1158,
-  funcBuckets+1159,0,0,funcBuckets+1160,0,0,0,0,
-  0,0,0,0,funcBuckets+1161,0,0,0,
-  0,0,funcBuckets+1163,0,0,0,0,0,
-  0,funcBuckets+1165,0,funcBuckets+1166,0,0,funcBuckets+1167,0,
-  0,0,funcBuckets+1168,0,0,0,funcBuckets+1169,funcBuckets+1170,
-  0,0,0,0,funcBuckets+1171,funcBuckets+1172,0,0,
-  0,funcBuckets+1173,0,0,0,0,0,0,
-  0,0,0,funcBuckets+1174,0,0,0,0,
-  0,funcBuckets+1175,0,0,0,0,funcBuckets+1176,funcBuckets+1177,
-  0,0,0,funcBuckets+1178,0,0,0,funcBuckets+1179,
-  0,0,funcBuckets+1180,0,0,0,0,0,
-  0,0,0,0,0,0,0,funcBuckets+1181,
+  funcBuckets+1092,0,0,funcBuckets+1093,0,0,funcBuckets+1094,0,
+  0,0,0,0,0,funcBuckets+1095,0,0,
+  0,0,0,0,0,0,0,funcBuckets+1096,
+  funcBuckets+1098,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,funcBuckets+1099,0,
+  0,0,funcBuckets+1100,0,0,funcBuckets+1101,0,funcBuckets+1102,
+  funcBuckets+1103,0,funcBuckets+1104,0,0,0,0,0,
+  0,0,0,0,funcBuckets+1105,0,0,0,
+  0,0,0,funcBuckets+1106,0,0,0,0,
+  0,0,0,funcBuckets+1108,0,0,0,0,
   0,0,0,0,0,0,0,0,
-  0,0,0,funcBuckets+1182,0,funcBuckets+1183,0,0,
-  0,0,0,funcBuckets+1184,0,0,0,0,
-  funcBuckets+1185,0,0,0,funcBuckets+1186,0,0,funcBuckets+1188,
-  0,0,0,0,0,0,funcBuckets+1189,funcBuckets+1190,
-  funcBuckets+1191,0,0,0,0,funcBuckets+1192,0,funcBuckets+1193,
+  0,0,0,0,0,funcBuckets+1109,funcBuckets+1110,0,
+  0,0,0,funcBuckets+1111,funcBuckets+1112,0,0,funcBuckets+1113,
+  0,0,funcBuckets+1114,0,funcBuckets+1115,0,0,0,
+  0,funcBuckets+1116,0,0,0,0,0,0,
+  funcBuckets+1117,0,0,0,funcBuckets+1118,0,funcBuckets+1119,0,
+  0,0,0,0,funcBuckets+1120,0,funcBuckets+1121,0,
+  0,0,0,0,0,0,0,funcBuckets+1122,
+  funcBuckets+1123,0,0,funcBuckets+1125,0,funcBuckets+1126,0,0,
+  0,0,0,funcBuckets+1128,0,0,0,0,
+  0,0,0,0,funcBuckets+1129,0,0,0,
+  0,0,0,0,0,0,funcBuckets+1130,funcBuckets+1131,
+  0,0,funcBuckets+1132,0,funcBuckets+1133,funcBuckets+1134,0,0,
+  0,0,funcBuckets+1135,0,funcBuckets+1136,0,0,0,
+  funcBuckets+1137,funcBuckets+1138,funcBuckets+1139,0,0,funcBuckets+1140,0,0,
+  0,0,0,0,funcBuckets+1141,0,0,0,
+  0,0,funcBuckets+1142,funcBuckets+1143,0,funcBuckets+1144,funcBuckets+1145,0,
+  funcBuckets+1147,funcBuckets+1148,0,0,0,0,0,0,
+  0,0,0,0,0,funcBuckets+1150,0,0,
+  0,funcBuckets+1151,0,funcBuckets+1152,funcBuckets+1153,0,0,0,
+  0,0,0,funcBuckets+1154,0,0,0,0,
+  0,funcBuckets+1155,0,0,0,funcBuckets+1156,0,0,
+  0,0,funcBuckets+1157,funcBuckets+1158,0,0,funcBuckets+1159,0,
+  0,0,0,funcBuckets+1160,0,funcBuckets+1161,funcBuckets+1162,funcBuckets+1163,
+  funcBuckets+1164,0,0,funcBuckets+1165,0,0,0,0,
+  0,0,0,0,funcBuckets+1166,0,0,0,
+  0,0,funcBuckets+1168,0,0,0,0,0,
+  0,funcBuckets+1170,0,funcBuckets+1171,0,0,funcBuckets+1172,0,
+  0,0,funcBuckets+1173,0,0,0,funcBuckets+1174,funcBuckets+1175,
+  0,0,0,0,funcBuckets+1176,funcBuckets+1177,0,0,
+  0,funcBuckets+1178,0,0,0,0,0,0,
+  0,0,0,funcBuckets+1179,0,0,0,0,
+  0,funcBuckets+1180,0,0,0,0,funcBuckets+1181,funcBuckets+1182,
+  0,0,0,funcBuckets+1183,0,0,0,funcBuckets+1184,
+  0,0,funcBuckets+1185,0,0,0,0,0,
+  0,0,0,0,0,0,0,funcBuckets+1186,
   0,0,0,0,0,0,0,0,
-  0,0,0,funcBuckets+1195,0,0,0,0,
-  0,0,0,0,0,0,funcBuckets+1197,0,
-  0,0,0,0,0,0,funcBuckets+1199,0,
-  0,funcBuckets+1200,0,0,funcBuckets+1201,funcBuckets+1202,0,0,
-  0,0,0,funcBuckets+1203,0,0,0,funcBuckets+1204,
-  0,0,0,0,funcBuckets+1205,0,0,0,
-  0,0,0,0,funcBuckets+1206,funcBuckets+1207,0,0,
-  funcBuckets+1208,0,funcBuckets+1209,0,0,0,funcBuckets+1210,0,
-  0,0,0,0,funcBuckets+1211,0,0,0,
-  0,0,0,funcBuckets+1212,0,0,funcBuckets+1213,0,
-  0,0,funcBuckets+1214,0,0,0,0,funcBuckets+1215,
-  funcBuckets+1216,0,0,0,0,0,0,0,
-  0,funcBuckets+1217,0,0,0,0,0,0,
-  0,0,funcBuckets+1218,0,0,funcBuckets+1219,0,0,
-  funcBuckets+1220,0,0,funcBuckets+1221,0,0,0,0,
-  0,0,0,funcBuckets+1222,0,funcBuckets+1223,0,0,
-  0,funcBuckets+1224,0,0,0,0,0,0,
-  0,0,0,0,0,funcBuckets+1225,0,0,
-  0,funcBuckets+1226,0,0,0,funcBuckets+1227,funcBuckets+1228,0,
-  0,funcBuckets+1229,funcBuckets+1230,funcBuckets+1232,0,0,funcBuckets+1234,0,
-  0,0,0,0,0,funcBuckets+1235,funcBuckets+1236,0,
-  0,0,0,0,0,funcBuckets+1237,0,0,
-  0,0,0,0,0,funcBuckets+1238,funcBuckets+1239,0,
-  0,funcBuckets+1240,0,0,0,funcBuckets+1243,0,0,
-  0,0,0,0,0,funcBuckets+1244,funcBuckets+1245,0,
-  funcBuckets+1246,0,funcBuckets+1247,0,0,funcBuckets+1248,0,0,
-  0,0,0,funcBuckets+1249,funcBuckets+1251,0,0,0,
-  0,0,0,0,funcBuckets+1252,0,0,0,
-  funcBuckets+1253,0,0,0,0,0,funcBuckets+1254,0,
+  0,0,0,funcBuckets+1187,0,funcBuckets+1188,0,0,
+  0,0,0,funcBuckets+1189,0,0,0,0,
+  funcBuckets+1190,0,0,0,funcBuckets+1191,0,0,funcBuckets+1193,
+  0,0,0,0,0,0,funcBuckets+1194,funcBuckets+1195,
+  funcBuckets+1196,0,0,0,0,funcBuckets+1197,0,funcBuckets+1198,
   0,0,0,0,0,0,0,0,
-  0,0,0,funcBuckets+1255,funcBuckets+1256,0,0,0,
-  0,0,funcBuckets+1257,0,0,0,0,funcBuckets+1259,
-  funcBuckets+1260,0,0,0,0,0,0,funcBuckets+1261,
-  0,0,0,funcBuckets+1262,funcBuckets+1263,0,0,funcBuckets+1264,
-  funcBuckets+1265,0,0,0,0,funcBuckets+1266,0,0,
-  0,0,0,0,funcBuckets+1267,0,0,funcBuckets+1268,
-  0,0,0,funcBuckets+1269,0,0,funcBuckets+1270,0,
-  0,0,0,0,0,funcBuckets+1271,0,0,
-  funcBuckets+1272,funcBuckets+1273,0,funcBuckets+1274,0,funcBuckets+1275,funcBuckets+1277,0,
-  0,funcBuckets+1278,0,0,0,0,0,0,
-  0,funcBuckets+1279,funcBuckets+1280,0,0,0,funcBuckets+1281,funcBuckets+1282,
-  funcBuckets+1283,0,0,0,0,0,0,funcBuckets+1284,
-  0,0,0,funcBuckets+1285,0,0,0,0,
-  funcBuckets+1286,0,0,0,0,0,funcBuckets+1287,0,
-  0,funcBuckets+1289,0,0,0,0,0,funcBuckets+1290,
-  0,0,funcBuckets+1291,funcBuckets+1292,0,funcBuckets+1294,0,0,
+  0,0,0,funcBuckets+1200,0,0,0,0,
+  0,0,0,0,0,0,funcBuckets+1202,0,
+  0,0,0,0,0,0,funcBuckets+1204,0,
+  0,funcBuckets+1205,0,0,funcBuckets+1206,funcBuckets+1207,0,0,
+  0,0,0,funcBuckets+1208,0,0,0,funcBuckets+1209,
+  0,0,0,0,funcBuckets+1210,0,0,0,
+  0,0,0,0,funcBuckets+1211,funcBuckets+1212,0,0,
+  funcBuckets+1213,0,funcBuckets+1214,0,0,0,funcBuckets+1215,0,
+  0,0,0,0,funcBuckets+1216,0,0,0,
+  0,0,0,funcBuckets+1217,0,0,funcBuckets+1218,0,
+  0,0,funcBuckets+1219,0,0,0,0,funcBuckets+1220,
+  funcBuckets+1221,0,0,0,0,0,0,0,
+  0,funcBuckets+1222,0,0,0,0,0,0,
+  0,0,funcBuckets+1223,0,0,funcBuckets+1224,0,0,
+  funcBuckets+1225,0,0,funcBuckets+1226,0,0,0,0,
+  0,0,0,funcBuckets+1227,0,funcBuckets+1228,0,0,
+  0,funcBuckets+1229,0,0,0,0,0,0,
+  0,0,0,0,0,funcBuckets+1230,0,0,
+  0,funcBuckets+1231,0,0,0,funcBuckets+1232,funcBuckets+1233,0,
+  0,funcBuckets+1234,funcBuckets+1235,funcBuckets+1237,0,0,funcBuckets+1239,0,
+  0,0,0,0,0,funcBuckets+1240,funcBuckets+1241,0,
+  0,0,0,0,0,funcBuckets+1242,0,0,
+  0,0,0,0,0,funcBuckets+1243,funcBuckets+1244,0,
+  0,funcBuckets+1245,0,0,0,funcBuckets+1248,0,0,
+  0,0,0,0,0,funcBuckets+1249,funcBuckets+1250,0,
+  funcBuckets+1251,0,funcBuckets+1252,0,0,funcBuckets+1253,0,0,
+  0,0,0,funcBuckets+1254,funcBuckets+1256,0,0,0,
+  0,0,0,0,funcBuckets+1257,0,0,0,
+  funcBuckets+1258,0,0,0,0,0,funcBuckets+1259,0,
   0,0,0,0,0,0,0,0,
-  funcBuckets+1295,0,0,0,0,funcBuckets+1296,0,0,
-  0,0,0,0,funcBuckets+1297,0,funcBuckets+1298,0,
-  funcBuckets+1299,0,0,0,0,0,0,0,
-  funcBuckets+1300,0,funcBuckets+1301,0,0,0,0,0,
-  0,0,0,funcBuckets+1302,funcBuckets+1303,0,0,funcBuckets+1305,
+  0,0,0,funcBuckets+1260,funcBuckets+1261,0,0,0,
+  0,0,funcBuckets+1262,0,0,0,0,funcBuckets+1264,
+  funcBuckets+1265,0,0,0,0,0,0,funcBuckets+1266,
+  0,0,0,funcBuckets+1267,funcBuckets+1268,0,0,funcBuckets+1269,
+  funcBuckets+1270,0,0,0,0,funcBuckets+1271,0,0,
+  0,0,0,0,funcBuckets+1272,0,0,funcBuckets+1273,
+  0,0,0,funcBuckets+1274,0,0,funcBuckets+1275,0,
+  0,0,0,0,0,funcBuckets+1276,0,0,
+  funcBuckets+1277,funcBuckets+1278,0,funcBuckets+1279,0,funcBuckets+1280,funcBuckets+1282,0,
+  0,funcBuckets+1283,0,0,0,0,0,0,
+  0,funcBuckets+1284,funcBuckets+1285,0,0,0,funcBuckets+1286,funcBuckets+1287,
+  funcBuckets+1288,0,0,0,0,0,0,funcBuckets+1289,
+  0,0,0,funcBuckets+1290,0,0,0,0,
+  funcBuckets+1291,0,0,0,0,0,funcBuckets+1292,0,
+  0,funcBuckets+1294,0,0,0,0,0,funcBuckets+1295,
+  0,0,funcBuckets+1296,funcBuckets+1297,0,funcBuckets+1299,0,0,
   0,0,0,0,0,0,0,0,
+  funcBuckets+1300,0,0,0,0,funcBuckets+1301,0,0,
+  0,0,0,0,funcBuckets+1302,0,funcBuckets+1303,0,
+  funcBuckets+1304,0,0,0,0,0,0,0,
+  funcBuckets+1305,0,funcBuckets+1306,0,0,0,0,0,
+  0,0,0,funcBuckets+1307,funcBuckets+1308,0,0,funcBuckets+1310,
   0,0,0,0,0,0,0,0,
-  0,funcBuckets+1306,funcBuckets+1307,0,0,0,0,0,
-  funcBuckets+1308,0,funcBuckets+1309,funcBuckets+1310,funcBuckets+1311,funcBuckets+1312,funcBuckets+1313,0,
-  0,0,0,funcBuckets+1314,0,0,0,funcBuckets+1315,
-  0,0,0,funcBuckets+1316,0,0,funcBuckets+1317,0,
   0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,funcBuckets+1318,
-  0,0,funcBuckets+1319,0,0,funcBuckets+1320,funcBuckets+1321,0,
+  0,funcBuckets+1311,funcBuckets+1312,0,0,0,0,0,
+  funcBuckets+1313,0,funcBuckets+1314,funcBuckets+1315,funcBuckets+1316,funcBuckets+1317,funcBuckets+1318,0,
+  0,0,0,funcBuckets+1319,0,0,0,funcBuckets+1320,
+  0,0,0,funcBuckets+1321,0,0,funcBuckets+1322,0,
   0,0,0,0,0,0,0,0,
-  funcBuckets+1323,0,0,0,0,0,0,funcBuckets+1325,
-  0,0,0,0,0,0,0,funcBuckets+1326,
-  0,0,0,funcBuckets+1327,funcBuckets+1329,0,0,0,
-  funcBuckets+1330,0,0,0,0,funcBuckets+1331,0,funcBuckets+1332,
-  0,funcBuckets+1333,funcBuckets+1334,0,funcBuckets+1336,0,0,0,
-  0,funcBuckets+1337,0,0,0,0,0,0,
-  0,0,0,0,0,0,funcBuckets+1338,0,
-  0,0,funcBuckets+1339,0,0,0,0,0,
-  0,funcBuckets+1341,0,0,0,0,0,0,
-  funcBuckets+1342,0,0,0,0,0,0,0,
-  0,funcBuckets+1343,0,0,0,0,funcBuckets+1344,0,
-  0,funcBuckets+1345,0,funcBuckets+1346,0,0,0,0,
-  0,funcBuckets+1347,0,0,0,0,0,0,
-  funcBuckets+1348,0,0,0,0,funcBuckets+1349,0,0,
-  0,0,0,0,0,0,funcBuckets+1351,0,
-  0,0,funcBuckets+1352,0,0,0,funcBuckets+1353,0,
-  0,funcBuckets+1354,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,funcBuckets+1323,
+  0,0,funcBuckets+1324,0,0,funcBuckets+1325,funcBuckets+1326,0,
   0,0,0,0,0,0,0,0,
+  funcBuckets+1328,0,0,0,0,0,0,funcBuckets+1330,
+  0,0,0,0,0,0,0,funcBuckets+1331,
+  0,0,0,funcBuckets+1332,funcBuckets+1334,0,0,0,
+  funcBuckets+1335,0,0,0,0,funcBuckets+1336,0,funcBuckets+1337,
+  0,funcBuckets+1338,funcBuckets+1339,0,funcBuckets+1341,0,0,0,
+  0,funcBuckets+1342,0,0,0,0,0,0,
+  0,0,0,0,0,0,funcBuckets+1343,0,
+  0,0,funcBuckets+1344,0,0,0,0,0,
+  0,funcBuckets+1346,0,0,0,0,0,0,
+  funcBuckets+1347,0,0,0,0,0,0,0,
+  0,funcBuckets+1348,0,0,0,0,funcBuckets+1349,0,
+  0,funcBuckets+1350,0,funcBuckets+1351,0,0,0,0,
+  0,funcBuckets+1352,0,0,0,0,0,0,
+  funcBuckets+1353,0,0,0,0,funcBuckets+1354,0,0,
+  0,0,0,0,0,0,funcBuckets+1356,0,
+  0,0,funcBuckets+1357,0,0,0,funcBuckets+1358,0,
+  0,funcBuckets+1359,0,0,0,0,0,0,
   0,0,0,0,0,0,0,0,
-  0,funcBuckets+1355,0,0,0,0,0,0,
-  funcBuckets+1356,0,funcBuckets+1357,0,funcBuckets+1358,0,0,funcBuckets+1359,
-  0,0,0,0,funcBuckets+1360,0,0,0,
-  0,0,0,0,0,funcBuckets+1362,0,0,
-  funcBuckets+1363,0,0,funcBuckets+1364,0,0,0,0,
   0,0,0,0,0,0,0,0,
-  0,0,funcBuckets+1366,0,funcBuckets+1367,0,funcBuckets+1368,0,
-  0,funcBuckets+1369,funcBuckets+1370,0,funcBuckets+1371,funcBuckets+1372,0,0,
-  funcBuckets+1374,0,0,0,funcBuckets+1375,0,funcBuckets+1376,0,
-  0,0,0,funcBuckets+1377,funcBuckets+1378,funcBuckets+1379,funcBuckets+1380,0,
+  0,funcBuckets+1360,0,0,0,0,0,0,
+  funcBuckets+1361,0,funcBuckets+1362,0,funcBuckets+1363,0,0,funcBuckets+1364,
+  0,0,0,0,funcBuckets+1365,0,0,0,
+  0,0,0,0,0,funcBuckets+1367,0,0,
+  funcBuckets+1368,0,0,funcBuckets+1369,0,0,0,0,
   0,0,0,0,0,0,0,0,
-  0,funcBuckets+1381,0,0,0,0,0,0,
-  0,funcBuckets+1382,0,funcBuckets+1383,funcBuckets+1384,0,0,0,
-  0,0,0,0,0,0,funcBuckets+1386,0,
-  0,funcBuckets+1387,funcBuckets+1388,0,0,0,0,funcBuckets+1389,
-  0,0,0,0,0,0,funcBuckets+1391,0,
-  funcBuckets+1393,funcBuckets+1395,funcBuckets+1396,funcBuckets+1397,0,0,0,funcBuckets+1398,
-  0,0,0,0,0,0,0,funcBuckets+1399,
-  0,0,0,0,funcBuckets+1400,funcBuckets+1401,0,0,
+  0,0,funcBuckets+1371,0,funcBuckets+1372,0,funcBuckets+1373,0,
+  0,funcBuckets+1374,funcBuckets+1375,0,funcBuckets+1376,funcBuckets+1377,0,0,
+  funcBuckets+1379,0,0,0,funcBuckets+1380,0,funcBuckets+1381,0,
+  0,0,0,funcBuckets+1382,funcBuckets+1383,funcBuckets+1384,funcBuckets+1385,0,
   0,0,0,0,0,0,0,0,
-  0,0,0,0,0,funcBuckets+1402,funcBuckets+1403,0,
-  0,0,0,0,funcBuckets+1404,0,0,0,
-  funcBuckets+1405,0,0,funcBuckets+1406,funcBuckets+1407,0,funcBuckets+1408,0,
-  0,funcBuckets+1409,0,0,funcBuckets+1410,funcBuckets+1411,0,0,
-  0,funcBuckets+1412,funcBuckets+1413,0,0,0,funcBuckets+1414,0,
+  0,funcBuckets+1386,0,0,0,0,0,0,
+  0,funcBuckets+1387,0,funcBuckets+1388,funcBuckets+1389,0,0,0,
+  0,0,0,0,0,0,funcBuckets+1391,0,
+  0,funcBuckets+1392,funcBuckets+1393,0,0,0,0,funcBuckets+1394,
+  0,0,0,0,0,0,funcBuckets+1396,0,
+  funcBuckets+1398,funcBuckets+1400,funcBuckets+1401,funcBuckets+1402,0,0,0,funcBuckets+1403,
+  0,0,0,0,0,0,0,funcBuckets+1404,
+  0,0,0,0,funcBuckets+1405,funcBuckets+1406,0,0,
   0,0,0,0,0,0,0,0,
-  0,0,funcBuckets+1415,0,0,0,0,0,
+  0,0,0,0,0,funcBuckets+1407,funcBuckets+1408,0,
+  0,0,0,0,funcBuckets+1409,0,0,0,
+  funcBuckets+1410,0,0,funcBuckets+1411,funcBuckets+1412,0,funcBuckets+1413,0,
+  0,funcBuckets+1414,0,0,funcBuckets+1415,funcBuckets+1416,0,0,
+  0,funcBuckets+1417,funcBuckets+1418,0,0,0,funcBuckets+1419,0,
   0,0,0,0,0,0,0,0,
-  0,0,0,funcBuckets+1416,0,0,0,funcBuckets+1417,
-  0,0,0,funcBuckets+1418,0,funcBuckets+1420,0,funcBuckets+1421,
-  0,0,0,0,0,funcBuckets+1422,0,0,
-  funcBuckets+1423,0,0,0,0,funcBuckets+1424,0,0,
-  0,funcBuckets+1425,0,funcBuckets+1426,0,funcBuckets+1427,0,0,
-  0,funcBuckets+1430,funcBuckets+1431,0,0,0,0,0,
-  0,funcBuckets+1432,0,0,0,0,0,0,
-  0,funcBuckets+1433,funcBuckets+1434,0,0,0,0,funcBuckets+1435,
-  funcBuckets+1436,0,funcBuckets+1438,0,0,0,0,0,
+  0,0,funcBuckets+1420,0,0,0,0,0,
   0,0,0,0,0,0,0,0,
-  0,0,0,0,0,funcBuckets+1439,0,0,
-  0,0,0,0,0,0,funcBuckets+1440,0,
-  funcBuckets+1441,0,funcBuckets+1442,0,0,0,0,0,
-  funcBuckets+1444,0,0,0,0,funcBuckets+1445,0,0,
-  funcBuckets+1446,0,funcBuckets+1448,0,funcBuckets+1449,0,0,0,
-  0,0,0,0,0,0,funcBuckets+1450,0,
+  0,0,0,funcBuckets+1421,0,0,0,funcBuckets+1422,
+  0,0,0,funcBuckets+1423,0,funcBuckets+1425,0,funcBuckets+1426,
+  0,0,0,0,0,funcBuckets+1427,0,0,
+  funcBuckets+1428,0,0,0,0,funcBuckets+1429,0,0,
+  0,funcBuckets+1430,0,funcBuckets+1431,0,funcBuckets+1432,0,0,
+  0,funcBuckets+1435,funcBuckets+1436,0,0,0,0,0,
+  0,funcBuckets+1437,0,0,0,0,0,0,
+  0,funcBuckets+1438,funcBuckets+1439,0,0,0,0,funcBuckets+1440,
+  funcBuckets+1441,0,funcBuckets+1443,0,0,0,0,0,
   0,0,0,0,0,0,0,0,
-  0,funcBuckets+1451,0,0,funcBuckets+1452,0,0,0,
-  0,0,funcBuckets+1453,0,funcBuckets+1454,0,funcBuckets+1455,0,
-  0,funcBuckets+1456,0,0,0,0,0,0,
-  0,0,0,0,0,funcBuckets+1457,0,0,
-  0,0,0,0,funcBuckets+1458,0,0,0,
-  funcBuckets+1459,0,funcBuckets+1460,0,0,0,funcBuckets+1461,funcBuckets+1462,
-  0,funcBuckets+1463,0,0,0,0,0,0,
-  0,0,0,0,funcBuckets+1464,funcBuckets+1465,0,0,
-  funcBuckets+1466,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,funcBuckets+1467,0,
-  0,0,funcBuckets+1468,0,funcBuckets+1469,funcBuckets+1470,0,funcBuckets+1471,
-  funcBuckets+1472,0,0,funcBuckets+1473,0,funcBuckets+1474,0,funcBuckets+1477,
-  0,funcBuckets+1478,funcBuckets+1479,funcBuckets+1480,0,0,0,0,
-  0,0,funcBuckets+1481,0,0,0,0,0,
-  0,0,funcBuckets+1483,0,0,funcBuckets+1484,funcBuckets+1486,0,
-  funcBuckets+1488,0,0,0,funcBuckets+1490,funcBuckets+1491,0,funcBuckets+1492,
-  0,0,0,0,funcBuckets+1494,funcBuckets+1495,0,funcBuckets+1496,
-  0,0,0,funcBuckets+1497,0,0,funcBuckets+1500,0,
-  0,0,0,0,0,0,funcBuckets+1501,0,
-  0,0,0,0,funcBuckets+1502,funcBuckets+1503,0,0,
-  0,0,0,0,0,0,funcBuckets+1504,0,
-  0,funcBuckets+1505,funcBuckets+1506,0,0,0,0,0,
-  0,funcBuckets+1507,funcBuckets+1508,0,funcBuckets+1510,funcBuckets+1512,funcBuckets+1516,funcBuckets+1517,
-  funcBuckets+1518,0,0,funcBuckets+1519,0,0,funcBuckets+1520,0,
-  funcBuckets+1522,funcBuckets+1523,0,funcBuckets+1524,0,funcBuckets+1525,funcBuckets+1526,0,
-  0,0,0,0,0,0,funcBuckets+1527,0,
-  0,funcBuckets+1528,0,0,0,0,0,0,
-  0,0,0,funcBuckets+1529,0,0,funcBuckets+1530,0,
-  0,funcBuckets+1531,0,0,0,0,funcBuckets+1532,0,
-  0,0,0,funcBuckets+1534,funcBuckets+1535,0,0,0,
-  0,0,0,0,funcBuckets+1536,0,0,funcBuckets+1537,
-  0,0,0,0,funcBuckets+1538,funcBuckets+1540,funcBuckets+1542,0,
-  0,0,0,0,funcBuckets+1543,0,0,0,
-  funcBuckets+1545,0,0,0,0,0,0,funcBuckets+1546,
-  0,0,funcBuckets+1547,funcBuckets+1548,0,0,funcBuckets+1549,0,
-  funcBuckets+1550,0,funcBuckets+1551,0,0,0,0,0,
-  0,funcBuckets+1553,0,0,0,0,0,funcBuckets+1554,
-  0,0,0,funcBuckets+1555,0,0,0,0,
-  0,0,0,funcBuckets+1556,0,0,0,0,
-  0,0,0,0,0,0,funcBuckets+1557,0,
-  0,0,funcBuckets+1558,funcBuckets+1559,0,0,0,funcBuckets+1560,
-  funcBuckets+1561,0,0,0,0,0,funcBuckets+1563,0,
-  0,0,0,0,funcBuckets+1564,0,0,0,
-  0,0,0,0,0,0,funcBuckets+1565,0,
+  0,0,0,0,0,funcBuckets+1444,0,0,
+  0,0,0,0,0,0,funcBuckets+1445,0,
+  funcBuckets+1446,0,funcBuckets+1447,0,0,0,0,0,
+  funcBuckets+1449,0,0,0,0,funcBuckets+1450,0,0,
+  funcBuckets+1451,0,funcBuckets+1453,0,funcBuckets+1454,0,0,0,
+  0,0,0,0,0,0,funcBuckets+1455,0,
   0,0,0,0,0,0,0,0,
-  funcBuckets+1566,funcBuckets+1567,0,0,0,funcBuckets+1568,funcBuckets+1569,0,
-  0,funcBuckets+1570,funcBuckets+1571,0,0,funcBuckets+1572,0,0,
-  0,0,0,0,funcBuckets+1573,0,funcBuckets+1574,0,
-  funcBuckets+1575,0,0,funcBuckets+1576,0,funcBuckets+1577,funcBuckets+1578,0,
-  0,0,0,0,0,funcBuckets+1579,0,0,
-  0,0,0,funcBuckets+1580,0,0,0,0,
-  0,0,0,0,funcBuckets+1581,0,0,0,
-  0,0,0,0,funcBuckets+1582,0,funcBuckets+1583,0,
-  0,0,funcBuckets+1584,0,0,0,0,0,
-  0,0,0,0,0,0,funcBuckets+1585,0,
+  0,funcBuckets+1456,0,0,funcBuckets+1457,0,0,0,
+  0,0,funcBuckets+1458,0,funcBuckets+1459,0,funcBuckets+1460,0,
+  0,funcBuckets+1461,0,0,0,0,0,0,
+  0,0,0,0,0,funcBuckets+1462,0,0,
+  0,0,0,0,funcBuckets+1463,0,0,0,
+  funcBuckets+1464,0,funcBuckets+1465,0,0,0,funcBuckets+1466,funcBuckets+1467,
+  0,funcBuckets+1468,0,0,0,0,0,0,
+  0,0,0,0,funcBuckets+1469,funcBuckets+1470,0,0,
+  funcBuckets+1471,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,funcBuckets+1472,0,
+  0,0,funcBuckets+1473,0,funcBuckets+1474,funcBuckets+1475,0,funcBuckets+1476,
+  funcBuckets+1477,0,0,funcBuckets+1478,0,funcBuckets+1479,0,funcBuckets+1482,
+  0,funcBuckets+1483,funcBuckets+1484,funcBuckets+1485,0,0,0,0,
+  0,0,funcBuckets+1486,0,0,0,0,0,
+  0,0,funcBuckets+1488,0,0,funcBuckets+1489,funcBuckets+1491,0,
+  funcBuckets+1493,0,0,0,funcBuckets+1495,funcBuckets+1496,0,funcBuckets+1497,
+  0,0,0,0,funcBuckets+1499,funcBuckets+1500,0,funcBuckets+1501,
+  0,0,0,funcBuckets+1502,0,0,funcBuckets+1505,0,
+  0,0,0,0,0,0,funcBuckets+1506,0,
+  0,0,0,0,funcBuckets+1507,funcBuckets+1508,0,0,
+  0,0,0,0,0,0,funcBuckets+1509,0,
+  0,funcBuckets+1510,funcBuckets+1511,0,0,0,funcBuckets+1512,0,
+  0,funcBuckets+1513,funcBuckets+1514,0,funcBuckets+1516,funcBuckets+1518,funcBuckets+1522,funcBuckets+1523,
+  funcBuckets+1524,0,0,funcBuckets+1525,0,0,funcBuckets+1526,0,
+  funcBuckets+1528,funcBuckets+1529,0,funcBuckets+1530,0,funcBuckets+1531,funcBuckets+1532,0,
+  0,0,0,0,0,0,funcBuckets+1533,0,
+  0,funcBuckets+1534,0,0,0,0,0,0,
+  0,0,0,funcBuckets+1535,0,0,funcBuckets+1536,0,
+  0,funcBuckets+1537,0,0,0,0,funcBuckets+1538,0,
+  0,0,0,funcBuckets+1540,funcBuckets+1541,0,0,0,
+  0,0,0,0,funcBuckets+1542,0,0,funcBuckets+1543,
+  0,0,0,0,funcBuckets+1544,funcBuckets+1546,funcBuckets+1548,0,
+  0,0,0,0,funcBuckets+1549,0,0,0,
+  funcBuckets+1551,0,0,0,0,0,0,funcBuckets+1552,
+  0,0,funcBuckets+1553,funcBuckets+1554,0,0,funcBuckets+1555,0,
+  funcBuckets+1556,0,funcBuckets+1557,0,0,0,0,0,
+  0,funcBuckets+1559,0,0,0,0,0,funcBuckets+1560,
+  0,0,0,funcBuckets+1561,0,0,0,0,
+  0,0,0,funcBuckets+1562,0,0,0,0,
+  0,0,0,0,0,0,funcBuckets+1563,0,
+  0,0,funcBuckets+1564,funcBuckets+1565,0,0,0,funcBuckets+1566,
+  funcBuckets+1567,0,0,0,0,0,funcBuckets+1569,0,
+  0,0,0,0,funcBuckets+1570,0,0,0,
+  0,0,0,0,0,0,funcBuckets+1571,0,
   0,0,0,0,0,0,0,0,
-  funcBuckets+1586,funcBuckets+1587,0,funcBuckets+1588,0,0,0,0,
-  0,funcBuckets+1589,0,0,0,0,funcBuckets+1590,0,
+  funcBuckets+1572,funcBuckets+1573,0,0,0,funcBuckets+1574,funcBuckets+1575,0,
+  0,funcBuckets+1576,funcBuckets+1577,funcBuckets+1578,0,funcBuckets+1579,0,0,
+  0,0,0,0,funcBuckets+1580,0,funcBuckets+1581,0,
+  funcBuckets+1582,0,0,funcBuckets+1583,0,funcBuckets+1584,funcBuckets+1585,0,
+  0,0,0,0,0,funcBuckets+1586,0,0,
+  0,0,0,funcBuckets+1587,0,0,0,0,
+  0,0,0,0,funcBuckets+1588,0,0,0,
+  0,0,0,0,funcBuckets+1589,0,funcBuckets+1590,0,
   0,0,funcBuckets+1591,0,0,0,0,0,
-  0,0,0,0,0,0,0,funcBuckets+1592,
-  0,0,0,0,funcBuckets+1593,funcBuckets+1594,0,0,
-  funcBuckets+1595,0,funcBuckets+1597,0,0,0,funcBuckets+1598,0,
-  0,0,0,0,funcBuckets+1599,0,0,0,
-  0,0,funcBuckets+1600,funcBuckets+1601,0,0,0,0,
-  0,0,0,funcBuckets+1602,0,0,0,0,
-  0,funcBuckets+1603,0,0,0,funcBuckets+1604,0,0,
-  0,0,funcBuckets+1606,funcBuckets+1607,0,0,0,0,
-  0,0,funcBuckets+1608,0,0,funcBuckets+1609,0,0,
-  0,funcBuckets+1610,0,0,funcBuckets+1611,0,0,0,
-  0,0,0,funcBuckets+1612,0,funcBuckets+1614,0,0,
-  0,0,funcBuckets+1615,funcBuckets+1616,0,0,0,funcBuckets+1617,
-  funcBuckets+1618,0,0,0,0,0,0,0,
-  0,0,0,0,funcBuckets+1619,0,funcBuckets+1620,0,
-  0,0,funcBuckets+1621,funcBuckets+1622,0,0,0,0,
-  0,0,0,0,funcBuckets+1623,funcBuckets+1624,funcBuckets+1625,funcBuckets+1626,
+  0,0,0,0,0,0,funcBuckets+1592,0,
   0,0,0,0,0,0,0,0,
-  funcBuckets+1627,0,0,0,0,0,funcBuckets+1628,0,
-  funcBuckets+1629,0,0,0,funcBuckets+1630,0,0,0,
+  funcBuckets+1593,funcBuckets+1594,0,funcBuckets+1595,0,0,0,0,
+  0,funcBuckets+1596,0,0,0,0,funcBuckets+1597,0,
+  0,0,funcBuckets+1598,0,0,0,0,0,
+  0,0,0,0,0,0,0,funcBuckets+1599,
+  0,0,0,0,funcBuckets+1600,funcBuckets+1601,0,0,
+  funcBuckets+1602,0,funcBuckets+1604,0,0,0,funcBuckets+1605,0,
+  0,0,0,0,funcBuckets+1606,0,0,0,
+  0,0,funcBuckets+1607,funcBuckets+1608,0,0,0,0,
+  0,0,0,funcBuckets+1609,0,0,0,0,
+  0,funcBuckets+1610,0,0,0,funcBuckets+1611,0,0,
+  0,0,funcBuckets+1613,funcBuckets+1614,0,0,0,0,
+  0,0,funcBuckets+1615,0,0,funcBuckets+1616,0,0,
+  0,funcBuckets+1617,0,0,funcBuckets+1618,0,0,0,
+  0,0,0,funcBuckets+1619,0,funcBuckets+1621,0,0,
+  0,0,funcBuckets+1622,funcBuckets+1623,0,0,0,funcBuckets+1624,
+  funcBuckets+1625,0,0,0,0,0,0,0,
+  0,0,0,0,funcBuckets+1626,0,funcBuckets+1627,0,
+  0,0,funcBuckets+1628,funcBuckets+1629,0,0,0,0,
+  0,0,0,0,funcBuckets+1630,funcBuckets+1631,funcBuckets+1632,funcBuckets+1633,
   0,0,0,0,0,0,0,0,
-  0,0,0,funcBuckets+1631,0,0,0,funcBuckets+1633,
-  funcBuckets+1634,0,0,funcBuckets+1635,funcBuckets+1636,funcBuckets+1637,0,funcBuckets+1638,
-  0,0,0,0,funcBuckets+1639,0,funcBuckets+1640,0,
-  0,funcBuckets+1641,0,0,0,funcBuckets+1642,0,funcBuckets+1643,
-  0,funcBuckets+1644,0,0,0,0,0,0,
-  funcBuckets+1645,0,0,funcBuckets+1646,0,0,funcBuckets+1647,funcBuckets+1648,
+  funcBuckets+1634,0,0,0,0,0,funcBuckets+1635,0,
+  funcBuckets+1636,0,0,0,funcBuckets+1637,0,0,0,
   0,0,0,0,0,0,0,0,
-  funcBuckets+1649,funcBuckets+1650,0,funcBuckets+1651,0,funcBuckets+1652,0,0,
-  0,0,0,0,funcBuckets+1653,0,0,0,
-  funcBuckets+1654,funcBuckets+1655,0,0,0,funcBuckets+1656,0,0,
-  0,0,funcBuckets+1657,0,0,funcBuckets+1658,0,0,
-  funcBuckets+1659,0,0,0,funcBuckets+1660,0,0,funcBuckets+1661,
-  0,0,funcBuckets+1662,funcBuckets+1663,0,0,funcBuckets+1664,0,
-  funcBuckets+1665,0,0,funcBuckets+1666,funcBuckets+1667,0,0,funcBuckets+1669,
-  0,funcBuckets+1670,0,0,0,0,0,0,
-  0,0,funcBuckets+1671,funcBuckets+1672,0,0,0,0,
-  0,0,funcBuckets+1673,funcBuckets+1674,funcBuckets+1675,funcBuckets+1676,0,0,
-  0,0,funcBuckets+1677,0,0,0,0,funcBuckets+1679,
-  0,funcBuckets+1680,funcBuckets+1681,funcBuckets+1682,0,0,0,funcBuckets+1683,
-  0,0,0,0,0,funcBuckets+1684,0,funcBuckets+1686,
-  0,0,funcBuckets+1687,0,0,funcBuckets+1688,0,0,
-  0,0,funcBuckets+1689,0,funcBuckets+1690,0,0,0,
+  0,0,0,funcBuckets+1638,0,0,0,funcBuckets+1640,
+  funcBuckets+1641,0,0,funcBuckets+1642,funcBuckets+1643,funcBuckets+1644,0,funcBuckets+1645,
+  0,0,0,0,funcBuckets+1646,0,funcBuckets+1647,0,
+  0,funcBuckets+1648,0,0,0,funcBuckets+1649,0,funcBuckets+1650,
+  0,funcBuckets+1651,0,0,0,0,0,0,
+  funcBuckets+1652,0,0,funcBuckets+1653,0,0,funcBuckets+1654,funcBuckets+1655,
   0,0,0,0,0,0,0,0,
-  0,funcBuckets+1691,0,0,0,0,funcBuckets+1692,funcBuckets+1693,
-  funcBuckets+1694,funcBuckets+1696,0,0,0,0,0,0,
-  funcBuckets+1697,0,0,0,0,0,funcBuckets+1698,0,
-  0,funcBuckets+1699,0,0,0,0,0,0,
-  funcBuckets+1700,0,funcBuckets+1701,0,0,0,0,0,
-  0,0,0,funcBuckets+1702,0,funcBuckets+1703,0,0,
-  funcBuckets+1704,0,0,0,0,funcBuckets+1705,0,0,
-  funcBuckets+1706,0,0,0,0,0,0,0,
-  funcBuckets+1707,0,0,0,0,0,0,0,
-  funcBuckets+1708,funcBuckets+1709,0,0,0,0,0,0,
-  funcBuckets+1711,0,0,funcBuckets+1712,funcBuckets+1713,funcBuckets+1714,0,0,
+  funcBuckets+1656,funcBuckets+1657,0,funcBuckets+1658,0,funcBuckets+1659,0,0,
+  0,0,0,0,funcBuckets+1660,0,0,0,
+  funcBuckets+1661,funcBuckets+1662,0,0,0,funcBuckets+1663,0,0,
+  0,0,funcBuckets+1664,0,0,funcBuckets+1665,0,0,
+  funcBuckets+1666,0,0,0,funcBuckets+1667,0,0,funcBuckets+1668,
+  0,0,funcBuckets+1669,funcBuckets+1670,0,0,funcBuckets+1671,0,
+  funcBuckets+1672,0,0,funcBuckets+1673,funcBuckets+1674,0,0,funcBuckets+1676,
+  0,funcBuckets+1677,0,0,0,0,0,0,
+  0,0,funcBuckets+1678,funcBuckets+1679,0,0,0,0,
+  0,0,funcBuckets+1680,funcBuckets+1681,funcBuckets+1682,funcBuckets+1683,0,0,
+  0,0,funcBuckets+1684,0,0,0,0,funcBuckets+1686,
+  0,funcBuckets+1687,funcBuckets+1688,funcBuckets+1689,0,0,0,funcBuckets+1690,
+  0,0,0,0,0,funcBuckets+1691,0,funcBuckets+1693,
+  0,0,funcBuckets+1694,0,0,funcBuckets+1695,0,0,
+  0,0,funcBuckets+1696,0,funcBuckets+1697,0,0,0,
   0,0,0,0,0,0,0,0,
-  0,0,0,0,funcBuckets+1715,funcBuckets+1717,funcBuckets+1718,0,
-  0,funcBuckets+1719,0,0,0,funcBuckets+1721,0,0,
-  funcBuckets+1723,0,funcBuckets+1725,0,0,0,0,funcBuckets+1726,
-  0,funcBuckets+1727,0,funcBuckets+1728,0,0,0,0,
-  funcBuckets+1729,0,funcBuckets+1730,0,funcBuckets+1731,funcBuckets+1732,0,0,
-  0,0,0,0,0,funcBuckets+1733,0,funcBuckets+1734,
-  0,0,0,funcBuckets+1736,0,0,0,funcBuckets+1737,
-  0,funcBuckets+1738,0,0,0,funcBuckets+1740,0,0,
-  funcBuckets+1741,0,0,0,funcBuckets+1742,0,funcBuckets+1743,funcBuckets+1744,
-  funcBuckets+1745,funcBuckets+1746,0,funcBuckets+1747,0,0,0,0,
-  funcBuckets+1749,0,0,0,funcBuckets+1750,0,0,0,
-  0,0,funcBuckets+1751,0,0,0,0,0,
-  0,0,0,0,funcBuckets+1752,0,0,0,
-  0,0,0,funcBuckets+1753,0,0,0,0,
-  0,0,0,0,funcBuckets+1754,0,funcBuckets+1755,funcBuckets+1757,
+  0,funcBuckets+1698,0,0,0,0,funcBuckets+1699,funcBuckets+1700,
+  funcBuckets+1701,funcBuckets+1703,0,0,0,0,0,0,
+  funcBuckets+1704,0,0,0,0,0,funcBuckets+1705,0,
+  0,funcBuckets+1706,0,0,0,0,0,0,
+  funcBuckets+1707,0,funcBuckets+1708,0,0,0,0,0,
+  0,0,0,funcBuckets+1709,0,funcBuckets+1710,0,0,
+  funcBuckets+1711,0,0,0,0,funcBuckets+1712,0,0,
+  funcBuckets+1713,0,0,0,0,0,0,0,
+  funcBuckets+1714,0,0,0,0,0,0,0,
+  funcBuckets+1715,funcBuckets+1716,0,0,0,0,0,0,
+  funcBuckets+1718,0,0,funcBuckets+1719,funcBuckets+1720,funcBuckets+1721,0,0,
   0,0,0,0,0,0,0,0,
-  0,0,0,0,0,funcBuckets+1758,0,0,
-  0,funcBuckets+1759,0,0,0,funcBuckets+1760,0,0,
-  funcBuckets+1761,0,0,funcBuckets+1762,0,0,0,0,
-  0,0,0,0,funcBuckets+1763,0,funcBuckets+1766,0,
-  0,0,funcBuckets+1767,funcBuckets+1769,0,0,0,funcBuckets+1770,
+  0,0,0,0,funcBuckets+1722,funcBuckets+1724,funcBuckets+1725,0,
+  0,funcBuckets+1726,0,0,0,funcBuckets+1728,0,0,
+  funcBuckets+1730,0,funcBuckets+1732,0,0,0,0,funcBuckets+1733,
+  0,funcBuckets+1734,0,funcBuckets+1735,0,0,0,0,
+  funcBuckets+1736,0,funcBuckets+1737,0,funcBuckets+1738,funcBuckets+1739,0,0,
+  0,0,0,0,0,funcBuckets+1740,0,funcBuckets+1741,
+  0,0,0,funcBuckets+1743,0,0,0,funcBuckets+1744,
+  0,funcBuckets+1745,0,0,0,funcBuckets+1747,0,0,
+  funcBuckets+1748,0,0,0,funcBuckets+1749,0,funcBuckets+1750,funcBuckets+1751,
+  funcBuckets+1753,funcBuckets+1754,0,funcBuckets+1755,0,0,0,0,
+  funcBuckets+1757,0,0,0,funcBuckets+1758,0,0,0,
+  0,0,funcBuckets+1759,0,0,0,0,0,
+  0,0,0,0,funcBuckets+1760,0,0,0,
+  0,0,0,funcBuckets+1761,0,0,0,0,
+  0,0,0,0,funcBuckets+1762,0,funcBuckets+1763,funcBuckets+1765,
   0,0,0,0,0,0,0,0,
-  0,0,0,0,funcBuckets+1771,0,0,funcBuckets+1772,
-  0,0,funcBuckets+1773,0,0,funcBuckets+1774,0,0,
-  funcBuckets+1775,0,0,0,0,funcBuckets+1776,0,0,
-  0,0,0,0,0,0,funcBuckets+1777,funcBuckets+1778,
+  0,0,0,0,0,funcBuckets+1766,0,0,
+  0,funcBuckets+1767,0,0,0,funcBuckets+1768,0,0,
+  funcBuckets+1769,0,0,funcBuckets+1770,0,0,0,0,
+  0,0,0,0,funcBuckets+1771,0,funcBuckets+1774,0,
+  0,0,funcBuckets+1775,funcBuckets+1777,0,0,0,funcBuckets+1778,
   0,0,0,0,0,0,0,0,
-  0,0,0,0,funcBuckets+1779,funcBuckets+1780,0,0,
-  0,0,0,0,0,0,0,funcBuckets+1781,
-  0,0,0,funcBuckets+1783,0,0,0,0,
-  0,0,0,0,0,0,funcBuckets+1784,funcBuckets+1785,
-  0,0,funcBuckets+1787,0,0,0,0,0,
-  0,0,0,0,0,0,0,funcBuckets+1788,
-  0,funcBuckets+1789,0,0,0,0,0,0,
-  0,0,funcBuckets+1790,0,0,0,0,0,
-  0,0,0,0,0,0,0,funcBuckets+1791,
-  funcBuckets+1792,0,0,0,funcBuckets+1793,0,0,funcBuckets+1795,
-  0,funcBuckets+1796,0,0,funcBuckets+1797,0,funcBuckets+1798,0,
-  funcBuckets+1799,0,funcBuckets+1800,0,0,0,funcBuckets+1801,0,
-  0,0,0,funcBuckets+1802,0,0,0,0,
-  0,0,funcBuckets+1803,0,0,0,0,0,
-  0,0,funcBuckets+1804,0,0,funcBuckets+1805,0,0,
-  0,0,0,0,0,0,funcBuckets+1807,0,
-  0,0,funcBuckets+1808,0,0,funcBuckets+1809,0,0,
-  0,funcBuckets+1811,funcBuckets+1812,0,0,0,0,0,
-  0,0,0,0,0,funcBuckets+1813,0,0,
-  0,funcBuckets+1814,0,0,0,funcBuckets+1816,0,0,
-  0,0,0,0,0,0,funcBuckets+1817,0,
-  funcBuckets+1818,0,0,funcBuckets+1819,funcBuckets+1820,0,0,0,
-  0,funcBuckets+1821,funcBuckets+1822,0,funcBuckets+1824,0,0,funcBuckets+1825,
-  0,0,0,0,0,0,0,funcBuckets+1826,
-  funcBuckets+1827,0,0,0,funcBuckets+1828,0,0,0,
-  0,funcBuckets+1830,0,funcBuckets+1831,0,0,0,0,
-  funcBuckets+1832,0,0,0,funcBuckets+1833,funcBuckets+1834,0,0,
-  0,0,funcBuckets+1835,0,0,0,0,0,
-  0,0,0,0,0,0,funcBuckets+1836,0,
-  0,0,0,0,funcBuckets+1837,0,0,funcBuckets+1838,
-  funcBuckets+1839,0,0,0,funcBuckets+1840,0,0,0,
-  0,funcBuckets+1841,funcBuckets+1842,0,funcBuckets+1843,funcBuckets+1844,0,0,
+  0,0,0,0,funcBuckets+1779,0,0,funcBuckets+1780,
+  0,0,funcBuckets+1781,0,0,funcBuckets+1782,0,0,
+  funcBuckets+1783,0,0,0,0,funcBuckets+1784,0,0,
+  0,0,0,0,0,0,funcBuckets+1785,funcBuckets+1786,
   0,0,0,0,0,0,0,0,
-  0,0,funcBuckets+1845,funcBuckets+1846,0,funcBuckets+1847,0,funcBuckets+1848,
-  funcBuckets+1849,0,funcBuckets+1850,0,0,0,funcBuckets+1851,0,
-  0,0,funcBuckets+1852,0,0,funcBuckets+1853,0,funcBuckets+1854,
-  funcBuckets+1856,funcBuckets+1857,funcBuckets+1858,0,funcBuckets+1859,0,0,0,
-  0,0,0,0,funcBuckets+1860,0,0,funcBuckets+1861,
-  0,0,0,0,0,0,funcBuckets+1862,0,
-  0,funcBuckets+1864,0,funcBuckets+1865,funcBuckets+1866,0,0,funcBuckets+1867,
-  0,0,0,0,0,funcBuckets+1868,0,funcBuckets+1869,
-  0,funcBuckets+1870,funcBuckets+1872,0,0,0,funcBuckets+1873,0,
-  funcBuckets+1874,0,0,funcBuckets+1875,0,0,0,0,
-  0,0,0,0,0,0,funcBuckets+1876,funcBuckets+1877,
-  funcBuckets+1879,0,0,funcBuckets+1880,0,funcBuckets+1881,funcBuckets+1882,0,
-  0,0,0,0,funcBuckets+1883,0,0,0,
+  0,0,0,0,funcBuckets+1787,funcBuckets+1788,0,0,
+  0,0,0,0,0,0,0,funcBuckets+1789,
+  0,0,0,funcBuckets+1791,0,0,0,0,
+  0,0,0,0,0,0,funcBuckets+1792,funcBuckets+1793,
+  0,0,funcBuckets+1795,0,0,0,0,0,
+  0,0,0,0,0,0,0,funcBuckets+1796,
+  0,funcBuckets+1797,0,0,0,0,0,0,
+  0,0,funcBuckets+1798,0,0,0,0,0,
+  0,0,0,0,0,0,0,funcBuckets+1799,
+  funcBuckets+1800,0,0,0,funcBuckets+1801,0,0,funcBuckets+1803,
+  0,funcBuckets+1804,0,0,funcBuckets+1805,0,funcBuckets+1806,0,
+  funcBuckets+1807,0,funcBuckets+1808,0,0,0,funcBuckets+1809,0,
+  0,0,0,funcBuckets+1810,0,0,0,0,
+  0,0,funcBuckets+1811,0,0,0,0,0,
+  0,0,funcBuckets+1812,0,0,funcBuckets+1813,0,0,
+  0,0,0,0,0,0,funcBuckets+1815,0,
+  0,0,funcBuckets+1816,0,0,funcBuckets+1817,0,0,
+  0,funcBuckets+1819,funcBuckets+1820,0,0,0,0,0,
+  0,0,0,0,0,funcBuckets+1821,0,0,
+  0,funcBuckets+1822,0,0,0,funcBuckets+1824,0,0,
+  0,0,0,0,0,0,funcBuckets+1825,0,
+  funcBuckets+1826,0,0,funcBuckets+1827,funcBuckets+1828,0,0,0,
+  0,funcBuckets+1829,funcBuckets+1830,0,funcBuckets+1832,0,0,funcBuckets+1833,
+  0,0,0,0,0,0,0,funcBuckets+1834,
+  funcBuckets+1835,0,0,0,funcBuckets+1836,0,0,0,
+  0,funcBuckets+1838,0,funcBuckets+1839,0,0,0,0,
+  funcBuckets+1840,0,0,0,funcBuckets+1841,funcBuckets+1842,0,0,
+  0,0,funcBuckets+1843,0,0,0,0,0,
+  0,0,0,0,0,0,funcBuckets+1844,0,
+  0,0,0,0,funcBuckets+1845,0,0,funcBuckets+1846,
+  funcBuckets+1847,0,0,0,funcBuckets+1848,0,0,0,
+  0,funcBuckets+1849,funcBuckets+1850,0,funcBuckets+1851,funcBuckets+1852,0,0,
   0,0,0,0,0,0,0,0,
-  0,0,0,funcBuckets+1885,0,0,0,0,
-  0,0,0,0,0,0,0,funcBuckets+1886,
-  0,0,0,0,funcBuckets+1887,0,0,0,
-  funcBuckets+1888,0,0,0,0,0,funcBuckets+1889,0,
+  0,0,funcBuckets+1853,funcBuckets+1854,0,funcBuckets+1855,0,funcBuckets+1856,
+  funcBuckets+1857,0,funcBuckets+1858,0,0,0,funcBuckets+1859,0,
+  0,0,funcBuckets+1860,0,0,funcBuckets+1861,0,funcBuckets+1862,
+  funcBuckets+1864,funcBuckets+1865,funcBuckets+1866,0,funcBuckets+1867,0,0,0,
+  0,0,0,0,funcBuckets+1868,0,0,funcBuckets+1869,
+  0,0,0,0,0,0,funcBuckets+1870,0,
+  0,funcBuckets+1872,0,funcBuckets+1873,funcBuckets+1874,0,0,funcBuckets+1875,
+  0,0,0,0,0,funcBuckets+1876,0,funcBuckets+1877,
+  0,funcBuckets+1878,funcBuckets+1880,0,0,0,funcBuckets+1881,0,
+  funcBuckets+1882,0,0,funcBuckets+1883,0,0,0,0,
+  0,0,0,0,0,0,funcBuckets+1884,funcBuckets+1885,
+  funcBuckets+1887,0,0,funcBuckets+1888,0,funcBuckets+1889,funcBuckets+1890,0,
+  0,0,0,0,funcBuckets+1891,0,0,0,
   0,0,0,0,0,0,0,0,
-  0,0,0,funcBuckets+1890,funcBuckets+1891,0,0,0,
-  funcBuckets+1892,0,0,0,0,0,0,funcBuckets+1894,
+  0,0,0,funcBuckets+1893,0,0,0,0,
+  0,0,0,0,0,0,0,funcBuckets+1894,
   0,0,0,0,funcBuckets+1895,0,0,0,
-  0,funcBuckets+1896,0,0,funcBuckets+1897,0,funcBuckets+1898,funcBuckets+1899,
-  funcBuckets+1901,0,0,0,funcBuckets+1902,0,0,0,
+  funcBuckets+1896,0,0,0,0,0,funcBuckets+1897,0,
+  0,0,0,0,0,0,0,0,
+  0,0,0,funcBuckets+1898,funcBuckets+1899,0,0,0,
+  funcBuckets+1900,0,0,0,0,0,0,funcBuckets+1902,
   0,0,0,0,funcBuckets+1903,0,0,0,
-  0,0,funcBuckets+1904,0,0,0,funcBuckets+1905,0,
-  funcBuckets+1906,0,funcBuckets+1907,funcBuckets+1908,funcBuckets+1909,0,funcBuckets+1910,0,
-  0,funcBuckets+1911,0,funcBuckets+1912,funcBuckets+1913,0,0,0,
-  0,funcBuckets+1914,0,0,0,0,funcBuckets+1915,0,
-  0,0,0,funcBuckets+1916,0,0,funcBuckets+1917,funcBuckets+1918,
-  funcBuckets+1919,0,funcBuckets+1920,0,0,0,funcBuckets+1921,0,
-  0,0,0,0,funcBuckets+1922,funcBuckets+1923,0,0,
+  0,funcBuckets+1904,0,0,funcBuckets+1905,0,funcBuckets+1906,funcBuckets+1907,
+  funcBuckets+1909,0,0,0,funcBuckets+1910,0,0,0,
+  0,0,0,0,funcBuckets+1911,0,0,0,
+  0,0,funcBuckets+1912,0,0,0,funcBuckets+1913,0,
+  funcBuckets+1914,0,funcBuckets+1915,funcBuckets+1916,funcBuckets+1917,0,funcBuckets+1918,0,
+  0,funcBuckets+1919,0,funcBuckets+1920,funcBuckets+1921,0,0,0,
+  0,funcBuckets+1922,0,0,0,0,funcBuckets+1923,0,
   0,0,0,funcBuckets+1924,0,0,funcBuckets+1925,funcBuckets+1926,
-  0,0,funcBuckets+1928,0,0,0,0,funcBuckets+1929,
-  funcBuckets+1930,0,funcBuckets+1932,0,funcBuckets+1933,0,0,0,
-  0,0,0,funcBuckets+1935,0,funcBuckets+1936,0,0,
-  0,0,0,0,0,0,funcBuckets+1937,0,
-  0,funcBuckets+1940,0,0,0,0,0,funcBuckets+1941,
-  funcBuckets+1942,0,funcBuckets+1943,0,0,0,0,0,
-  0,0,funcBuckets+1944,0,0,0,0,0,
-  0,0,0,funcBuckets+1945,0,0,0,0,
+  funcBuckets+1927,0,funcBuckets+1928,0,0,0,funcBuckets+1929,0,
+  0,0,0,0,funcBuckets+1930,funcBuckets+1931,0,0,
+  0,0,0,funcBuckets+1932,0,0,funcBuckets+1933,funcBuckets+1934,
+  0,0,funcBuckets+1936,0,0,0,0,funcBuckets+1937,
+  funcBuckets+1938,0,funcBuckets+1940,0,funcBuckets+1941,0,0,0,
+  0,0,0,funcBuckets+1943,0,funcBuckets+1944,0,0,
+  0,0,0,0,0,0,funcBuckets+1945,0,
+  0,funcBuckets+1948,0,0,0,0,0,funcBuckets+1949,
+  funcBuckets+1950,0,funcBuckets+1951,0,0,0,0,0,
+  0,0,funcBuckets+1952,0,0,0,0,0,
+  0,0,0,funcBuckets+1953,0,0,0,0,
   0,0,0,0,0,0,0,0,
-  0,0,0,funcBuckets+1946,0,0,0,0,
-  funcBuckets+1948,0,0,funcBuckets+1949,0,0,funcBuckets+1950,0,
+  0,0,0,funcBuckets+1954,0,0,0,0,
+  funcBuckets+1956,0,0,funcBuckets+1957,0,0,funcBuckets+1958,0,
   0,0,0,0,0,0,0,0,
-  0,0,0,0,funcBuckets+1951,0,0,funcBuckets+1952,
-  0,0,funcBuckets+1953,funcBuckets+1954,funcBuckets+1955,funcBuckets+1956,0,funcBuckets+1957,
-  0,0,funcBuckets+1958,0,funcBuckets+1959,0,0,0,
-  funcBuckets+1960,0,funcBuckets+1961,0,0,0,0,0,
-  funcBuckets+1962,funcBuckets+1963,0,0,funcBuckets+1964,0,funcBuckets+1965,0,
+  0,0,0,0,funcBuckets+1959,0,0,funcBuckets+1960,
+  0,0,funcBuckets+1961,funcBuckets+1962,funcBuckets+1963,funcBuckets+1964,0,funcBuckets+1965,
+  0,0,funcBuckets+1966,0,funcBuckets+1967,0,0,0,
+  funcBuckets+1968,0,funcBuckets+1969,0,0,0,0,0,
+  funcBuckets+1970,funcBuckets+1971,0,0,funcBuckets+1972,0,funcBuckets+1973,0,
   0,0,0,0,0,0,0,0,
-  0,0,0,0,funcBuckets+1966,0,0,0,
-  0,0,0,0,funcBuckets+1968,0,0,0,
-  0,0,funcBuckets+1969,0,0,funcBuckets+1970,0,0,
-  0,funcBuckets+1971,0,0,0,0,funcBuckets+1973,0,
-  0,0,funcBuckets+1974,0,0,0,0,funcBuckets+1975,
-  0,funcBuckets+1976,0,0,0,0,0,0,
-  0,0,funcBuckets+1977,0,0,0,funcBuckets+1978,0,
-  0,0,0,0,0,0,funcBuckets+1979,0,
-  0,0,0,funcBuckets+1980,0,funcBuckets+1981,0,0,
-  0,funcBuckets+1982,0,funcBuckets+1983,0,0,0,0,
+  0,0,0,0,funcBuckets+1974,0,0,0,
+  0,0,0,0,funcBuckets+1976,0,0,0,
+  0,0,funcBuckets+1977,0,0,funcBuckets+1978,0,0,
+  0,funcBuckets+1979,0,0,0,0,funcBuckets+1981,0,
+  0,0,funcBuckets+1982,0,0,0,0,funcBuckets+1983,
+  0,funcBuckets+1984,0,0,0,0,0,0,
+  0,0,funcBuckets+1985,0,0,0,funcBuckets+1986,0,
+  0,0,0,0,0,0,funcBuckets+1987,0,
+  0,0,0,funcBuckets+1988,0,funcBuckets+1989,0,0,
+  0,funcBuckets+1990,0,funcBuckets+1991,0,0,0,0,
   0,0,0,0,0,0,0,0,
-  0,0,0,funcBuckets+1984,0,0,0,0,
-  0,0,funcBuckets+1985,0,funcBuckets+1986,0,0,0,
-  funcBuckets+1987,funcBuckets+1988,0,0,funcBuckets+1989,0,0,0,
+  0,0,0,funcBuckets+1992,0,0,0,0,
+  0,0,funcBuckets+1993,0,funcBuckets+1994,0,0,0,
+  funcBuckets+1995,funcBuckets+1996,0,0,funcBuckets+1997,0,0,0,
   0,0,0,0,0,0,0,0,
-  funcBuckets+1990,0,0,0,0,0,0,0,
-  0,0,funcBuckets+1991,0,0,0,funcBuckets+1993,0,
-  0,funcBuckets+1994,0,0,funcBuckets+1996,0,funcBuckets+1997,0,
-  0,funcBuckets+1999,funcBuckets+2000,funcBuckets+2002,funcBuckets+2003,0,funcBuckets+2004,funcBuckets+2005,
-  0,0,0,funcBuckets+2006,0,0,0,0,
-  funcBuckets+2007,funcBuckets+2008,0,0,0,0,0,funcBuckets+2009,
-  0,0,0,funcBuckets+2010,0,funcBuckets+2011,funcBuckets+2012,0,
-  funcBuckets+2013,0,0,funcBuckets+2014,0,0,funcBuckets+2015,funcBuckets+2016,
-  0,funcBuckets+2017,0,0,0,0,0,0,
-  funcBuckets+2018,0,funcBuckets+2019,funcBuckets+2020,0,0,0,0,
+  funcBuckets+1998,0,0,0,0,0,0,0,
+  0,0,funcBuckets+1999,0,0,0,funcBuckets+2001,0,
+  0,funcBuckets+2002,0,0,funcBuckets+2004,0,funcBuckets+2005,0,
+  0,funcBuckets+2007,funcBuckets+2008,funcBuckets+2010,funcBuckets+2011,0,funcBuckets+2012,funcBuckets+2013,
+  0,0,0,funcBuckets+2014,0,0,0,0,
+  funcBuckets+2015,funcBuckets+2016,0,0,0,0,0,funcBuckets+2017,
+  0,0,0,funcBuckets+2018,0,funcBuckets+2019,funcBuckets+2020,0,
+  funcBuckets+2021,0,0,funcBuckets+2022,0,0,funcBuckets+2023,funcBuckets+2024,
+  0,funcBuckets+2025,0,0,0,0,0,0,
+  funcBuckets+2026,0,funcBuckets+2027,funcBuckets+2028,0,0,0,0,
   0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,funcBuckets+2021,funcBuckets+2022,
-  0,0,0,0,funcBuckets+2023,funcBuckets+2024,0,funcBuckets+2025,
+  0,0,0,0,0,0,funcBuckets+2029,funcBuckets+2030,
+  0,0,0,0,funcBuckets+2031,funcBuckets+2032,0,funcBuckets+2033,
   0,0,0,0,0,0,0,0,
-  0,funcBuckets+2027,funcBuckets+2028,0,0,0,0,0,
-  funcBuckets+2029,funcBuckets+2030,funcBuckets+2031,0,0,0,0,0,
-  0,0,0,0,0,funcBuckets+2032,funcBuckets+2033,0,
-  0,funcBuckets+2034,0,0,0,0,0,0,
-  0,funcBuckets+2035,0,0,0,0,0,0,
-  0,0,funcBuckets+2036,funcBuckets+2037,0,0,funcBuckets+2038,0,
+  0,funcBuckets+2035,funcBuckets+2036,0,0,0,0,0,
+  funcBuckets+2037,funcBuckets+2038,funcBuckets+2039,0,0,0,0,0,
+  0,0,0,0,0,funcBuckets+2040,funcBuckets+2041,0,
+  0,funcBuckets+2042,0,0,0,0,0,0,
+  0,funcBuckets+2043,0,0,0,0,0,0,
+  0,0,funcBuckets+2044,funcBuckets+2045,0,0,funcBuckets+2046,0,
   0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,funcBuckets+2039,
-  0,0,funcBuckets+2041,0,0,funcBuckets+2042,0,0,
-  0,funcBuckets+2043,funcBuckets+2044,0,0,funcBuckets+2045,funcBuckets+2046,0,
-  0,0,0,funcBuckets+2047,0,0,0,0,
-  0,0,0,0,0,0,0,funcBuckets+2048,
-  0,funcBuckets+2049,0,0,0,0,0,0,
-  0,funcBuckets+2050,0,0,0,funcBuckets+2051,funcBuckets+2053,0,
-  0,funcBuckets+2055,0,funcBuckets+2056,0,0,funcBuckets+2057,funcBuckets+2058,
-  0,0,0,0,0,funcBuckets+2059,0,funcBuckets+2060,
+  0,0,0,0,0,0,0,funcBuckets+2047,
+  0,0,funcBuckets+2049,0,0,funcBuckets+2050,0,0,
+  0,funcBuckets+2051,funcBuckets+2052,0,0,funcBuckets+2053,funcBuckets+2054,0,
+  0,0,0,funcBuckets+2055,0,0,0,0,
+  0,0,0,0,0,0,0,funcBuckets+2056,
+  0,funcBuckets+2057,0,0,0,0,0,0,
+  0,funcBuckets+2058,0,0,0,funcBuckets+2059,funcBuckets+2061,0,
+  0,funcBuckets+2063,0,funcBuckets+2064,0,0,funcBuckets+2065,funcBuckets+2066,
+  0,0,0,0,0,funcBuckets+2067,0,funcBuckets+2068,
   0,0,0,0,0,0,0,0,
-  0,0,funcBuckets+2061,0,0,0,0,funcBuckets+2063,
-  funcBuckets+2064,0,0,0,funcBuckets+2065,0,funcBuckets+2066,0,
-  0,0,0,funcBuckets+2067,0,0,funcBuckets+2068,0,
-  0,0,0,0,0,0,funcBuckets+2069,0,
-  0,0,0,funcBuckets+2071,funcBuckets+2072,0,0,0,
-  0,0,0,0,0,funcBuckets+2073,0,0,
-  funcBuckets+2074,0,funcBuckets+2075,0,funcBuckets+2076,0,funcBuckets+2077,0,
-  0,0,funcBuckets+2078,funcBuckets+2079,0,0,0,0,
-  funcBuckets+2080,0,funcBuckets+2081,0,0,0,funcBuckets+2082,0,
-  0,0,funcBuckets+2083,0,0,funcBuckets+2084,0,funcBuckets+2085,
+  0,0,funcBuckets+2069,0,0,0,0,funcBuckets+2071,
+  funcBuckets+2072,0,0,0,funcBuckets+2073,0,funcBuckets+2074,0,
+  0,0,0,funcBuckets+2075,0,0,funcBuckets+2076,0,
+  0,0,0,0,0,0,funcBuckets+2077,0,
+  0,0,0,funcBuckets+2079,funcBuckets+2080,0,0,0,
+  0,0,0,0,0,funcBuckets+2081,0,0,
+  funcBuckets+2082,0,funcBuckets+2083,0,funcBuckets+2084,0,funcBuckets+2085,0,
+  0,0,funcBuckets+2086,funcBuckets+2087,0,0,0,0,
+  funcBuckets+2088,0,funcBuckets+2089,0,0,0,funcBuckets+2090,0,
+  0,0,funcBuckets+2091,0,0,funcBuckets+2092,0,funcBuckets+2093,
   0,0,0,0,0,0,0,0,
-  0,funcBuckets+2086,0,0,0,0,0,0,
-  0,0,funcBuckets+2087,0,0,funcBuckets+2088,0,0,
-  funcBuckets+2089,0,0,0,funcBuckets+2090,0,0,0,
-  0,funcBuckets+2091,0,0,funcBuckets+2093,0,0,0,
-  funcBuckets+2094,funcBuckets+2095,0,funcBuckets+2096,0,0,0,0,
-  0,0,0,0,funcBuckets+2099,0,0,0,
-  0,0,0,0,0,0,funcBuckets+2100,0,
-  0,0,0,funcBuckets+2101,0,0,0,0,
-  0,0,funcBuckets+2102,0,0,0,0,0,
-  0,0,0,0,0,funcBuckets+2103,0,0,
-  0,funcBuckets+2104,0,0,funcBuckets+2105,0,funcBuckets+2106,0,
-  0,0,0,funcBuckets+2107,0,0,funcBuckets+2108,0,
-  funcBuckets+2109,0,0,0,0,0,0,funcBuckets+2111,
-  funcBuckets+2112,0,0,funcBuckets+2113,0,0,funcBuckets+2115,0,
-  0,0,0,0,0,0,0,funcBuckets+2116,
-  0,funcBuckets+2117,0,funcBuckets+2118,0,funcBuckets+2119,0,0,
+  0,funcBuckets+2094,0,0,0,0,0,0,
+  0,0,funcBuckets+2095,0,0,funcBuckets+2096,0,0,
+  funcBuckets+2097,0,0,0,funcBuckets+2098,0,0,0,
+  0,funcBuckets+2099,0,0,funcBuckets+2101,0,0,0,
+  funcBuckets+2102,funcBuckets+2103,0,funcBuckets+2104,0,0,0,0,
+  0,0,0,0,funcBuckets+2107,0,0,0,
+  0,0,0,0,0,0,funcBuckets+2108,0,
+  0,0,0,funcBuckets+2109,0,0,0,0,
+  0,0,funcBuckets+2110,0,0,0,0,0,
+  0,0,0,0,0,funcBuckets+2111,0,0,
+  0,funcBuckets+2112,0,0,funcBuckets+2113,0,funcBuckets+2114,0,
+  0,0,0,funcBuckets+2115,0,0,funcBuckets+2116,0,
+  funcBuckets+2117,0,0,0,0,0,0,funcBuckets+2119,
+  funcBuckets+2120,0,0,funcBuckets+2121,0,0,funcBuckets+2123,0,
+  0,0,0,0,0,0,0,funcBuckets+2124,
+  0,funcBuckets+2125,0,funcBuckets+2126,0,funcBuckets+2127,0,0,
   0,0,0,0,0,0,0,0,
-  funcBuckets+2120,0,funcBuckets+2121,0,funcBuckets+2122,funcBuckets+2123,funcBuckets+2124,funcBuckets+2125,
-  funcBuckets+2126,funcBuckets+2127,0,0,0,0,0,0,
-  0,0,0,0,0,funcBuckets+2128,0,funcBuckets+2130,
-  0,0,funcBuckets+2131,funcBuckets+2132,0,0,0,0,
-  0,0,0,funcBuckets+2133,0,0,0,funcBuckets+2134,
-  0,0,0,funcBuckets+2136,0,0,0,0,
-  0,0,0,funcBuckets+2137,0,0,0,funcBuckets+2138,
-  0,0,0,0,0,0,funcBuckets+2139,0,
-  0,0,0,funcBuckets+2140,0,0,0,funcBuckets+2141,
-  0,0,0,funcBuckets+2142,0,funcBuckets+2143,0,0,
-  0,0,0,0,funcBuckets+2144,0,0,0,
-  0,0,0,0,funcBuckets+2145,0,0,0,
+  funcBuckets+2128,0,funcBuckets+2129,0,funcBuckets+2130,funcBuckets+2131,funcBuckets+2132,funcBuckets+2133,
+  funcBuckets+2134,funcBuckets+2135,0,0,0,0,0,0,
+  0,0,0,0,0,funcBuckets+2136,0,funcBuckets+2138,
+  0,0,funcBuckets+2139,funcBuckets+2140,0,0,0,0,
+  0,0,0,funcBuckets+2141,0,0,0,funcBuckets+2142,
+  0,0,0,funcBuckets+2144,0,0,0,0,
+  0,0,0,funcBuckets+2145,0,0,0,funcBuckets+2146,
+  0,0,0,0,0,0,funcBuckets+2147,0,
+  0,0,0,funcBuckets+2148,0,0,0,funcBuckets+2149,
+  0,0,0,funcBuckets+2150,0,funcBuckets+2151,0,0,
+  0,0,0,0,funcBuckets+2152,0,0,0,
+  0,0,0,0,funcBuckets+2153,0,0,0,
   0,0,0,0,0,0,0,0,
-  0,0,funcBuckets+2146,0,0,0,0,0,
-  0,0,0,0,0,funcBuckets+2148,0,0,
-  0,0,funcBuckets+2149,0,0,0,0,0,
-  0,0,0,0,0,0,0,funcBuckets+2150,
-  funcBuckets+2151,funcBuckets+2153,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,
-  funcBuckets+2154,funcBuckets+2155,0,0,0,0,funcBuckets+2157,0,
+  0,0,funcBuckets+2154,0,0,0,0,0,
+  0,0,0,0,0,funcBuckets+2156,0,0,
+  0,0,funcBuckets+2157,0,0,0,0,0,
   0,0,0,0,0,0,0,funcBuckets+2158,
-  0,0,0,funcBuckets+2159,0,funcBuckets+2160,0,funcBuckets+2161,
-  0,0,0,0,0,funcBuckets+2162,funcBuckets+2163,0,
+  funcBuckets+2159,funcBuckets+2161,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,
+  funcBuckets+2162,funcBuckets+2163,0,0,0,0,funcBuckets+2165,0,
+  0,0,0,0,0,0,0,funcBuckets+2166,
+  0,0,0,funcBuckets+2167,0,funcBuckets+2168,0,funcBuckets+2169,
+  0,0,0,0,0,funcBuckets+2170,funcBuckets+2171,0,
   0,0,0,0,0,0,0,0,
-  funcBuckets+2164,0,funcBuckets+2165,funcBuckets+2166,funcBuckets+2167,funcBuckets+2168,0,funcBuckets+2169,
-  funcBuckets+2170,funcBuckets+2171,funcBuckets+2172,0,0,0,funcBuckets+2173,funcBuckets+2174,
-  0,0,0,0,0,funcBuckets+2175,funcBuckets+2176,0,
-  0,0,0,funcBuckets+2178,0,0,0,0,
-  0,0,0,funcBuckets+2179,0,0,0,0,
-  0,funcBuckets+2180,funcBuckets+2181,funcBuckets+2182,0,0,0,funcBuckets+2183,
-  0,funcBuckets+2184,0,funcBuckets+2186,funcBuckets+2187,0,0,0,
-  0,0,0,0,0,0,funcBuckets+2188,0,
+  funcBuckets+2172,0,funcBuckets+2173,funcBuckets+2174,funcBuckets+2175,funcBuckets+2176,0,funcBuckets+2177,
+  funcBuckets+2178,funcBuckets+2179,funcBuckets+2180,0,0,0,funcBuckets+2181,funcBuckets+2182,
+  0,0,0,0,0,funcBuckets+2183,funcBuckets+2184,0,
+  0,0,0,funcBuckets+2186,0,0,0,0,
+  0,0,0,funcBuckets+2187,0,0,0,0,
+  0,funcBuckets+2188,funcBuckets+2189,funcBuckets+2190,0,0,0,funcBuckets+2191,
+  0,funcBuckets+2192,0,funcBuckets+2194,funcBuckets+2195,0,0,0,
+  0,0,0,0,0,0,funcBuckets+2196,0,
   0,0,0,0,0,0,0,0,
-  funcBuckets+2189,0,0,0,funcBuckets+2190,0,funcBuckets+2191,0,
+  funcBuckets+2197,0,0,0,funcBuckets+2198,0,funcBuckets+2199,0,
 
 };
 static inline const hashNodeFunc *findFunc(const char *name, strhash_t hash) {
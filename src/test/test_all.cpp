@@ -67,6 +67,10 @@ void Test::RunTestsImpl(bool &allPassed, std::string &suite,
       RUN_TESTSUITE(TestCodeRun);
       return;
     }
+    if (suite == "TestVm") {
+      RUN_TESTSUITE(TestVm);
+      return;
+    }
   }
   if (hhvm) {
     fprintf(stderr, "%s is not supported with USE_HHVM=1\n", suite.c_str());
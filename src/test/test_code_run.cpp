@@ -17604,6 +17604,87 @@ bool TestCodeRun::TestThrift() {
       "  int(1234)\n"
       "}\n");
 
+  // nested structs, so compiled specs get reused within a request
+  MVCRO("<?php "
+        "class TType {"
+        "  const I32    = 8;"
+        "  const STRING = 11;"
+        "  const STRUCT = 12;"
+        "  const LST    = 15;"
+        "}"
+        "class DummyProtocol {"
+        "  public $t;"
+        "  function __construct() {"
+        "    $this->t = new DummyTransport();"
+        "  }"
+        "  function getTransport() {"
+        "    return $this->t;"
+        "  }"
+        "}"
+        "class DummyTransport {"
+        "  public $buff = '';"
+        "  public $pos = 0;"
+        "  function flush() { }"
+        "  function write($buff) {"
+        "    $this->buff .= $buff;"
+        "  }"
+        "  function read($n) {"
+        "    $r = substr($this->buff, $this->pos, $n);"
+        "    $this->pos += $n;"
+        "    return $r;"
+        "  }"
+        "}"
+        "class Node {"
+        "  static $_TSPEC;"
+        "  public $id = null;"
+        "  public $tag = null;"
+        "  public $children = null;"
+        "  public function __construct($id = null, $tag = null,"
+        "                              $children = null) {"
+        "    if (!isset(self::$_TSPEC)) {"
+        "      self::$_TSPEC = array("
+        "        1 => array('var' => 'id', 'type' => TType::I32),"
+        "        2 => array('var' => 'tag', 'type' => TType::STRING),"
+        "        3 => array('var' => 'children', 'type' => TType::LST,"
+        "                   'etype' => TType::STRUCT,"
+        "                   'elem' => array('type' => TType::STRUCT,"
+        "                                   'class' => 'Node')),"
+        "      );"
+        "    }"
+        "    $this->id = $id;"
+        "    $this->tag = $tag;"
+        "    $this->children = $children;"
+        "  }"
+        "}"
+        "function show($n, $indent = '') {"
+        "  echo $indent, $n->id, ' ', $n->tag, \"\\n\";"
+        "  if ($n->children) {"
+        "    foreach ($n->children as $c) show($c, $indent.'  ');"
+        "  }"
+        "}"
+        "function test() {"
+        "  $v = new Node(1, 'root', array(new Node(2, 'a',"
+        "                                          array(new Node(4, 'c'))),"
+        "                                 new Node(3, 'b')));"
+        "  $p = new DummyProtocol();"
+        "  thrift_protocol_write_binary($p, 'foomethod', 1, $v, 20, true);"
+        "  show(thrift_protocol_read_binary($p, 'Node', true));"
+        "  $p = new DummyProtocol();"
+        "  thrift_protocol_write_compact($p, 'foomethod', 1, $v, 20);"
+        "  $p->getTransport()->buff[1] = pack('C', 0x42);"
+        "  show(thrift_protocol_read_compact($p, 'Node'));"
+        "}"
+        "test();",
+
+        "1 root\n"
+        "  2 a\n"
+        "    4 c\n"
+        "  3 b\n"
+        "1 root\n"
+        "  2 a\n"
+        "    4 c\n"
+        "  3 b\n");
+
   return true;
 }
 
@@ -20,6 +20,7 @@
 #include <runtime/base/shared/shared_store_base.h>
 #include <runtime/base/runtime_option.h>
 #include <runtime/base/program_functions.h>
+#include <sstream>
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -54,6 +55,7 @@ bool TestExtApc::RunTests(const std::string &which) {
   RUN_TEST(test_apc_bin_dumpfile);
   RUN_TEST(test_apc_bin_loadfile);
   RUN_TEST(test_apc_exists);
+  RUN_TEST(test_apc_snapshot);
 
   return ret;
 }
@@ -324,3 +326,18 @@ bool TestExtApc::test_apc_exists() {
   VS(f_apc_exists(CREATE_VECTOR2("ts", "TestString")), CREATE_VECTOR1("ts"));
   return Count(true);
 }
+
+bool TestExtApc::test_apc_snapshot() {
+  f_apc_clear_cache();
+  f_apc_store("ts", "Test\nString");
+  f_apc_store("ta", CREATE_MAP2("a", 1, "b", 2), 3600);
+  std::stringstream ss;
+  VS(s_apc_store[0].snapshot(ss), 2);
+
+  f_apc_clear_cache();
+  f_apc_store("ts", "Existing");
+  VS(s_apc_store[0].loadSnapshot(ss), 1);
+  VS(f_apc_fetch("ts"), "Existing");
+  VS(f_apc_fetch("ta"), CREATE_MAP2("a", 1, "b", 2));
+  return Count(true);
+}
@@ -48,6 +48,7 @@ class TestExtApc : public TestCppExt {
   bool test_apc_bin_dumpfile();
   bool test_apc_bin_loadfile();
   bool test_apc_exists();
+  bool test_apc_snapshot();
 };
 
 ///////////////////////////////////////////////////////////////////////////////
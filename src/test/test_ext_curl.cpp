@@ -19,6 +19,9 @@
 #include <runtime/ext/ext_output.h>
 #include <runtime/ext/ext_zlib.h>
 #include <runtime/base/server/libevent_server.h>
+#include <runtime/base/util/http_client.h>
+#include <runtime/base/util/http_connection_pool.h>
+#include <runtime/base/runtime_option.h>
 
 #define PORT_MIN 7100
 #define PORT_MAX 7120
@@ -87,6 +90,7 @@ bool TestExtCurl::RunTests(const std::string &which) {
   RUN_TEST(test_curl_multi_remove_handle);
   RUN_TEST(test_curl_multi_exec);
   RUN_TEST(test_curl_multi_select);
+  RUN_TEST(test_curl_multi_await);
   RUN_TEST(test_curl_multi_getcontent);
   RUN_TEST(test_curl_multi_info_read);
   RUN_TEST(test_curl_multi_close);
@@ -97,6 +101,7 @@ bool TestExtCurl::RunTests(const std::string &which) {
   RUN_TEST(test_evhttp_async_get);
   RUN_TEST(test_evhttp_async_post);
   RUN_TEST(test_evhttp_recv);
+  RUN_TEST(test_http_connection_pool);
 
   server->stop();
 
@@ -261,6 +266,34 @@ bool TestExtCurl::test_curl_multi_select() {
   return Count(true);
 }
 
+bool TestExtCurl::test_curl_multi_await() {
+  Object mh = f_curl_multi_init();
+  Array handles;
+  for (int i = 0; i < 20; i++) {
+    Variant c = f_curl_init(String(get_request_uri()));
+    f_curl_setopt(c, k_CURLOPT_RETURNTRANSFER, true);
+    f_curl_multi_add_handle(mh, c);
+    handles.append(c);
+  }
+
+  int done = 0;
+  while (done < handles.size()) {
+    int64 ready = f_curl_multi_await(mh, 5.0);
+    VERIFY(ready > 0);
+    Variant queued;
+    for (; ready > 0; ready--) {
+      Variant info = f_curl_multi_info_read(mh, ref(queued));
+      VS(info["msg"], 1); // CURLMSG_DONE
+      VS(info["result"], 0);
+      VS(f_curl_multi_getcontent(info["handle"]), "OK");
+      done++;
+    }
+    VS(f_curl_multi_info_read(mh), false);
+  }
+  VS(f_curl_multi_await(mh, 0.1), 0);
+  return Count(true);
+}
+
 bool TestExtCurl::test_curl_multi_getcontent() {
   Object mh = f_curl_multi_init();
   Variant c1 = f_curl_init(String(get_request_uri()));
@@ -397,3 +430,60 @@ bool TestExtCurl::test_evhttp_recv() {
   // tested in test_evhttp_async_get() and test_evhttp_async_post()
   return Count(true);
 }
+
+bool TestExtCurl::test_http_connection_pool() {
+  VERIFY(HttpConnectionPool::GetKey("HTTPS://user:pw@Example.com/x?y") ==
+         "https://example.com:443");
+  VERIFY(HttpConnectionPool::GetKey("http://[::1]/") == "http://[::1]:80");
+  VERIFY(HttpConnectionPool::GetKey("ftp://example.com/") == "");
+
+  std::string url = get_request_uri();
+  std::string key = HttpConnectionPool::GetKey(url.c_str());
+  VERIFY(key == "http://localhost:" +
+         boost::lexical_cast<string>(s_server_port));
+
+  // hosts that aren't listed are never pooled
+  HttpClient http;
+  {
+    StringBuffer response;
+    VS(http.get(url.c_str(), response), 200);
+    VS(response.detach(), "OK");
+    VS(HttpConnectionPool::GetIdleCount(key), 0);
+  }
+
+  // requests one after another keep taking and returning the same handle
+  RuntimeOption::HttpConnectionPoolHosts.insert("localhost");
+  int idle = 1;
+  for (int i = 0; i < 3; i++) {
+    StringBuffer response;
+    VS(http.get(url.c_str(), response), 200);
+    VS(response.detach(), "OK");
+    VS(HttpConnectionPool::GetIdleCount(key), idle);
+  }
+  for (int i = 0; i < 3; i++) {
+    Variant c = f_curl_init(String(url));
+    f_curl_setopt(c, k_CURLOPT_RETURNTRANSFER, true);
+    VS(f_curl_exec(c), "OK");
+    f_curl_close(c);
+    VS(HttpConnectionPool::GetIdleCount(key), idle);
+  }
+
+  // handles that carried cookies or credentials don't go back
+  {
+    Variant c = f_curl_init(String(url));
+    f_curl_setopt(c, k_CURLOPT_RETURNTRANSFER, true);
+    f_curl_setopt(c, k_CURLOPT_COOKIE, "session=secret");
+    VS(f_curl_exec(c), "OK");
+    f_curl_close(c);
+    VS(HttpConnectionPool::GetIdleCount(key), idle - 1);
+  }
+  {
+    HttpClient authed;
+    authed.auth("user", "secret");
+    StringBuffer response;
+    VS(authed.get(url.c_str(), response), 200);
+    VS(HttpConnectionPool::GetIdleCount(key), idle - 1);
+  }
+  RuntimeOption::HttpConnectionPoolHosts.erase("localhost");
+  return Count(true);
+}
@@ -110,6 +110,48 @@ bool TestExtFb::test_fb_compact_serialize() {
   Variant ret;
   VS(f_fb_compact_unserialize(s, ref(ret)), CREATE_VECTOR3(1, 2, 3));
 
+  // Test records: lists of arrays with the same keys
+  RuntimeOption::FbCompactSerializeVersion = 2;
+  fb_cs_test(CREATE_VECTOR2(CREATE_MAP2("a", 1, "b", "x"),
+                            CREATE_MAP2("a", 2, "b", "y")));
+  fb_cs_test(CREATE_VECTOR3(CREATE_MAP1("a", "x"), CREATE_MAP1("a", "x"),
+                            CREATE_MAP1("a", "y")));
+  fb_cs_test(CREATE_VECTOR3(CREATE_MAP1(5, 100), CREATE_MAP1(5, -100),
+                            CREATE_MAP1(5, (int64)((1ULL << 63) - 1))));
+  fb_cs_test(CREATE_VECTOR2(CREATE_MAP2("a", 1, "b", null),
+                            CREATE_MAP2("a", "1", "b", CREATE_VECTOR1(2))));
+  fb_cs_test(CREATE_VECTOR2(CREATE_VECTOR2(1, 2), CREATE_VECTOR2(3, 4)));
+  // same keys, different order
+  fb_cs_test(CREATE_VECTOR2(CREATE_MAP2("a", 1, "b", 2),
+                            CREATE_MAP2("b", 2, "a", 1)));
+  fb_cs_test(CREATE_VECTOR2(CREATE_MAP1("a", 1), CREATE_MAP1("b", 1)));
+  fb_cs_test(CREATE_VECTOR2(CREATE_MAP1("a", 1), Array()));
+  {
+    Array rows;
+    for (int i = 0; i < 100; i++) {
+      rows.append(CREATE_MAP3("id", 1000000 + i,
+                              "name", String("user ") + String(i),
+                              "status", i % 3 ? "active" : "disabled"));
+    }
+    fb_cs_test(rows);
+
+    RuntimeOption::FbCompactSerializeVersion = 1;
+    String v1 = f_fb_compact_serialize(rows).toString();
+    RuntimeOption::FbCompactSerializeVersion = 2;
+    String v2 = f_fb_compact_serialize(rows).toString();
+    RuntimeOption::FbCompactSerializeVersion = 1;
+    VERIFY(v2.size() * 2 < v1.size());
+    Variant ret;
+    VS(f_fb_compact_unserialize(v1, ref(ret)), rows);
+  }
+  {
+    // more rows than the payload could hold
+    String s("\xff\x01\x01\x7f\x00\x01", 6, AttachLiteral);
+    Variant ret;
+    VS(f_fb_compact_unserialize(s, ref(ret)), false);
+    VERIFY(same(ret, false));
+  }
+
   return Count(true);
 }
 
@@ -24,6 +24,7 @@ bool TestExtJson::RunTests(const std::string &which) {
   bool ret = true;
 
   RUN_TEST(test_json_encode);
+  RUN_TEST(test_json_encode_to_output);
   RUN_TEST(test_json_decode);
 
   return ret;
@@ -83,6 +84,32 @@ bool TestExtJson::test_json_encode() {
   return Count(true);
 }
 
+bool TestExtJson::test_json_encode_to_output() {
+  Array arr = CREATE_MAP3(
+    "a", 1,
+    "b", CREATE_VECTOR2("x/y", "<\xC3\xA9>"),
+    "c", CREATE_MAP1("d", 42)
+  );
+  g_context->obStart();
+  f_json_encode_to_output(arr);
+  String out = g_context->obCopyContents();
+  g_context->obEnd();
+  VS(out, f_json_encode(arr));
+
+  // big enough to be written out in several chunks
+  Array big;
+  for (int i = 0; i < 20000; i++) {
+    big.append(String("item ") + String((int64)i));
+  }
+  g_context->obStart();
+  f_json_encode_to_output(big, k_JSON_UNESCAPED_SLASHES);
+  out = g_context->obCopyContents();
+  g_context->obEnd();
+  VS(out, f_json_encode(big, k_JSON_UNESCAPED_SLASHES));
+
+  return Count(true);
+}
+
 bool TestExtJson::test_json_decode() {
   Array arr = CREATE_MAP1("fbid", 101501853510151001LL);
   VS(f_json_decode(f_json_encode(arr), true), arr);
@@ -127,6 +154,22 @@ bool TestExtJson::test_json_decode() {
   VS(f_json_decode("[{\"a\":\"apple\"},{\"b\":\"banana\"}]", true),
      CREATE_VECTOR2(CREATE_MAP1("a", "apple"), CREATE_MAP1("b", "banana")));
 
+  // strings long enough for the ASCII run scanner, broken up by escapes,
+  // multibyte characters and the other quote character
+  VS(f_json_decode("[\"abcdefghijklmnopqrstuvwxyz0123456789 \\n"
+                   "ABCDEFGHIJKLMNOPQRSTUVWXYZ \\u00e9\xC3\xA9 it's\"]", true),
+     CREATE_VECTOR1("abcdefghijklmnopqrstuvwxyz0123456789 \n"
+                    "ABCDEFGHIJKLMNOPQRSTUVWXYZ \xC3\xA9\xC3\xA9 it's"));
+  VS(f_json_decode("{'abcdefghijklmnopqrstuvwxyz':'say \"hello world\" twice'}",
+                   true, k_JSON_FB_LOOSE),
+     CREATE_MAP1("abcdefghijklmnopqrstuvwxyz", "say \"hello world\" twice"));
+  VS(f_json_decode("[\"abcdefghijklmnopqrstuvwxyz\tnot allowed\"]", true),
+     null);
+  VS(f_json_encode("abcdefghijklmnopqrstuvwxyz/0123456789 <&'@%> \xC3\xA9",
+                   k_JSON_HEX_TAG | k_JSON_HEX_AMP | k_JSON_HEX_APOS),
+     "\"abcdefghijklmnopqrstuvwxyz\\/0123456789 "
+     "\\u003C\\u0026\\u0027@%\\u003E \\u00e9\"");
+
   Variant a = "[{\"a\":[{\"n\":\"1st\"}]},{\"b\":[{\"n\":\"2nd\"}]}]";
   VS(f_json_decode(a, true),
      CREATE_VECTOR2
@@ -28,6 +28,7 @@ class TestExtJson : public TestCppExt {
   virtual bool RunTests(const std::string &which);
 
   bool test_json_encode();
+  bool test_json_encode_to_output();
   bool test_json_decode();
 };
 
@@ -16,6 +16,7 @@
 
 #include <test/test_ext_memcache.h>
 #include <runtime/ext/ext_memcache.h>
+#include <test/test_memcached_info.inc>
 
 IMPLEMENT_SEP_EXTENSION_TEST(Memcache);
 ///////////////////////////////////////////////////////////////////////////////
@@ -29,6 +30,7 @@ bool TestExtMemcache::RunTests(const std::string &which) {
   RUN_TEST(test_memcache_set);
   RUN_TEST(test_memcache_replace);
   RUN_TEST(test_memcache_get);
+  RUN_TEST(test_memcache_defer_get);
   RUN_TEST(test_memcache_delete);
   RUN_TEST(test_memcache_increment);
   RUN_TEST(test_memcache_decrement);
@@ -73,6 +75,52 @@ bool TestExtMemcache::test_memcache_get() {
   return Count(true);
 }
 
+#define EXPIRATION 60
+#define CREATE_MEMCACHE()                                               \
+  p_Memcache memc(p_Memcache(NEWOBJ(c_Memcache))->create());            \
+  memc->t_connect(TEST_MEMCACHED_HOSTNAME, TEST_MEMCACHED_PORT);        \
+  if (memc->t_getversion().same(false)) {                               \
+    SKIP("No memcached running");                                       \
+    return Count(true);                                                 \
+  }
+
+bool TestExtMemcache::test_memcache_defer_get() {
+  CREATE_MEMCACHE();
+
+  VERIFY(memc->t_set("defer_a", "a", 0, EXPIRATION));
+  // flag 1 is MMC_SERIALIZED: a stored false, which set() can't make
+  VERIFY(memc->t_set("defer_b", "b:0;", 1, EXPIRATION));
+  VERIFY(memc->t_set("defer_c", "c", 0, EXPIRATION));
+  memc->t_delete("defer_missing");
+
+  VERIFY(f_memcache_defer_get(memc, CREATE_VECTOR3("defer_b", "defer_c",
+                                                   "defer_missing")));
+
+  // fetches the deferred keys too, but only returns what was asked for
+  VS(memc->t_get(CREATE_VECTOR1("defer_a")), CREATE_MAP1("defer_a", "a"));
+
+  // served from what the first get brought back; a cached false is a hit
+  VS(memc->t_get(CREATE_VECTOR3("defer_b", "defer_c", "defer_missing")),
+     CREATE_MAP2("defer_b", false, "defer_c", "c"));
+  VS(memc->t_get("defer_b"), false);
+  VS(memc->t_get("defer_c"), "c");
+
+  // writes drop the cached value
+  VERIFY(memc->t_set("defer_c", "c2", 0, EXPIRATION));
+  VS(memc->t_get(CREATE_VECTOR1("defer_c")), CREATE_MAP1("defer_c", "c2"));
+
+  // without the request cache, a deferred value is only read once
+  p_Memcache other(p_Memcache(NEWOBJ(c_Memcache))->create());
+  other->t_connect(TEST_MEMCACHED_HOSTNAME, TEST_MEMCACHED_PORT);
+  VERIFY(f_memcache_defer_get(memc, "defer_c"));
+  VS(memc->t_get("defer_a"), "a");
+  VERIFY(other->t_set("defer_c", "c3", 0, EXPIRATION));
+  VS(memc->t_get("defer_c"), "c2");
+  VS(memc->t_get("defer_c"), "c3");
+
+  return Count(true);
+}
+
 bool TestExtMemcache::test_memcache_delete() {
   return Count(true);
 }
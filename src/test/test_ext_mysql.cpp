@@ -51,6 +51,9 @@ bool TestExtMysql::RunTests(const std::string &which) {
   RUN_TEST(test_mysql_set_timeout);
   RUN_TEST(test_mysql_query);
   RUN_TEST(test_mysql_unbuffered_query);
+  RUN_TEST(test_mysql_async_query);
+  RUN_TEST(test_mysql_async_wait);
+  RUN_TEST(test_mysql_async_result);
   RUN_TEST(test_mysql_db_query);
   RUN_TEST(test_mysql_list_dbs);
   RUN_TEST(test_mysql_list_tables);
@@ -323,6 +326,63 @@ bool TestExtMysql::test_mysql_unbuffered_query() {
   return Count(true);
 }
 
+bool TestExtMysql::test_mysql_async_query() {
+  Variant conn = f_mysql_connect(TEST_HOSTNAME, TEST_USERNAME, TEST_PASSWORD);
+  VERIFY(CreateTestTable());
+  VS(f_mysql_async_query("insert into test (name) values ('test')"), true);
+  VS(f_mysql_async_result(), true);
+
+  // a pending result is thrown away before the link is used again
+  VS(f_mysql_async_query("select * from test"), true);
+  Variant res = f_mysql_query("select count(*) from test");
+  VS(f_mysql_result(res, 0), 1);
+  VS(f_mysql_async_result(), false);
+
+  // and so it is for calls other than queries
+  VS(f_mysql_async_query("select * from test"), true);
+  VS(f_mysql_ping(), true);
+  VS(f_mysql_select_db(TEST_DATABASE), true);
+  VS(f_mysql_async_result(), false);
+  return Count(true);
+}
+
+bool TestExtMysql::test_mysql_async_wait() {
+  Variant conn1 = f_mysql_connect(TEST_HOSTNAME, TEST_USERNAME, TEST_PASSWORD,
+                                  true);
+  Variant conn2 = f_mysql_connect(TEST_HOSTNAME, TEST_USERNAME, TEST_PASSWORD,
+                                  true);
+  VS(f_mysql_async_query("select sleep(1), 1", conn1), true);
+  VS(f_mysql_async_query("select 2", conn2), true);
+
+  Array links = CREATE_MAP2("slow", conn1, "fast", conn2);
+  VS(f_mysql_async_wait(links, 500), CREATE_VECTOR1("fast"));
+  VS(f_mysql_result(f_mysql_async_result(conn2), 0), 2);
+  VS(f_mysql_async_wait(links), CREATE_VECTOR1("slow"));
+  VS(f_mysql_result(f_mysql_async_result(conn1), 0, 1), 1);
+
+  // nothing outstanding any more
+  VS(f_mysql_async_wait(links, 0), Array::Create());
+  return Count(true);
+}
+
+bool TestExtMysql::test_mysql_async_result() {
+  Variant conn = f_mysql_connect(TEST_HOSTNAME, TEST_USERNAME, TEST_PASSWORD);
+  VERIFY(CreateTestTable());
+  VS(f_mysql_query("insert into test (name) values ('test'),('test2')"), true);
+
+  VS(f_mysql_async_query("select * from test"), true);
+  Variant res = f_mysql_async_result(null, false);
+  Variant row = f_mysql_fetch_assoc(res);
+  VS(row["name"], "test");
+  row = f_mysql_fetch_assoc(res);
+  VS(row["name"], "test2");
+  VS(f_mysql_fetch_assoc(res), false);
+
+  VS(f_mysql_async_query("select * from no_such_table"), true);
+  VS(f_mysql_async_result(), false);
+  return Count(true);
+}
+
 bool TestExtMysql::test_mysql_db_query() {
   try {
     f_mysql_db_query("", "");
@@ -481,6 +541,18 @@ bool TestExtMysql::test_mysql_fetch_array() {
      "    [1] => test\n"
      "    [name] => test\n"
      ")\n");
+
+  // numeric columns come back typed, without a string in between
+  res = f_mysql_query("select id, id * 1e0 as d, null as n from test");
+  row = f_mysql_fetch_assoc(res);
+  VS(row, CREATE_MAP3("id", 1, "d", 1.0, "n", null));
+  VERIFY(row["id"].isInteger());
+  VERIFY(row["d"].isDouble());
+  VERIFY(row["n"].isNull());
+  row = f_mysql_fetch_array(res, 3);
+  VS(row[0], 2);
+  VS(row["d"], 2.0);
+  VS(f_mysql_fetch_row(res), false);
   return Count(true);
 }
 
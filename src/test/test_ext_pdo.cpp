@@ -29,6 +29,7 @@ bool TestExtPdo::RunTests(const std::string &which) {
 
   RUN_TEST(test_pdo_drivers);
   RUN_TEST(test_pdo_mysql);
+  RUN_TEST(test_pdo_mysql_prepared);
   RUN_TEST(test_pdo_sqlite);
 
   return ret;
@@ -44,6 +45,19 @@ static void CreateMySqlTestTable() {
   f_mysql_query("insert into test (name) values ('test'),('test2')");
 }
 
+static string MySqlTestSource() {
+  string source = "mysql:host=";
+  string host = TEST_HOSTNAME;
+  size_t pos = host.find(':');
+  if (pos != string::npos) {
+    host.replace(pos, 1, ";port=");
+  }
+  source += host;
+  source += ";dbname=";
+  source += TEST_DATABASE;
+  return source;
+}
+
 static void CreateSqliteTestTable() {
   f_unlink("/tmp/foo.db");
   p_SQLite3 db(NEWOBJ(c_SQLite3)());
@@ -96,6 +110,61 @@ bool TestExtPdo::test_pdo_mysql() {
   return Count(true);
 }
 
+bool TestExtPdo::test_pdo_mysql_prepared() {
+  CreateMySqlTestTable();
+
+  try {
+    p_PDO dbh((NEWOBJ(c_PDO)())->
+              create(MySqlTestSource().c_str(), TEST_USERNAME, TEST_PASSWORD,
+                     CREATE_MAP2(q_PDO$$ATTR_PERSISTENT, false,
+                                 q_PDO$$ATTR_EMULATE_PREPARES, false)));
+
+    // one server-side statement, executed repeatedly
+    Variant vstmt = dbh->t_prepare("insert into test (name) values (?)");
+    c_PDOStatement *stmt = vstmt.toObject().getTyped<c_PDOStatement>();
+    for (int i = 0; i < 200; i++) {
+      VERIFY(stmt->t_execute(CREATE_VECTOR1(String("row") + String(i))));
+    }
+    vstmt.reset();
+
+    // the same SQL prepared again comes out of the connection's cache
+    for (int i = 0; i < 3; i++) {
+      vstmt = dbh->t_prepare("select name from test where id = ?");
+      stmt = vstmt.toObject().getTyped<c_PDOStatement>();
+      VERIFY(stmt->t_execute(CREATE_VECTOR1(2)));
+      VS(stmt->t_fetch(q_PDO$$FETCH_ASSOC), CREATE_MAP1("name", "test2"));
+      VS(stmt->t_fetch(q_PDO$$FETCH_ASSOC), false);
+      vstmt.reset();
+    }
+
+    // unbuffered: rows are read from the server as they are fetched
+    vstmt = dbh->t_prepare("select id, name from test order by id",
+                           CREATE_MAP1(q_PDO$$MYSQL_ATTR_USE_BUFFERED_QUERY,
+                                       false));
+    stmt = vstmt.toObject().getTyped<c_PDOStatement>();
+    VERIFY(stmt->t_execute());
+    VS(stmt->t_fetch(q_PDO$$FETCH_ASSOC),
+       CREATE_MAP2("id", "1", "name", "test"));
+    int rows = 1;
+    while (!same(stmt->t_fetch(q_PDO$$FETCH_ASSOC), false)) rows++;
+    VS(rows, 202);
+
+    // abandoning an unbuffered result part way leaves the connection usable
+    VERIFY(stmt->t_execute());
+    VS(stmt->t_fetch(q_PDO$$FETCH_ASSOC),
+       CREATE_MAP2("id", "1", "name", "test"));
+    vstmt.reset();
+    vstmt = dbh->t_prepare("select count(*) as n from test");
+    stmt = vstmt.toObject().getTyped<c_PDOStatement>();
+    VERIFY(stmt->t_execute());
+    VS(stmt->t_fetch(q_PDO$$FETCH_ASSOC), CREATE_MAP1("n", "202"));
+
+  } catch (Object &e) {
+    VS(e, null);
+  }
+  return Count(true);
+}
+
 bool TestExtPdo::test_pdo_sqlite() {
   CreateSqliteTestTable();
 
@@ -36,6 +36,8 @@ bool TestExtServer::RunTests(const std::string &which) {
   RUN_TEST(test_pagelet_server_task_start);
   RUN_TEST(test_pagelet_server_task_status);
   RUN_TEST(test_pagelet_server_task_result);
+  RUN_TEST(test_pagelet_server_task_start_batch);
+  RUN_TEST(test_pagelet_server_task_select);
   RUN_TEST(test_xbox_send_message);
   RUN_TEST(test_xbox_post_message);
   RUN_TEST(test_xbox_task_start);
@@ -119,6 +121,67 @@ bool TestExtServer::test_pagelet_server_task_result() {
   return Count(true);
 }
 
+bool TestExtServer::test_pagelet_server_task_start_batch() {
+  // tested in test_pagelet_server_task_select()
+  return Count(true);
+}
+
+bool TestExtServer::test_pagelet_server_task_select() {
+  const int TEST_SIZE = 20;
+
+  String baseurl("pageletserver?getparam=");
+  String baseheader("MyHeader: ");
+  String basepost("postparam=");
+
+  Array requests;
+  for (int i = 0; i < TEST_SIZE; ++i) {
+    Array request;
+    request.set("url", baseurl + String(i));
+    request.set("headers", CREATE_VECTOR1(baseheader + String(i)));
+    request.set("post_data", basepost + String(i));
+    requests.set(String("task") + String(i), request);
+  }
+  Array tasks = f_pagelet_server_task_start_batch(requests);
+  VS(tasks.size(), TEST_SIZE);
+
+  // selecting on nothing never blocks
+  VS(f_pagelet_server_task_select(Array::Create(), 0), Array::Create());
+
+  // A task is ready once it has flushed some output or is done; keep
+  // reading until every one of them has handed back its final result.
+  Array pending = tasks;
+  Array output;
+  while (!pending.empty()) {
+    Array ready = f_pagelet_server_task_select(pending, 0);
+    VERIFY(!ready.empty());
+    for (ArrayIter iter(ready); iter; ++iter) {
+      Variant key = iter.second();
+      VERIFY(pending.exists(key));
+      Object task = pending[key].toObject();
+      VERIFY(f_pagelet_server_task_status(task) != k_PAGELET_NOT_READY);
+
+      Variant code, headers;
+      String chunk = f_pagelet_server_task_result(task, ref(headers),
+                                                  ref(code), 0);
+      output.set(key, output.rvalAt(key).toString() + chunk);
+      if (same(code, 0)) continue; // partial output, more to come
+      VS(code, 200);
+
+      int i = key.toString().substr(4).toInt32();
+      String expected = "pagelet postparam: postparam=";
+      expected += String(i);
+      expected += "pagelet getparam: ";
+      expected += String(i);
+      expected += "pagelet header: ";
+      expected += String(i);
+      VS(output.rvalAt(key), expected);
+      pending.remove(key);
+    }
+  }
+
+  return Count(true);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 bool TestExtServer::test_xbox_send_message() {
@@ -383,6 +383,32 @@ bool TestExtVariable::test_unserialize() {
     Variant v2 = f_unserialize("a:3:{s:1:\"a\";s:5:\"apple\";s:1:\"b\";i:2;s:1:\"c\";a:3:{i:0;i:1;i:1;s:1:\"y\";i:2;i:3;}}");
     VS(v1, v2);
   }
+  {
+    // repeated keys share one string
+    Variant v = f_unserialize("a:2:{i:0;a:2:{s:1:\"a\";i:1;s:1:\"b\";i:2;}"
+                              "i:1;a:2:{s:1:\"a\";i:3;s:1:\"b\";i:4;}}");
+    VS(v, CREATE_VECTOR2(CREATE_MAP2("a", 1, "b", 2),
+                         CREATE_MAP2("a", 3, "b", 4)));
+  }
+  {
+    // same property names on several objects
+    Variant v = f_unserialize("a:2:{i:0;O:8:\"stdClass\":1:{s:1:\"x\";i:1;}"
+                              "i:1;O:8:\"stdClass\":1:{s:1:\"x\";i:2;}}");
+    VS(v[0].toObject().o_get("x"), 1);
+    VS(v[1].toObject().o_get("x"), 2);
+  }
+  {
+    Variant v = f_unserialize("a:3:{i:0;s:1:\"x\";i:1;R:2;i:2;r:2;}");
+    VS(v, CREATE_VECTOR3("x", "x", "x"));
+    v.lvalAt(1) = "y";
+    VS(v[0], "y");
+    VS(v[2], "x");
+  }
+  {
+    // "r:" that only appears in string data
+    Variant v = f_unserialize("a:1:{s:2:\"r:\";s:2:\"R:\";}");
+    VS(v, CREATE_MAP1("r:", "R:"));
+  }
   return Count(true);
 }
 
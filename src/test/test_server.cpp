@@ -34,9 +34,14 @@ using namespace HPHP;
 #define PORT_MIN 7300
 #define PORT_MAX 7320
 
+#define ADMIN_PORT 8088
+#define PEER_ADMIN_PORT 8089
+#define PEER_RPC_PORT 8084
+#define PEER_XBOX_PORT 8091
+
 ///////////////////////////////////////////////////////////////////////////////
 
-TestServer::TestServer() {
+TestServer::TestServer() : m_withPeer(false) {
   TestCodeRun::FastMode = false;
 }
 
@@ -73,6 +78,8 @@ bool TestServer::VerifyServerResponse(const char *input, const char *output,
 
   AsyncFunc<TestServer> func(this, &TestServer::RunServer);
   func.start();
+  AsyncFunc<TestServer> peer(this, &TestServer::RunPeerServer);
+  if (m_withPeer) peer.start();
 
   String server = "http://";
   server += f_php_uname("n");
@@ -104,6 +111,10 @@ bool TestServer::VerifyServerResponse(const char *input, const char *output,
 
   AsyncFunc<TestServer>(this, &TestServer::StopServer).run();
   func.waitForEnd();
+  if (m_withPeer) {
+    AsyncFunc<TestServer>(this, &TestServer::StopPeerServer).run();
+    peer.waitForEnd();
+  }
 
   bool passed = (actual == output);
   if (responseHeader) {
@@ -145,13 +156,41 @@ void TestServer::RunServer() {
   }
 }
 
-void TestServer::StopServer() {
+void TestServer::RunPeerServer() {
+  string out, err;
+  // next to the main server's port; TestLibeventServer found that range free
+  string portConfig = "Server.Port=" + lexical_cast<string>(s_server_port + 1);
+  string adminConfig =
+    "AdminServer.Port=" + lexical_cast<string>(PEER_ADMIN_PORT);
+  string rpcConfig =
+    "Satellites.rpc.Port=" + lexical_cast<string>(PEER_RPC_PORT);
+  string xboxConfig =
+    "Xbox.ServerInfo.Port=" + lexical_cast<string>(PEER_XBOX_PORT);
+
+  if (Option::EnableEval < Option::FullEval) {
+    const char *argv[] = {"", "--mode=server",
+                          "--config=test/config-server.hdf",
+                          "-v", portConfig.c_str(), "-v", adminConfig.c_str(),
+                          "-v", rpcConfig.c_str(), "-v", xboxConfig.c_str(),
+                          NULL};
+    Process::Exec("runtime/tmp/TestServer/test", argv, NULL, out, &err);
+  } else {
+    const char *argv[] = {"", "--file=/unittest/rootdoc/string",
+                          "--mode=server", "--config=test/config-eval.hdf",
+                          "-v", portConfig.c_str(), "-v", adminConfig.c_str(),
+                          "-v", rpcConfig.c_str(), "-v", xboxConfig.c_str(),
+                          NULL};
+    Process::Exec(HHVM_PATH, argv, NULL, out, &err);
+  }
+}
+
+static void stopServerAt(int adminPort) {
   for (int i = 0; i < 10; i++) {
     string out, err;
     Variant c = f_curl_init();
     String url = "http://";
     url += f_php_uname("n");
-    url += ":8088/stop";
+    url += ":" + lexical_cast<string>(adminPort) + "/stop";
     f_curl_setopt(c, k_CURLOPT_URL, url);
     f_curl_setopt(c, k_CURLOPT_RETURNTRANSFER, true);
     Variant res = f_curl_exec(c);
@@ -162,6 +201,14 @@ void TestServer::StopServer() {
   }
 }
 
+void TestServer::StopServer() {
+  stopServerAt(ADMIN_PORT);
+}
+
+void TestServer::StopPeerServer() {
+  stopServerAt(PEER_ADMIN_PORT);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 bool TestServer::RunTests(const std::string &which) {
@@ -186,7 +233,10 @@ bool TestServer::RunTests(const std::string &which) {
   RUN_TEST(TestHttpClient);
   RUN_TEST(TestRPCServer);
   RUN_TEST(TestXboxServer);
+  RUN_TEST(TestXboxServerRemote);
   RUN_TEST(TestPageletServer);
+  RUN_TEST(TestPageCache);
+  RUN_TEST(TestRequestTrace);
 
   return ret;
 }
@@ -697,6 +747,43 @@ bool TestServer::TestXboxServer() {
   return true;
 }
 
+bool TestServer::TestXboxServerRemote() {
+  // The main instance sends to the peer's xbox port over pooled connections
+  // (see Xbox.ConnectionPool in test/config-server.hdf); nothing listens on
+  // the last port.
+  m_withPeer = true;
+  bool ret = VerifyServerResponse(
+        "<?php\n"
+        "if (array_key_exists('main', $_GET)) {\n"
+        "  $peer = '127.0.0.1:8091';\n"
+        "  for ($i = 0; $i < 10; $i++) {\n"
+        "    if (xbox_send_message('ping', $r, 1000, $peer)) break;\n"
+        "    sleep(1); // wait until the peer is up\n"
+        "  }\n"
+        "  var_dump($r['code'], $r['response']);\n"
+        "  for ($i = 0; $i < 3; $i++) {\n"
+        "    xbox_send_message('ping' . $i, $r, 1000, $peer);\n"
+        "    var_dump($r['response']);\n"
+        "  }\n"
+        "  var_dump(xbox_post_message('ping', $peer));\n"
+        "  var_dump(xbox_send_message('ping', $r, 1000, '127.0.0.1:8092'));\n"
+        "  var_dump($r['code']);\n"
+        "} else {\n"
+        "  function xbox_process_message($msg) { return 'pong ' . $msg; }\n"
+        "}\n",
+        "int(200)\n"
+        "string(9) \"pong ping\"\n"
+        "string(10) \"pong ping0\"\n"
+        "string(10) \"pong ping1\"\n"
+        "string(10) \"pong ping2\"\n"
+        "bool(true)\n"
+        "bool(false)\n"
+        "int(502)\n",
+        "string?main=1", "GET", NULL, NULL, false, __FILE__, __LINE__);
+  m_withPeer = false;
+  return Count(ret);
+}
+
 bool TestServer::TestPageletServer() {
   VSGET("<?php\n"
         "if (array_key_exists('pagelet', $_GET)) {\n"
@@ -755,3 +842,102 @@ bool TestServer::TestPageletServer() {
 
   return true;
 }
+
+bool TestServer::TestPageCache() {
+  VSGET("<?php\n"
+        "if (array_key_exists('cached', $_GET)) {\n"
+        "  echo uniqid();\n"
+        "} else {\n"
+        "  $h = array('Host: ' . $_SERVER['HTTP_HOST']);\n"
+        "  $r = array();\n"
+        "  foreach (array('cached=1', 'cached=1', 'cached=2') as $q) {\n"
+        "    $t = pagelet_server_task_start('/string?' . $q, $h, '');\n"
+        "    $r[] = pagelet_server_task_result($t, $h, $c);\n"
+        "  }\n"
+        "  var_dump($r[0] === $r[1], $r[0] === $r[2]);\n"
+        "}\n",
+        "bool(true)\nbool(false)\n",
+        "string");
+
+  // the same URL on another Host is a different page
+  VSGET("<?php\n"
+        "if (array_key_exists('cached', $_GET)) {\n"
+        "  echo $_SERVER['HTTP_HOST'];\n"
+        "} else {\n"
+        "  $r = array();\n"
+        "  foreach (array('a.example', 'b.example', 'a.example') as $host) {\n"
+        "    $h = array('Host: ' . $host);\n"
+        "    $t = pagelet_server_task_start('/string?cached=3', $h, '');\n"
+        "    $r[] = pagelet_server_task_result($t, $h, $c);\n"
+        "  }\n"
+        "  var_dump($r);\n"
+        "}\n",
+        "array(3) {\n"
+        "  [0]=>\n"
+        "  string(9) \"a.example\"\n"
+        "  [1]=>\n"
+        "  string(9) \"b.example\"\n"
+        "  [2]=>\n"
+        "  string(9) \"a.example\"\n"
+        "}\n",
+        "string");
+
+  return true;
+}
+
+bool TestServer::TestRequestTrace() {
+  // config-server.hdf trusts 127.0.0.1 only
+  VSGET("<?php\n"
+        "function get($url, $id = null, $from = null) {\n"
+        "  $c = curl_init($url);\n"
+        "  curl_setopt($c, CURLOPT_RETURNTRANSFER, true);\n"
+        "  if ($id !== null) {\n"
+        "    curl_setopt($c, CURLOPT_HTTPHEADER,\n"
+        "                array('X-HPHP-Trace-Id: ' . $id));\n"
+        "  }\n"
+        "  if ($from !== null) curl_setopt($c, CURLOPT_INTERFACE, $from);\n"
+        "  return curl_exec($c);\n"
+        "}\n"
+        "function traced($id) {\n"
+        "  // the trace is written after the response goes out\n"
+        "  for ($i = 0; $i < 20; $i++) {\n"
+        "    $recent = get('http://127.0.0.1:8088/trace-recent');\n"
+        "    if (strpos($recent, '\"traceId\":\"' . $id . '\"') !== false) {\n"
+        "      return true;\n"
+        "    }\n"
+        "    usleep(50000);\n"
+        "  }\n"
+        "  return false;\n"
+        "}\n"
+        "$port = $_SERVER['SERVER_PORT'];\n"
+        "$self = 'http://127.0.0.1:' . $port . '/string';\n"
+        "if (array_key_exists('echo', $_GET)) {\n"
+        "  echo array_key_exists('HTTP_X_HPHP_TRACE_ID', $_SERVER) ?\n"
+        "    $_SERVER['HTTP_X_HPHP_TRACE_ID'] : '-';\n"
+        "} else if (array_key_exists('fwd', $_GET)) {\n"
+        "  echo get($self . '?echo=1'), ' ',\n"
+        "    get('http://localhost:' . $port . '/string?echo=1');\n"
+        "} else {\n"
+        "  get($self . '?echo=1', 'good-id-1');\n"
+        "  get($self . '?echo=1', 'bad.id');\n"
+        "  get($self . '?echo=1', str_repeat('a', 65));\n"
+        "  get($self . '?echo=1', 'outside-id', '127.0.0.2');\n"
+        "  // a page can't pick its pagelets' trace ids; this one isn't traced\n"
+        "  $h = array('X-HPHP-Trace-Id: pagelet-id');\n"
+        "  $t = pagelet_server_task_start('/string?echo=1', $h, '');\n"
+        "  pagelet_server_task_result($t, $h, $c);\n"
+        "  var_dump(traced('good-id-1'), traced('bad.id'),\n"
+        "           traced(str_repeat('a', 65)), traced('outside-id'),\n"
+        "           traced('pagelet-id'));\n"
+        "  echo get($self . '?fwd=1', 'fwd-id'), \"\\n\";\n"
+        "}\n",
+        "bool(true)\n"
+        "bool(false)\n"
+        "bool(false)\n"
+        "bool(false)\n"
+        "bool(false)\n"
+        "fwd-id -\n",
+        "string");
+
+  return true;
+}
@@ -59,13 +59,24 @@ public:
 
   // test XboxServer
   bool TestXboxServer();
+  bool TestXboxServerRemote();
 
   // test PageletServer
   bool TestPageletServer();
 
+  // test full-page cache
+  bool TestPageCache();
+
+  // test which trace ids a request takes and passes on
+  bool TestRequestTrace();
+
 protected:
   void RunServer();
   void StopServer();
+  // a second instance with its own ports, for cross-server tests
+  void RunPeerServer();
+  void StopPeerServer();
+  bool m_withPeer;
   bool VerifyServerResponse(const char *input, const char *output,
                             const char *url, const char *method,
                             const char *header, const char *postdata,
@@ -0,0 +1,506 @@
+/*
+   +----------------------------------------------------------------------+
+   | HipHop for PHP                                                       |
+   +----------------------------------------------------------------------+
+   | Copyright (c) 2010- Facebook, Inc. (http://www.facebook.com)         |
+   +----------------------------------------------------------------------+
+   | This source file is subject to version 3.01 of the PHP license,      |
+   | that is bundled with this package in the file LICENSE, and is        |
+   | available through the world-wide-web at the following url:           |
+   | http://www.php.net/license/3_01.txt                                  |
+   | If you did not receive a copy of the PHP license and are unable to   |
+   | obtain it through the world-wide-web, please send a note to          |
+   | license@php.net so we can mail you a copy immediately.               |
+   +----------------------------------------------------------------------+
+*/
+
+#include <test/test_vm.h>
+#include <compiler/analysis/emitter.h>
+#include <compiler/analysis/analysis_result.h>
+#include <compiler/analysis/file_scope.h>
+#include <compiler/option.h>
+#include <runtime/vm/flat_repo.h>
+#include <runtime/vm/repo.h>
+#include <runtime/vm/autoload_index.h>
+#include <runtime/eval/runtime/file_repository.h>
+#include <runtime/base/runtime_option.h>
+#include <util/async_func.h>
+#include <util/zend/zend_string.h>
+#include <dirent.h>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+
+using namespace HPHP::VM;
+
+///////////////////////////////////////////////////////////////////////////////
+
+TestVm::TestVm() {
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool TestVm::RunTests(const std::string &which) {
+  bool ret = true;
+  RUN_TEST(TestFlatRepoRoundTrip);
+  RUN_TEST(TestFlatRepoBounds);
+  RUN_TEST(TestPreloadThenRequest);
+  RUN_TEST(TestAutoloadIndexRoots);
+  RUN_TEST(TestCommitBatchFailure);
+  RUN_TEST(TestFuncProfileLoad);
+  RUN_TEST(TestFilesByHotness);
+  return ret;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// helpers
+
+static bool read_file(const std::string &path, std::string &out) {
+  std::ifstream f(path.c_str(), std::ios::binary);
+  if (!f) return false;
+  std::ostringstream ss;
+  ss << f.rdbuf();
+  out = ss.str();
+  return true;
+}
+
+static MD5 md5_of(const std::string &code) {
+  int len;
+  char *hex = string_md5(code.data(), code.size(), false, len);
+  MD5 md5(hex);
+  free(hex);
+  return md5;
+}
+
+/**
+ * PHP sources in the test/vm corpus, relative to src/.
+ */
+static void corpus_files(std::vector<std::string> &files) {
+  const char *dir = "test/vm";
+  DIR *d = opendir(dir);
+  if (!d) return;
+  while (struct dirent *e = readdir(d)) {
+    size_t len = strlen(e->d_name);
+    if (len > 4 && !strcmp(e->d_name + len - 4, ".php")) {
+      files.push_back(std::string(dir) + "/" + e->d_name);
+    }
+  }
+  closedir(d);
+  std::sort(files.begin(), files.end());
+}
+
+#define UNIT_SAME(what, a, b)                                           \
+  if ((a) != (b)) {                                                     \
+    LOG_TEST_ERROR("%s: %s differs after the round trip", file, what);  \
+    return false;                                                       \
+  }
+
+static bool same_func(const char *file, const Func *a, const Func *b) {
+  UNIT_SAME("func name", a->fullName()->data(), b->fullName()->data());
+  UNIT_SAME("func base", a->base(), b->base());
+  UNIT_SAME("func past", a->past(), b->past());
+  UNIT_SAME("func line", a->line1(), b->line1());
+  UNIT_SAME("func params", a->numParams(), b->numParams());
+  UNIT_SAME("func locals", a->numLocals(), b->numLocals());
+  UNIT_SAME("func iterators", a->numIterators(), b->numIterators());
+  UNIT_SAME("func attrs", a->attrs(), b->attrs());
+  UNIT_SAME("func return type", a->returnType(), b->returnType());
+  return true;
+}
+
+static bool same_unit(const char *file, const Unit *a, const Unit *b) {
+  UNIT_SAME("bytecode length", a->bclen(), b->bclen());
+  UNIT_SAME("bytecode", memcmp(a->entry(), b->entry(), a->bclen()), 0);
+  for (Offset off = 0; off < a->bclen(); ++off) {
+    UNIT_SAME("line table", a->getLineNumber(off), b->getLineNumber(off));
+  }
+
+  UNIT_SAME("litstr count", a->numLitstrs(), b->numLitstrs());
+  for (size_t i = 0; i < a->numLitstrs(); ++i) {
+    UNIT_SAME("litstr", a->lookupLitstrId(i), b->lookupLitstrId(i));
+  }
+  UNIT_SAME("array count", a->numArrays(), b->numArrays());
+  for (size_t i = 0; i < a->numArrays(); ++i) {
+    UNIT_SAME("array", Variant(a->lookupArrayId(i)).same(
+                         Variant(b->lookupArrayId(i))), true);
+  }
+
+  UNIT_SAME("main return type", a->getMainReturn()->m_type,
+            b->getMainReturn()->m_type);
+  UNIT_SAME("merge only", a->isMergeOnly(), b->isMergeOnly());
+
+  UNIT_SAME("class count", a->numPreClasses(), b->numPreClasses());
+  for (size_t i = 0; i < a->numPreClasses(); ++i) {
+    const PreClass *pa = a->lookupPreClassId(i);
+    const PreClass *pb = b->lookupPreClassId(i);
+    UNIT_SAME("class name", pa->name(), pb->name());
+    UNIT_SAME("class attrs", pa->attrs(), pb->attrs());
+    UNIT_SAME("class methods", pa->numMethods(), pb->numMethods());
+    UNIT_SAME("class properties", pa->numProperties(), pb->numProperties());
+    UNIT_SAME("class constants", pa->numConstants(), pb->numConstants());
+    for (size_t m = 0; m < pa->numMethods(); ++m) {
+      if (!same_func(file, pa->methods()[m], pb->methods()[m])) return false;
+    }
+  }
+
+  std::vector<const Func*> fa, fb;
+  for (Unit::FuncRange r = a->funcs(); !r.empty(); ) fa.push_back(r.popFront());
+  for (Unit::FuncRange r = b->funcs(); !r.empty(); ) fb.push_back(r.popFront());
+  UNIT_SAME("func count", fa.size(), fb.size());
+  for (size_t i = 0; i < fa.size(); ++i) {
+    if (!same_func(file, fa[i], fb[i])) return false;
+  }
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool TestVm::TestFlatRepoRoundTrip() {
+  std::vector<std::string> files;
+  corpus_files(files);
+  VERIFY(!files.empty());
+
+  for (unsigned int i = 0; i < files.size(); i++) {
+    std::string code;
+    VERIFY(read_file(files[i], code));
+    MD5 md5 = md5_of(code);
+    UnitEmitter *ue = Compiler::hphp_compiler_emit(code.data(), code.size(),
+                                                   md5, files[i].c_str());
+    if (!ue) continue; // some of the corpus is meant not to parse
+
+    Unit *expected = ue->create();
+    Unit *actual = FlatRepo::RoundTrip(*ue);
+    bool same = same_unit(files[i].c_str(), expected, actual);
+    delete expected;
+    delete actual;
+    delete ue;
+    VERIFY(same);
+  }
+  return Count(true);
+}
+
+static bool write_file(const char *path, const std::string &data) {
+  std::ofstream f(path, std::ios::binary | std::ios::trunc);
+  f.write(data.data(), data.size());
+  f.close();
+  return !f.fail();
+}
+
+bool TestVm::TestFlatRepoBounds() {
+  // header layout from flat_repo.cpp
+  struct Header {
+    char magic[8];
+    char schema[64];
+    uint32_t nBuckets;
+    uint32_t nUnits;
+    uint64_t fileBucketOff;
+    uint64_t unitBucketOff;
+  };
+  const char *path = "/tmp/test_vm_flat_repo";
+  const size_t fileBucketSize = 32, unitBucketSize = 48;
+
+  Header h;
+  memset(&h, 0, sizeof(h));
+  memcpy(h.magic, "HHBCFLAT", 8);
+  strncpy(h.schema, Repo::kSchemaId, sizeof(h.schema));
+  h.nBuckets = 4;
+  h.fileBucketOff = sizeof(h);
+  h.unitBucketOff = h.fileBucketOff + h.nBuckets * fileBucketSize;
+  std::string tables(h.nBuckets * (fileBucketSize + unitBucketSize), '\0');
+
+  // empty but well formed
+  std::string good((const char*)&h, sizeof(h));
+  good += tables;
+  VERIFY(write_file(path, good));
+  FlatRepo *repo = FlatRepo::Open(path);
+  VERIFY(repo != NULL);
+  delete repo;
+
+  // tables running past the end of the file
+  VERIFY(write_file(path, good.substr(0, good.size() - 1)));
+  VERIFY(FlatRepo::Open(path) == NULL);
+
+  // a path pointing past the end of the file
+  std::string bad = good;
+  uint64_t pathOff = good.size() + 100;
+  uint32_t pathLen = 4;
+  memcpy(&bad[h.fileBucketOff], &pathOff, sizeof(pathOff));
+  memcpy(&bad[h.fileBucketOff + 8], &pathLen, sizeof(pathLen));
+  VERIFY(write_file(path, bad));
+  VERIFY(FlatRepo::Open(path) == NULL);
+
+  // a unit whose blob runs past the end of the file
+  bad = good + "data";
+  uint64_t off = good.size();
+  uint32_t blobLen = 1000;
+  memcpy(&bad[h.unitBucketOff + 16], &off, sizeof(off));
+  memcpy(&bad[h.unitBucketOff + 32], &blobLen, sizeof(blobLen));
+  VERIFY(write_file(path, bad));
+  VERIFY(FlatRepo::Open(path) == NULL);
+
+  unlink(path);
+  return Count(true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static int loaded_under(const std::string &root) {
+  std::vector<std::string> names;
+  Eval::FileRepository::getLoadedFileNames(names);
+  int count = 0;
+  for (unsigned int i = 0; i < names.size(); i++) {
+    if (names[i].compare(0, root.size(), root) == 0) count++;
+  }
+  return count;
+}
+
+bool TestVm::TestPreloadThenRequest() {
+  char dir[] = "/tmp/test_vm_preloadXXXXXX";
+  VERIFY(mkdtemp(dir) != NULL);
+  std::string root = std::string(dir) + "/";
+  std::string path = root + "preload.php";
+  VERIFY(write_file(path.c_str(), "<?php\nclass TestVmPreloaded {}\n"));
+
+  // the repo and the preload list name files relative to the source root
+  std::string oldRoot = RuntimeOption::SourceRoot;
+  RuntimeOption::SourceRoot = root;
+  Eval::FileRepository::preloadUnits(
+    std::vector<std::string>(1, "preload.php"));
+  RuntimeOption::SourceRoot = oldRoot;
+  int preloaded = loaded_under(root);
+
+  // a request for the same file must get the preloaded unit rather than
+  // parse a second one
+  StringData *name = StringData::GetStaticString(path);
+  struct stat s;
+  bool found = Eval::FileRepository::findFile(name, &s);
+  Eval::PhpFile *f =
+    found ? Eval::FileRepository::checkoutFile(name, s) : NULL;
+  if (f) f->decRefAndDelete();
+  int requested = loaded_under(root);
+
+  unlink(path.c_str());
+  rmdir(dir);
+  VERIFY(f != NULL);
+  VS(preloaded, 1);
+  VS(requested, 1);
+  return Count(true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static Unit *compile_unit(const std::string &code, const char *path) {
+  UnitEmitter *ue = Compiler::hphp_compiler_emit(code.data(), code.size(),
+                                                 md5_of(code), path);
+  if (!ue) return NULL;
+  Unit *unit = ue->create();
+  delete ue;
+  return unit;
+}
+
+bool TestVm::TestAutoloadIndexRoots() {
+  if (RuntimeOption::RepoAuthoritative) {
+    SKIP("the index is read from the repo");
+  }
+  RuntimeOption::AutoloadIndex = true;
+  AutoloadIndex::Init();
+  VERIFY(AutoloadIndex::Enabled());
+
+  const StringData *cls = StringData::GetStaticString("TestVmAutoloaded");
+  const StringData *fn = StringData::GetStaticString("test_vm_autoloaded");
+  std::string code =
+    "<?php\nclass TestVmAutoloaded {}\nfunction test_vm_autoloaded() {}\n";
+  Unit *a = compile_unit(code, "/test_vm/a/lib.php");
+  Unit *b = compile_unit(code, "/test_vm/b/lib.php");
+  VERIFY(a && b);
+
+  std::string oldRoot = RuntimeOption::SourceRoot;
+  const StringData *aClass, *aFunc, *bBefore, *bClass, *aAfter;
+
+  RuntimeOption::SourceRoot = "/test_vm/a/";
+  AutoloadIndex::Record(a);
+  aClass = AutoloadIndex::Lookup(Repo::AutoloadClass, cls);
+  aFunc = AutoloadIndex::Lookup(Repo::AutoloadFunction, fn);
+
+  // another source root (a sandbox) doesn't see it, and defining the same
+  // names there neither replaces nor poisons the first root's entries
+  RuntimeOption::SourceRoot = "/test_vm/b/";
+  bBefore = AutoloadIndex::Lookup(Repo::AutoloadClass, cls);
+  AutoloadIndex::Record(b);
+  bClass = AutoloadIndex::Lookup(Repo::AutoloadClass, cls);
+
+  RuntimeOption::SourceRoot = "/test_vm/a/";
+  aAfter = AutoloadIndex::Lookup(Repo::AutoloadClass, cls);
+
+  RuntimeOption::SourceRoot = oldRoot;
+  RuntimeOption::AutoloadIndex = false;
+  delete a;
+  delete b;
+
+  VERIFY(aClass && aFunc && bClass && aAfter);
+  VS(aClass->data(), "/test_vm/a/lib.php");
+  VS(aFunc->data(), "/test_vm/a/lib.php");
+  VERIFY(bBefore == NULL);
+  VS(bClass->data(), "/test_vm/b/lib.php");
+  VS(aAfter->data(), "/test_vm/a/lib.php");
+  return Count(true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static UnitEmitter *emit_unique(const std::string &tag, const char *path) {
+  std::string code = "<?php\necho '" + tag + "';\n";
+  return Compiler::hphp_compiler_emit(code.data(), code.size(),
+                                      md5_of(code), path);
+}
+
+/**
+ * Commits on a thread of its own: Repo::get() is per thread, so the repo
+ * it opens there is the scratch one the test points Repo.Central.Path at,
+ * and nothing lands in the repo the rest of the tests use.
+ */
+class BatchCommitter {
+public:
+  BatchCommitter(UnitEmitter *first, UnitEmitter *good, UnitEmitter *dup)
+    : m_first(first), m_good(good), m_dup(dup), m_writable(false),
+      m_firstOk(false), m_batchOk(false), m_goodFound(false),
+      m_pending(false) {}
+
+  void run() {
+    Repo &repo = Repo::get();
+    m_writable = repo.repoIdForNewUnit(UnitOriginFile) != RepoIdInvalid;
+    if (!m_writable) return;
+
+    // the first unit is already in the repo, so committing another unit
+    // with its md5 fails and must take the good unit down with it
+    std::set<MD5> committed;
+    std::vector<UnitEmitter*> batch(1, m_first);
+    m_firstOk = Compiler::commitUnitBatch(batch, committed);
+    std::set<MD5> fresh; // the committer in another build hasn't seen it
+    batch.clear();
+    batch.push_back(m_good);
+    batch.push_back(m_dup);
+    m_batchOk = Compiler::commitUnitBatch(batch, fresh);
+
+    MD5 md5;
+    m_goodFound = repo.findFile("/test_vm/commit/good.php", "", md5);
+    m_pending = repo.rollbackPending();
+  }
+
+  UnitEmitter *m_first, *m_good, *m_dup;
+  bool m_writable, m_firstOk, m_batchOk, m_goodFound, m_pending;
+};
+
+bool TestVm::TestCommitBatchFailure() {
+  char dir[] = "/tmp/test_vm_repoXXXXXX";
+  VERIFY(mkdtemp(dir));
+  std::string oldCentral = RuntimeOption::RepoCentralPath;
+  std::string oldLocalMode = RuntimeOption::RepoLocalMode;
+  RuntimeOption::RepoCentralPath = std::string(dir) + "/central.hhbc";
+  RuntimeOption::RepoLocalMode = "--";
+
+  UnitEmitter *first = emit_unique("commit", "/test_vm/commit/first.php");
+  UnitEmitter *good = emit_unique("commit.good", "/test_vm/commit/good.php");
+  UnitEmitter *dup = emit_unique("commit", "/test_vm/commit/dup.php");
+  BatchCommitter committer(first, good, dup);
+  if (first && good && dup) {
+    AsyncFunc<BatchCommitter> func(&committer, &BatchCommitter::run);
+    func.start();
+    func.waitForEnd();
+  }
+
+  RuntimeOption::RepoCentralPath = oldCentral;
+  RuntimeOption::RepoLocalMode = oldLocalMode;
+  delete first;
+  delete good;
+  delete dup;
+  if (DIR *d = opendir(dir)) {
+    while (struct dirent *e = readdir(d)) {
+      if (e->d_name[0] != '.') {
+        unlink((std::string(dir) + "/" + e->d_name).c_str());
+      }
+    }
+    closedir(d);
+  }
+  rmdir(dir);
+
+  VERIFY(first && good && dup);
+  if (!committer.m_writable) {
+    SKIP("no writable repo");
+  }
+  VERIFY(committer.m_firstOk);
+  VERIFY(!committer.m_batchOk);
+  VERIFY(!committer.m_goodFound);
+  VERIFY(!committer.m_pending);
+  return Count(true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool TestVm::TestFuncProfileLoad() {
+  char path[] = "/tmp/test_vm_profileXXXXXX";
+  int fd = mkstemp(path);
+  VERIFY(fd >= 0);
+  close(fd);
+  VERIFY(write_file(path,
+                    "# calls\twork\tfunction\tfile\n"
+                    "60\t100\thot_a\tlib/a.php\n"
+                    "30\t500\tHot_B\t/var/www/lib/b.php\n"
+                    "not a profile line\n"
+                    "7\t7\tthree_fields\n"
+                    "10\t50\tcold_c\tc.php\n"
+                    "0\t20\tnever_called\tlib/a.php\n"));
+
+  std::string oldProfile = Option::FuncProfile;
+  int oldPercent = Option::FuncProfileHotPercent;
+  Option::FuncProfile = path;
+  // hot_a alone has 60 of the 100 calls; with Hot_B it covers 90
+  Option::FuncProfileHotPercent = 85;
+  Option::LoadFuncProfile();
+  std::set<std::string, stdltistr> hot = Option::HotFunctions;
+  std::vector<std::string> files = Option::HotFiles;
+
+  Option::FuncProfile = oldProfile;
+  Option::FuncProfileHotPercent = oldPercent;
+  Option::HotFunctions.clear();
+  Option::HotFiles.clear();
+  unlink(path);
+
+  VS((int)hot.size(), 2);
+  VERIFY(hot.count("hot_a"));
+  VERIFY(hot.count("hot_b"));
+  VERIFY(!hot.count("cold_c"));
+  VERIFY(!hot.count("three_fields"));
+  // files by total work, including work in functions never called
+  VS((int)files.size(), 3);
+  VS(files[0].c_str(), "/var/www/lib/b.php");
+  VS(files[1].c_str(), "lib/a.php");
+  VS(files[2].c_str(), "c.php");
+  return Count(true);
+}
+
+bool TestVm::TestFilesByHotness() {
+  AnalysisResultPtr ar(new AnalysisResult());
+  const char *names[] = { "lib/a.php", "lib/b.php", "c.php", "d.php" };
+  for (unsigned int i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+    ar->addFileScope(FileScopePtr(new FileScope(names[i], 0, md5_of(""))));
+  }
+
+  // a server under /var/www reports absolute paths; files gone from the
+  // build are dropped and repeats only count once
+  Option::HotFiles.push_back("/var/www/lib/b.php");
+  Option::HotFiles.push_back("lib/a.php");
+  Option::HotFiles.push_back("/var/www/missing.php");
+  Option::HotFiles.push_back("www/lib/a.php");
+  std::vector<FileScopePtr> files;
+  int hot = Compiler::filesByHotness(ar, files);
+  Option::HotFiles.clear();
+
+  VS(hot, 2);
+  VS((int)files.size(), 4);
+  VS(files[0]->getName().c_str(), "lib/b.php");
+  VS(files[1]->getName().c_str(), "lib/a.php");
+  VS(files[2]->getName().c_str(), "c.php");
+  VS(files[3]->getName().c_str(), "d.php");
+  return Count(true);
+}
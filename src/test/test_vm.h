@@ -0,0 +1,54 @@
+/*
+   +----------------------------------------------------------------------+
+   | HipHop for PHP                                                       |
+   +----------------------------------------------------------------------+
+   | Copyright (c) 2010- Facebook, Inc. (http://www.facebook.com)         |
+   +----------------------------------------------------------------------+
+   | This source file is subject to version 3.01 of the PHP license,      |
+   | that is bundled with this package in the file LICENSE, and is        |
+   | available through the world-wide-web at the following url:           |
+   | http://www.php.net/license/3_01.txt                                  |
+   | If you did not receive a copy of the PHP license and are unable to   |
+   | obtain it through the world-wide-web, please send a note to          |
+   | license@php.net so we can mail you a copy immediately.               |
+   +----------------------------------------------------------------------+
+*/
+
+#ifndef __TEST_VM_H__
+#define __TEST_VM_H__
+
+#include <test/test_base.h>
+#include <util/base.h>
+
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * In-process tests of VM and repo internals that PHP-level tests can't reach.
+ */
+class TestVm : public TestBase {
+ public:
+  TestVm();
+
+  virtual bool RunTests(const std::string &which);
+
+  // flat repo serialization
+  bool TestFlatRepoRoundTrip();
+  bool TestFlatRepoBounds();
+
+  // repo preload
+  bool TestPreloadThenRequest();
+
+  // autoload index
+  bool TestAutoloadIndexRoots();
+
+  // offline build repo commits
+  bool TestCommitBatchFailure();
+
+  // production function profile
+  bool TestFuncProfileLoad();
+  bool TestFilesByHotness();
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // __TEST_VM_H__
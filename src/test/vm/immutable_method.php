@@ -0,0 +1,56 @@
+<?php
+
+// Calls through methods lookupImmutableMethod can bind at translation time:
+// the pushed ActRec's Func must have the right reffiness for the FPass*
+// instructions that follow, or by-ref arguments are passed by value.
+
+final class F {
+  public function set(&$x, $v) { $x = $v; }
+  public function get($x) { return $x; }
+  public function __call($name, $args) { return $name . count($args); }
+}
+
+class B {
+  final public function set(&$x, $v) { $x = $v; }
+  final public function counter() {
+    static $n = 0;
+    return ++$n;
+  }
+  public function mayChange(&$x) { $x = 'B'; }
+}
+
+class S extends B {
+  public function mayChange(&$x) { $x = 'S'; }
+}
+
+function run_final_class() {
+  $f = new F;
+  $total = 0;
+  for ($i = 0; $i < 5; $i++) {
+    $f->set($v, $i);
+    $total += $f->get($v);
+  }
+  echo "final class: $v $total " . $f->missing(1, 2) . "\n";
+}
+
+function run_final_method($o) {
+  $o->set($v, get_class($o));
+  echo "final method: $v\n";
+}
+
+function run_overridden($o) {
+  $v = 'unset';
+  $o->mayChange($v);
+  echo "overridden: $v\n";
+}
+
+for ($i = 0; $i < 2; $i++) {
+  run_final_class();
+  run_final_method(new B);
+  run_final_method(new S);
+  run_overridden(new B);
+  run_overridden(new S);
+  $b = new B;
+  $s = new S;
+  echo "counter: " . $b->counter() . " " . $s->counter() . "\n";
+}
@@ -0,0 +1,48 @@
+<?php
+
+// Outside RepoAuthoritative (or for a class that isn't AttrUnique),
+// lookupImmutableMethod only binds calls made from the class's own
+// context: private methods through $this, and static methods of the class
+// or its parents. Base is declared conditionally so it is never unique.
+
+if (mt_rand() < 0) {
+  class Base {
+    public function run($n) { return 'wrong'; }
+  }
+} else {
+  class Base {
+    private $count = 0;
+    private function bump(&$x) { $x++; $this->count++; }
+    public static function twice($x) { return $x * 2; }
+    final public function label() { return get_class($this); }
+    public function run($n) {
+      $total = 0;
+      for ($i = 0; $i < $n; $i++) {
+        $this->bump($total);
+        $total += self::twice($i);
+        $total += static::twice($i);
+      }
+      return $total . '/' . $this->count;
+    }
+  }
+}
+
+final class Child extends Base {
+  public static function twice($x) { return $x * 3; }
+  public function run2($n) {
+    $total = 0;
+    for ($i = 0; $i < $n; $i++) {
+      $total += parent::twice($i);
+      $total += self::twice($i);
+    }
+    return $total . ' ' . $this->label();
+  }
+}
+
+for ($j = 0; $j < 3; $j++) {
+  $b = new Base;
+  echo $b->run(5), "\n";
+  $c = new Child;
+  echo $c->run(5), "\n";
+  echo $c->run2(5), "\n";
+}
@@ -0,0 +1,37 @@
+<?php
+
+// Every return in count_up() is an int, so a repo build infers its return
+// type. Once it is intercepted, the handler's value comes back in its
+// place and callers must not assume an int.
+
+function count_up($n) {
+  if ($n > 100) return 100;
+  return $n + 1;
+}
+
+function handler($name, $obj, $args, $data, &$done) {
+  $done = true;
+  return $data;
+}
+
+function call_it($n) {
+  $r = count_up($n);
+  return $r;
+}
+
+function main() {
+  $sum = 0;
+  for ($i = 0; $i < 100; $i++) {
+    $sum += call_it($i);
+  }
+  var_dump($sum);
+
+  fb_intercept('count_up', 'handler', 'intercepted');
+  var_dump(call_it(1));
+  fb_intercept('count_up', 'handler', array(1, 2));
+  var_dump(call_it(1));
+  fb_intercept('count_up', null);
+  var_dump(call_it(1));
+}
+
+main();
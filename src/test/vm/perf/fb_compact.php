@@ -0,0 +1,43 @@
+<?php
+
+/**
+ * Round trips a list of same-shaped rows, like a cached query result,
+ * through fb_compact_serialize(); most of the payload is repeated keys and
+ * low-cardinality strings. Runs version 1 and then version 2 of the format
+ * so the two can be compared.
+ */
+
+function build($n) {
+  $countries = array('US', 'GB', 'BR', 'IN');
+  $rows = array();
+  for ($i = 0; $i < $n; $i++) {
+    $rows[] = array(
+      'id' => 1000000 + $i,
+      'name' => "user $i",
+      'status' => $i % 3 ? 'active' : 'disabled',
+      'country' => $countries[$i % 4],
+      'score' => $i * 7 % 101,
+      'created' => 1300000000 + $i * 60,
+    );
+  }
+  return $rows;
+}
+
+function run($data, $version) {
+  ini_set('hphp.fb_compact_serialize_version', $version);
+  $total = 0;
+  for ($i = 0; $i < 300; $i++) {
+    $s = fb_compact_serialize($data);
+    $back = fb_compact_unserialize($s, $ok);
+    $total += count($back) + $back[$i % 500]['score'];
+  }
+  echo "fb_compact v$version: ", $ok ? "ok" : "failed", " ", $total, "\n";
+  return strlen($s);
+}
+
+$data = build(500);
+$old = ini_get('hphp.fb_compact_serialize_version');
+$v1 = run($data, 1);
+$v2 = run($data, 2);
+ini_set('hphp.fb_compact_serialize_version', $old);
+echo "v2 smaller than v1: ", $v2 < $v1 ? "yes" : "no", "\n";
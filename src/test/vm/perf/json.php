@@ -0,0 +1,30 @@
+<?php
+
+/**
+ * Encodes and decodes an API style response made mostly of ASCII strings,
+ * so string scanning dominates on both sides.
+ */
+
+function build($n) {
+  $items = array();
+  for ($i = 0; $i < $n; $i++) {
+    $items[] = array(
+      'id' => $i,
+      'name' => "item number $i",
+      'url' => "http://www.example.com/items/$i?ref=feed",
+      'description' => str_repeat('lorem ipsum dolor sit amet ', 4),
+      'tags' => array('alpha', 'beta', "tag$i"),
+      'score' => $i * 3,
+    );
+  }
+  return array('count' => $n, 'items' => $items);
+}
+
+$data = build(200);
+$total = 0;
+for ($i = 0; $i < 500; $i++) {
+  $json = json_encode($data);
+  $back = json_decode($json, true);
+  $total += count($back['items']) + $back['items'][$i % 200]['id'];
+}
+echo "json: ", strlen($json), " ", $total, "\n";
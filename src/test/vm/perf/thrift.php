@@ -0,0 +1,129 @@
+<?php
+
+/**
+ * Round trips a response with many small nested structs through both
+ * thrift protocols; decoding cost is dominated by per-struct spec handling.
+ */
+
+class TType {
+  const I32    = 8;
+  const I64    = 10;
+  const DOUBLE = 4;
+  const STRING = 11;
+  const STRUCT = 12;
+  const LST    = 15;
+}
+
+class DummyProtocol {
+  public $t;
+  function __construct() {
+    $this->t = new DummyTransport();
+  }
+  function getTransport() {
+    return $this->t;
+  }
+}
+
+class DummyTransport {
+  public $buff = '';
+  public $pos = 0;
+  function flush() { }
+  function write($buff) {
+    $this->buff .= $buff;
+  }
+  function read($n) {
+    $r = substr($this->buff, $this->pos, $n);
+    $this->pos += $n;
+    return $r;
+  }
+}
+
+class Leaf {
+  static $_TSPEC;
+  public $a = null;
+  public $b = null;
+  public function __construct($a = null, $b = null) {
+    if (!isset(self::$_TSPEC)) {
+      self::$_TSPEC = array(
+        1 => array('var' => 'a', 'type' => TType::I32),
+        2 => array('var' => 'b', 'type' => TType::I64),
+      );
+    }
+    $this->a = $a;
+    $this->b = $b;
+  }
+}
+
+class Item {
+  static $_TSPEC;
+  public $id = null;
+  public $name = null;
+  public $score = null;
+  public $tags = null;
+  public $child = null;
+  public function __construct() {
+    if (!isset(self::$_TSPEC)) {
+      self::$_TSPEC = array(
+        1 => array('var' => 'id', 'type' => TType::I32),
+        2 => array('var' => 'name', 'type' => TType::STRING),
+        3 => array('var' => 'score', 'type' => TType::DOUBLE),
+        4 => array('var' => 'tags', 'type' => TType::LST,
+                   'etype' => TType::STRING,
+                   'elem' => array('type' => TType::STRING)),
+        5 => array('var' => 'child', 'type' => TType::STRUCT,
+                   'class' => 'Leaf'),
+      );
+    }
+  }
+}
+
+class Response {
+  static $_TSPEC;
+  public $items = null;
+  public function __construct() {
+    if (!isset(self::$_TSPEC)) {
+      self::$_TSPEC = array(
+        1 => array('var' => 'items', 'type' => TType::LST,
+                   'etype' => TType::STRUCT,
+                   'elem' => array('type' => TType::STRUCT,
+                                   'class' => 'Item')),
+      );
+    }
+  }
+}
+
+function make_response($n) {
+  $r = new Response();
+  $r->items = array();
+  for ($i = 0; $i < $n; $i++) {
+    $item = new Item();
+    $item->id = $i;
+    $item->name = "item$i";
+    $item->score = $i / 2;
+    $item->tags = array('x', 'y');
+    $item->child = new Leaf($i, $i * 2);
+    $r->items[] = $item;
+  }
+  return $r;
+}
+
+function check($r) {
+  $sum = 0;
+  foreach ($r->items as $item) {
+    $sum += $item->id + $item->child->b;
+  }
+  return count($r->items) . ' ' . $sum;
+}
+
+$r = make_response(5000);
+for ($round = 0; $round < 10; $round++) {
+  $p = new DummyProtocol();
+  thrift_protocol_write_binary($p, 'get', 2, $r, 1, true);
+  $binary = check(thrift_protocol_read_binary($p, 'Response', true));
+
+  $p = new DummyProtocol();
+  thrift_protocol_write_compact($p, 'get', 2, $r, 1);
+  $compact = check(thrift_protocol_read_compact($p, 'Response'));
+}
+echo "binary: $binary\n";
+echo "compact: $compact\n";
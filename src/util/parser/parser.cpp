@@ -20,8 +20,7 @@
 namespace HPHP {
 ///////////////////////////////////////////////////////////////////////////////
 
-Mutex ParserBase::s_mutex;
-std::map<int64, int> ParserBase::s_closureIds;
+ParserBase::ClosureIdMap ParserBase::s_closureIds;
 
 char ParserBase::GetAnonPrefix(AnonFuncKind kind) {
   CT_ASSERT(Closure == 0 && Continuation <= 9);
@@ -64,7 +63,6 @@ bool ParserBase::IsAnonFunctionName(const char *name) {
 }
 
 void ParserBase::Reset() {
-  Lock lock(s_mutex);
   s_closureIds.clear();
 }
 
@@ -146,9 +144,9 @@ std::string ParserBase::getAnonFuncName(AnonFuncKind kind) {
   int64 h = hash_string_cs(m_fileName, strlen(m_fileName));
   int closureId;
   {
-    Lock lock(s_mutex);
-    int &id = s_closureIds[h];
-    closureId = ++id;
+    ClosureIdMap::accessor acc;
+    if (s_closureIds.insert(acc, h)) acc->second = 0;
+    closureId = ++acc->second;
   }
 
   string ret;
@@ -19,6 +19,7 @@
 
 #include <util/parser/scanner.h>
 #include <util/lock.h>
+#include <tbb/concurrent_hash_map.h>
 #include <util/case_insensitive.h>
 
 #define IMPLEMENT_XHP_ATTRIBUTES                \
@@ -239,9 +240,9 @@ protected:
   std::string m_namespace; // current namespace
   hphp_string_imap<std::string> m_aliases;
 
-  // for closure hidden name
-  static Mutex s_mutex;
-  static std::map<int64, int> s_closureIds;
+  // for closure hidden name; parser threads only contend on the same file
+  typedef tbb::concurrent_hash_map<int64, int> ClosureIdMap;
+  static ClosureIdMap s_closureIds;
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -50,6 +50,7 @@ enum Rank {
 
   RankStatCache,
 
+  RankParsedFiles,
   RankFileRepo,
   RankStatCacheNode = RankFileRepo,
   RankFileMd5,